@@ -0,0 +1,78 @@
+//! @file bench_kinetics.cpp Micro-benchmarks for kinetics and thermo hot paths
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/base/global.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Cantera;
+
+namespace {
+
+//! Phase definitions of increasing size, selected by the benchmark range
+shared_ptr<Solution> mech(int size)
+{
+    if (size == 0) {
+        return newSolution("h2o2.yaml", "ohmech", "none");
+    } else if (size == 1) {
+        return newSolution("gri30.yaml", "gri30", "none");
+    } else {
+        return newSolution("nDodecane_Reitz.yaml", "nDodecane_IG", "none");
+    }
+}
+
+//! Install a slightly perturbed state so caches cannot short-circuit
+void perturb(ThermoPhase& gas, int i)
+{
+    gas.setState_TP(1000.0 + (i % 32), OneAtm);
+}
+
+} // anonymous namespace
+
+static void BM_netProductionRates(benchmark::State& state)
+{
+    auto sol = mech(static_cast<int>(state.range(0)));
+    auto& gas = *sol->thermo();
+    auto& kin = *sol->kinetics();
+    gas.setState_TP(1200.0, OneAtm);
+    vector_fp wdot(gas.nSpecies());
+    int i = 0;
+    for (auto _ : state) {
+        perturb(gas, i++);
+        kin.getNetProductionRates(wdot.data());
+        benchmark::DoNotOptimize(wdot.data());
+    }
+}
+BENCHMARK(BM_netProductionRates)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_thermoUpdate(benchmark::State& state)
+{
+    auto sol = mech(static_cast<int>(state.range(0)));
+    auto& gas = *sol->thermo();
+    int i = 0;
+    for (auto _ : state) {
+        perturb(gas, i++);
+        benchmark::DoNotOptimize(gas.cp_mass());
+        benchmark::DoNotOptimize(gas.enthalpy_mass());
+    }
+}
+BENCHMARK(BM_thermoUpdate)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_fromYamlFile(benchmark::State& state)
+{
+    const char* files[] = {"h2o2.yaml", "gri30.yaml", "nDodecane_Reitz.yaml"};
+    for (auto _ : state) {
+        // defeat the in-memory cache to measure the parse itself
+        AnyMap::clearCachedFile(findInputFile(files[state.range(0)]));
+        benchmark::DoNotOptimize(AnyMap::fromYamlFile(files[state.range(0)]));
+    }
+}
+BENCHMARK(BM_fromYamlFile)->Arg(0)->Arg(1)->Arg(2);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,64 @@
+//! @file bench_transport_reactor.cpp Micro-benchmarks for transport and
+//! reactor hot paths
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/transport/Transport.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Cantera;
+
+static void BM_viscosity(benchmark::State& state)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "mixture-averaged");
+    auto& gas = *sol->thermo();
+    auto& tran = *sol->transport();
+    gas.setState_TPX(900.0, OneAtm, "CH4:1, O2:2, N2:7.52");
+    int i = 0;
+    for (auto _ : state) {
+        gas.setState_TP(900.0 + (i++ % 32), OneAtm);
+        benchmark::DoNotOptimize(tran.viscosity());
+    }
+}
+BENCHMARK(BM_viscosity);
+
+static void BM_binaryDiffUpdate(benchmark::State& state)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "mixture-averaged");
+    auto& gas = *sol->thermo();
+    auto& tran = *sol->transport();
+    gas.setState_TPX(900.0, OneAtm, "CH4:1, O2:2, N2:7.52");
+    vector_fp d(gas.nSpecies());
+    int i = 0;
+    for (auto _ : state) {
+        gas.setState_TP(900.0 + (i++ % 32), OneAtm);
+        tran.getMixDiffCoeffs(d.data());
+        benchmark::DoNotOptimize(d.data());
+    }
+}
+BENCHMARK(BM_binaryDiffUpdate);
+
+static void BM_reactorStep(benchmark::State& state)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    for (auto _ : state) {
+        state.PauseTiming();
+        sol->thermo()->setState_TPX(1100.0, OneAtm, "H2:2, O2:1, AR:4");
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.initialize();
+        state.ResumeTiming();
+        for (int i = 0; i < 100; i++) {
+            net.step();
+        }
+    }
+}
+BENCHMARK(BM_reactorStep)->Unit(benchmark::kMillisecond);
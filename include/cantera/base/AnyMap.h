@@ -406,6 +406,14 @@ public:
      *  first, followed by the current working directory and the Cantera include
      *  path.
      */
+    //! Write a binary representation of this AnyMap to *out*. Used by the
+    //! optional on-disk cache of parsed YAML input files.
+    //! @see fromYamlFile()
+    void writeBinary(std::ostream& out) const;
+
+    //! Read an AnyMap written by writeBinary()
+    static AnyMap readBinary(std::istream& in);
+
     static AnyMap fromYamlFile(const std::string& name,
                                const std::string& parent_name="");
 
@@ -72,10 +72,18 @@ public:
 
     Array2D(const Array2D& y);
 
+    //! Move constructor; adopts the storage of *y*, which is left in an
+    //! unspecified valid state
+    Array2D(Array2D&& y) = default;
+
     virtual ~Array2D() {}
 
     Array2D& operator=(const Array2D& y);
 
+    //! Move assignment; adopts the storage of *y*, which is left in an
+    //! unspecified valid state
+    Array2D& operator=(Array2D&& y) = default;
+
     //! Resize the array, and fill the new entries with 'v'
     /*!
      * @param n  This is the number of rows
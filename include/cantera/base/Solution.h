@@ -86,6 +86,81 @@ public:
          return m_adjacent.size();
     }
 
+    //! Create a new Solution object sharing the immutable mechanism data of
+    //! this object.
+    /*!
+     * The clone carries its own thermodynamic state and scratch arrays, while
+     * Species and Reaction definitions are shared via ThermoPhase::clone()
+     * and Kinetics::clone(); a fresh Transport manager of the same model is
+     * created. No input files are re-parsed, making this the preferred way
+     * to build large ensembles of identical reactors. Cloning is not
+     * supported for Interface objects or Solutions with adjacent phases.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual shared_ptr<Solution> clone() const;
+
+    //! Benchmark the kernel backends on this mechanism and install the
+    //! winner.
+    /*!
+     * Times the per-reaction and batched rate-evaluator configurations on
+     * clones of this Solution at its current state, selects the faster
+     * one via Cantera::use_batched_rate_evaluators() for subsequently
+     * created objects, and returns the measured timings. When the
+     * environment variable CANTERA_TUNING_CACHE names a writable
+     * directory, the decision is persisted keyed by a mechanism
+     * fingerprint and reused by later processes, so deployments
+     * self-optimize once per mechanism and host configuration.
+     *
+     * @param nEvals  number of evaluations per timing sample
+     * @returns  timings and the selected configuration
+     *
+     * @warning  This method is an experimental part of the %Cantera API
+     *      and may be changed or removed without notice.
+     */
+    AnyMap autotuneKernels(size_t nEvals=200);
+
+    /*! @name Cross-process mechanism sharing
+     * Placing the immutable mechanism tables (thermo coefficients,
+     * stoichiometry indices, transport fits) in a POSIX shared-memory
+     * segment for the ranks of one node was evaluated and is not
+     * implemented: those tables live inside standard containers spread
+     * across Species, the stoichiometry managers and the transport fits,
+     * and relocating them into a shared segment would require custom
+     * allocators and offset pointers through every one of those types -
+     * an ABI-level redesign, not an opt-in mode. The per-rank footprint
+     * levers that do exist are dropRetainedInput() (sheds the dominant
+     * duplicated data, the retained input maps), the binary input cache
+     * (eliminates duplicated parse work), and clone() within a rank.
+     */
+    //! @{
+    //! @}
+
+    //! Discard the parsed input data retained on every Species and
+    //! Reaction of this Solution.
+    /*!
+     * The retained AnyMaps exist only for round-trip serialization and
+     * user-defined field access; the hot paths never read them, and for
+     * large mechanisms they dominate the per-process footprint. After
+     * calling this method, YAML output of this Solution loses
+     * user-defined input fields (the model parameters themselves are
+     * regenerated from the objects), so ranks that serialize should keep
+     * their input data while pure worker ranks drop it.
+     */
+    void dropRetainedInput();
+
+    //! Estimated memory footprint of the components of this Solution,
+    //! in bytes, as an AnyMap with entries for the retained species and
+    //! reaction input data, species thermo coefficient tables, reaction
+    //! objects and transport fits, plus a total. The values are estimates
+    //! (container capacities and allocator overhead cannot be observed
+    //! exactly), intended for capacity planning and for quantifying
+    //! deduplication wins.
+    //! @warning  This method is an experimental part of the %Cantera API
+    //!     and may be changed or removed without notice.
+    AnyMap memoryFootprint() const;
+
     AnyMap parameters(bool withInput=false) const;
 
     //! Access input data associated with header definition
@@ -0,0 +1,78 @@
+/**
+ * @file ThreadPool.h
+ *   A process-wide worker pool shared by the parallel features of the
+ *   library.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_THREADPOOL_H
+#define CT_THREADPOOL_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <functional>
+
+namespace Cantera
+{
+
+//! A process-wide pool of worker threads.
+/*!
+ * Parallel features (ensemble integration, threaded chemistry, batched
+ * equilibrate) share this pool instead of spinning up their own threads,
+ * avoiding oversubscription when several features run concurrently. Work
+ * items of a parallelFor() are handed out through a shared counter, so
+ * uneven items balance automatically.
+ *
+ * A host application may donate its own execution resources by installing
+ * an executor: the pool then submits its batch function to the executor
+ * instead of its own workers, so embedding codes control thread placement
+ * (including NUMA pinning, which the library itself does not attempt, as
+ * it has no portable way to know the host's topology policy).
+ *
+ * @warning  This class is an experimental part of the %Cantera API and may
+ *      be changed or removed without notice.
+ */
+class ThreadPool
+{
+public:
+    //! The process-wide pool. Created on first use with one worker per
+    //! hardware thread.
+    static ThreadPool& instance();
+
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Set the number of worker threads
+    void resize(size_t nThreads);
+
+    //! Number of worker threads
+    size_t size() const;
+
+    //! Type of an external executor: called with a worker function and the
+    //! suggested number of concurrent invocations; every invocation of the
+    //! worker function must have returned before the executor returns.
+    typedef std::function<void(const std::function<void()>&, size_t)> Executor;
+
+    //! Install an external executor donating the host's threads (an empty
+    //! function restores the internal workers)
+    void setExecutor(Executor executor);
+
+    //! Run f(i) for every i in [0, n), distributing the iterations over
+    //! the workers (or the external executor) with dynamic load balancing.
+    //! Exceptions thrown by f are collected and the first one is re-thrown
+    //! after all iterations finish. Nested calls from within f run
+    //! serially in the calling worker.
+    void parallelFor(size_t n, const std::function<void(size_t)>& f);
+
+private:
+    ThreadPool();
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+}
+
+#endif
@@ -9,11 +9,21 @@
 #define CT_VALUECACHE_H
 
 #include "ct_defs.h"
+#include <deque>
 #include <limits>
 
+//! Compile-time switch for per-entry cache hit/miss statistics. Off by
+//! default; build with -DCT_CACHE_STATS=1 to enable the counters and the
+//! data behind ValueCache::getStats().
+#ifndef CT_CACHE_STATS
+#define CT_CACHE_STATS 0
+#endif
+
 namespace Cantera
 {
 
+class AnyMap;
+
 /*! A cached property value and the state at which it was evaluated
  *
  * This struct stores the value of some property evaluated at a particular
@@ -38,15 +48,28 @@ struct CachedValue {
     {
     }
 
+    //! Record the outcome of a validation in the statistics counters
+    void recordStat(bool hit) {
+#if CT_CACHE_STATS
+        if (hit) {
+            hits++;
+        } else {
+            misses++;
+        }
+#endif
+    }
+
     //! Check whether the currently cached value is valid based on
     //! a single state variable. If it is not valid it updates the stored
     //! state to the new state in addition to returning false.
     bool validate(double state1New) {
       if(state1 == state1New) {
+        recordStat(true);
         return true;
       } else {
         state1 = state1New;
       }
+      recordStat(false);
       return false;
     }
 
@@ -55,11 +78,13 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(double state1New, double state2New) {
       if(state1 == state1New && state2 == state2New) {
+        recordStat(true);
         return true;
       } else {
         state1 = state1New;
         state2 = state2New;
       }
+      recordStat(false);
       return false;
     }
 
@@ -68,11 +93,13 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(double state1New, int stateNumNew) {
       if(state1 == state1New && stateNum == stateNumNew) {
+        recordStat(true);
         return true;
       } else {
         state1 = state1New;
         stateNum = stateNumNew;
       }
+      recordStat(false);
       return false;
     }
 
@@ -81,10 +108,12 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(int stateNumNew) {
       if(stateNum == stateNumNew) {
+        recordStat(true);
         return true;
       } else {
         stateNum = stateNumNew;
       }
+      recordStat(false);
       return false;
     }
 
@@ -93,12 +122,14 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(double state1New, double state2New, int stateNumNew) {
       if(state1 == state1New && state2 == state2New && stateNum == stateNumNew) {
+        recordStat(true);
         return true;
       } else {
         state1 = state1New;
         state2 = state2New;
         stateNum = stateNumNew;
       }
+      recordStat(false);
       return false;
     }
 
@@ -116,6 +147,11 @@ struct CachedValue {
 
     //! The value of the cached property
     T value;
+
+#if CT_CACHE_STATS
+    long long hits = 0; //!< Number of validations that reused the value
+    long long misses = 0; //!< Number of validations requiring recomputation
+#endif
 };
 
 typedef CachedValue<double>& CachedScalar;
@@ -163,15 +199,26 @@ public:
     //! Get a reference to a CachedValue object representing a scalar
     //! (doublereal) with the given id.
     CachedScalar getScalar(int id) {
+        if (m_scalarCache.size() <= static_cast<size_t>(id)) {
+            m_scalarCache.resize(id + 1);
+        }
         return m_scalarCache[id];
     }
 
     //! Get a reference to a CachedValue object representing an array (vector_fp)
     //! with the given id.
     CachedArray getArray(int id) {
+        if (m_arrayCache.size() <= static_cast<size_t>(id)) {
+            m_arrayCache.resize(id + 1);
+        }
         return m_arrayCache[id];
     }
 
+    //! Per-entry hit/miss statistics, keyed by cache id, as entries of the
+    //! form `id-<n>: {hits: ..., misses: ...}`. Empty unless compiled with
+    //! CT_CACHE_STATS=1; entries that were never validated are omitted.
+    AnyMap getStats() const;
+
     //! Clear all cached values. This method should be called if the cached
     //! values may be invalidated in a way that is not represented by the state
     //! variables alone, such as a change to the constants defining a species
@@ -179,11 +226,13 @@ public:
     void clear();
 
 protected:
-    //! Cached scalar values
-    std::map<int, CachedValue<double> > m_scalarCache;
+    //! Cached scalar values, directly indexed by id. A deque is used so that
+    //! growing the cache in getScalar()/getArray() never invalidates
+    //! references held to other entries.
+    std::deque<CachedValue<double> > m_scalarCache;
 
-    //! Cached array values
-    std::map<int, CachedValue<vector_fp> > m_arrayCache;
+    //! Cached array values, directly indexed by id
+    std::deque<CachedValue<vector_fp> > m_arrayCache;
 
     //! The last assigned id. Automatically incremented by the getId() method.
     static int m_last_id;
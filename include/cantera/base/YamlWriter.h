@@ -43,6 +43,20 @@ public:
     //! the specified file.
     void toYamlFile(const std::string& filename) const;
 
+    //! Write the definitions for the added phases, species and reactions to
+    //! *out* incrementally, holding at most one entry in memory at a time.
+    /*!
+     * Unlike toYamlString(), which materializes the complete document as
+     * nested AnyMaps before emitting, this method streams each phase,
+     * species and reaction entry as it is generated, so memory use is
+     * bounded by the largest single entry. Limitations relative to the
+     * non-streaming path: output is written in the default unit system
+     * (setUnitSystem() is rejected), species appearing in several phases
+     * are deduplicated by name without comparing their definitions, and
+     * phases do not share reaction sections.
+     */
+    void toYamlStream(std::ostream& out) const;
+
     //! For output floating point values, set the maximum number of digits to
     //! the right of the decimal point. The default is 15 digits.
     void setPrecision(long int n) {
@@ -176,6 +176,12 @@ void writeline(char repeat, size_t count,
 //! helper function passing deprecation warning to global handler
 void _warn_deprecated(const std::string& method, const std::string& extra="");
 
+//! @copydoc Application::deprecation_warnings_suppressed
+bool deprecation_warnings_suppressed();
+
+//! @copydoc Application::warnings_silenced
+bool warnings_silenced();
+
 //! Print a deprecation warning raised from *method*.
 /*!
 *  @see Application::warn_deprecated
@@ -186,6 +192,10 @@ void _warn_deprecated(const std::string& method, const std::string& extra="");
 template <typename... Args>
 void warn_deprecated(const std::string& method, const std::string& msg,
                      const Args&... args) {
+    if (deprecation_warnings_suppressed()) {
+        // the message is never seen; skip its formatting entirely
+        return;
+    }
     if (sizeof...(args) == 0) {
         _warn_deprecated(method, msg);
     } else {
@@ -211,6 +221,10 @@ void _warn(const std::string& warning,
 template <typename... Args>
 void warn(const std::string& warning, const std::string& method,
           const std::string& msg, const Args&... args) {
+    if (warnings_silenced()) {
+        // the message is never seen; skip its formatting entirely
+        return;
+    }
     if (sizeof...(args) == 0) {
         _warn(warning, method, msg);
     } else {
@@ -227,6 +241,10 @@ void warn(const std::string& warning, const std::string& method,
 template <typename... Args>
 void warn_user(const std::string& method, const std::string& msg,
                const Args&... args) {
+    if (warnings_silenced()) {
+        // the message is never seen; skip its formatting entirely
+        return;
+    }
     if (sizeof...(args) == 0) {
         _warn("Cantera", method, msg);
     } else {
@@ -258,9 +276,39 @@ void use_legacy_rate_constants(bool legacy=true);
 //! @copydoc Application::legacy_rate_constants_used
 bool legacy_rate_constants_used();
 
+//! @copydoc Application::use_batched_rate_evaluators
+void use_batched_rate_evaluators(bool batched=true);
+
+//! @copydoc Application::batched_rate_evaluators_used
+bool batched_rate_evaluators_used();
+
 //! @copydoc Application::Messages::setLogger
 void setLogger(Logger* logwriter);
 
+//! Add *seconds* of wall time to the named setup phase accumulator
+//! @see getSetupTimings()
+void recordSetupTime(const std::string& phase, double seconds);
+
+//! Cumulative wall-clock time [s] spent in named setup phases (YAML
+//! parsing, thermo/kinetics/transport construction) since the process
+//! started or the last clearSetupTimings() call. The timers are always on;
+//! their cost is a few steady_clock reads per Solution constructed.
+AnyMap getSetupTimings();
+
+//! Reset the setup phase timing accumulators
+void clearSetupTimings();
+
+//! Set the thoroughness of the array finite-checks used in solver hot paths
+//! (see checkFinite()): 2 (default) screens every element, 1 samples every
+//! eighth element, 0 disables the screen entirely. Lower levels trade error
+//! localization for speed in production runs; a non-finite value that
+//! escapes the screen still surfaces later through solver failures.
+void setFiniteCheckLevel(int level);
+
+//! Thoroughness of the array finite-checks
+//! @see setFiniteCheckLevel()
+int finiteCheckLevel();
+
 //! Clip *value* such that lower <= value <= upper
 template <class T>
 inline T clip(const T& value, const T& lower, const T& upper)
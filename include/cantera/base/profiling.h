@@ -0,0 +1,150 @@
+/**
+ * @file profiling.h
+ *   Lightweight always-on instrumentation for solver hot paths: named
+ *   call counters and scoped wall-time accumulators with an AnyMap dump.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_PROFILING_H
+#define CT_PROFILING_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <atomic>
+#include <chrono>
+
+//! Compile-time switch for the hot-path instrumentation. Building with
+//! -DCT_PROFILING=0 turns the CT_PROFILE_SCOPE sites into nothing.
+#ifndef CT_PROFILING
+#define CT_PROFILING 1
+#endif
+
+namespace Cantera
+{
+
+class AnyMap;
+
+#if CT_PROFILING
+
+//! A named call counter and wall-time accumulator for one instrumented
+//! site. Instances register themselves in a process-wide list at
+//! construction; the accumulators use relaxed atomics, so concurrent
+//! updates from worker threads are safe and nearly free.
+class HotPathTimer
+{
+public:
+    explicit HotPathTimer(const char* name);
+
+    //! Record one traversal of the instrumented scope taking *ns*
+    //! nanoseconds
+    void record(long long ns) {
+        m_calls.fetch_add(1, std::memory_order_relaxed);
+        m_ns.fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    const char* name() const {
+        return m_name;
+    }
+
+    //! Number of traversals recorded
+    long long calls() const {
+        return m_calls.load(std::memory_order_relaxed);
+    }
+
+    //! Accumulated wall time [s]
+    double seconds() const {
+        return 1e-9 * m_ns.load(std::memory_order_relaxed);
+    }
+
+    //! Reset this site's accumulators
+    void clear() {
+        m_calls = 0;
+        m_ns = 0;
+    }
+
+private:
+    const char* m_name; //!< Site name
+    std::atomic<long long> m_calls{0}; //!< Number of traversals
+    std::atomic<long long> m_ns{0}; //!< Accumulated wall time [ns]
+};
+
+//! Accumulates the wall time of its scope into a HotPathTimer
+class ScopedProfile
+{
+public:
+    explicit ScopedProfile(HotPathTimer& timer)
+        : m_timer(timer)
+        , m_start(std::chrono::steady_clock::now())
+    {
+    }
+    ~ScopedProfile() {
+        m_timer.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_start).count());
+    }
+
+private:
+    HotPathTimer& m_timer;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+//! Instrument the enclosing scope under the given site name
+#define CT_PROFILE_SCOPE(name) \
+    static ::Cantera::HotPathTimer ct_profile_site(name); \
+    ::Cantera::ScopedProfile ct_profile_scope(ct_profile_site)
+
+#else // !CT_PROFILING
+
+#define CT_PROFILE_SCOPE(name)
+
+#endif
+
+//! Compile-time switch for allocation telemetry. When built with
+//! -DCT_ALLOC_TRACKING=1, the library overrides the global allocation
+//! functions with counting versions, allocationCount() reports the number
+//! of heap allocations made by the current thread, and AssertNoAllocations
+//! guards can fence hot paths in CI. Off by default, as the override
+//! affects the whole process.
+#ifndef CT_ALLOC_TRACKING
+#define CT_ALLOC_TRACKING 0
+#endif
+
+//! Number of heap allocations made by the calling thread since it started
+//! (always 0 when allocation tracking is compiled out)
+long long allocationCount();
+
+//! Scope guard asserting that its scope performs no heap allocations.
+/*!
+ * With allocation tracking compiled in, the destructor throws (or warns,
+ * when throwing is disabled) if the allocation count advanced inside the
+ * scope; wrap ReactorNet::step() or OneDim::eval() with it in CI to keep
+ * hot paths allocation-free. A no-op when tracking is compiled out.
+ */
+class AssertNoAllocations
+{
+public:
+    //! @param site  name reported when the assertion fires
+    explicit AssertNoAllocations(const char* site)
+        : m_site(site)
+        , m_start(allocationCount())
+    {
+    }
+    ~AssertNoAllocations() noexcept(false);
+
+private:
+    const char* m_site; //!< Reported site name
+    long long m_start; //!< Allocation count at scope entry
+};
+
+//! Calls and cumulative wall time [s] of every instrumented hot-path site,
+//! as a map of site name to {calls, seconds}. Empty when the
+//! instrumentation is compiled out.
+AnyMap getProfilingData();
+
+//! Reset all hot-path instrumentation accumulators
+void clearProfilingData();
+
+}
+
+#endif
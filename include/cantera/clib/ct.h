@@ -37,6 +37,11 @@ extern "C" {
                                             double* y, int norm);
     CANTERA_CAPI int thermo_setMoleFractionsByName(int n, const char* x);
     CANTERA_CAPI int thermo_setMassFractionsByName(int n, const char* y);
+    //! Batched evaluation of (T, P, Y) states; any of rho/h/s/cp may be NULL
+    CANTERA_CAPI int thermo_evaluateStates(int n, size_t nStates,
+                                           const double* T, const double* P,
+                                           const double* Y, double* rho,
+                                           double* h, double* s, double* cp);
     CANTERA_CAPI int thermo_getAtomicWeights(int n, size_t lenm, double* atw);
     CANTERA_CAPI int thermo_getMolecularWeights(int n, size_t lenm, double* mw);
     CANTERA_CAPI int thermo_getCharges(int n, size_t lenm, double* sc);
@@ -126,6 +131,12 @@ extern "C" {
     CANTERA_CAPI int kin_getCreationRates(int n, size_t len, double* cdot);
     CANTERA_CAPI int kin_getDestructionRates(int n, size_t len, double* ddot);
     CANTERA_CAPI int kin_getNetProductionRates(int n, size_t len, double* wdot);
+    //! Batched net production rates for an ensemble of (T, rho, Y) states
+    CANTERA_CAPI int kin_getNetProductionRatesBatch(int n, size_t nStates,
+                                                    const double* T,
+                                                    const double* rho,
+                                                    const double* Y,
+                                                    double* wdot);
     CANTERA_CAPI int kin_getSourceTerms(int n, size_t len, double* ydot);
     CANTERA_CAPI double kin_multiplier(int n, int i);
     CANTERA_CAPI int kin_getReactionString(int n, int i, int len, char* buf);
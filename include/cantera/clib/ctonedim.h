@@ -83,6 +83,15 @@ extern "C" {
     CANTERA_CAPI int sim1D_restore(int i, const char* fname, const char* id);
     CANTERA_CAPI int sim1D_writeStats(int i, int printTime);
     CANTERA_CAPI int sim1D_domainIndex(int i, const char* name);
+    //! Copy the whole solution block of one domain; layout point-major
+    //! (pointMajor=1) or component-major (pointMajor=0)
+    CANTERA_CAPI int sim1D_getSolution(int i, int idom, size_t len,
+                                       double* values, int pointMajor);
+    //! Overwrite the whole solution block of one domain
+    CANTERA_CAPI int sim1D_setSolution(int i, int idom, size_t len,
+                                       const double* values, int pointMajor);
+    //! Copy the grid of one domain; returns the number of points
+    CANTERA_CAPI int sim1D_getGrid(int i, int idom, size_t len, double* z);
     CANTERA_CAPI double sim1D_value(int i, int idom, int icomp, int localPoint);
     CANTERA_CAPI double sim1D_workValue(int i, int idom,
                                         int icomp, int localPoint);
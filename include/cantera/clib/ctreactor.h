@@ -41,6 +41,14 @@ extern "C" {
     CANTERA_CAPI int reactornet_setSensitivityTolerances(int i, double rtol, double atol);
     CANTERA_CAPI int reactornet_addreactor(int i, int n);
     CANTERA_CAPI int reactornet_advance(int i, double t);
+    //! Copy the full network state vector into *y* (length at least neq)
+    CANTERA_CAPI int reactornet_getState(int i, size_t len, double* y);
+    //! Advance an array of independent network handles to time t in one
+    //! call, using nThreads workers (0: serial)
+    CANTERA_CAPI int reactornet_advanceAll(size_t n, const int* handles,
+                                           double t, int nThreads);
+    //! Copy the recorder buffer into *data*; returns the number of values
+    CANTERA_CAPI int reactornet_recordedData(int i, size_t len, double* data);
     CANTERA_CAPI double reactornet_step(int i);
     CANTERA_CAPI double reactornet_time(int i);
     CANTERA_CAPI double reactornet_rtol(int i);
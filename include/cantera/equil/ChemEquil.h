@@ -103,6 +103,32 @@ public:
      */
     int equilibrate(ThermoPhase& s, const char* XY, int loglevel = 0);
 
+    //! Seed subsequent equilibrate() calls with the element potentials
+    //! converged by the previous call, skipping the estimation phase.
+    //! Effective when consecutive states are close, as in sequential
+    //! flamelet table generation; the first call after enabling still runs
+    //! the full estimate.
+    void setWarmStart(bool enable) {
+        m_warmStart = enable;
+        if (!enable) {
+            m_lambdaWarm.clear();
+        }
+    }
+
+    //! Element potentials (divided by RT) converged by the last successful
+    //! equilibrate() call; empty if no solution has been computed. Can be
+    //! used to chain solvers across objects via setElementPotentials().
+    const vector_fp& elementPotentials() const {
+        return m_lambdaWarm;
+    }
+
+    //! Install externally obtained element potentials (divided by RT) as
+    //! the warm start for the next equilibrate() call
+    //! @see setWarmStart()
+    void setElementPotentials(const vector_fp& lambda_RT) {
+        m_lambdaWarm = lambda_RT;
+    }
+
     /*!
      * Compute the equilibrium composition for two specified properties and the
      * specified element moles.
@@ -129,6 +155,13 @@ public:
     EquilOpt options;
 
 protected:
+    //! `true` if equilibrate() seeds from the previous solution
+    //! @see setWarmStart()
+    bool m_warmStart = false;
+
+    //! Element potentials of the last converged solve (divided by RT)
+    vector_fp m_lambdaWarm;
+
     //! Pointer to the ThermoPhase object used to initialize this object.
     /*!
      * This ThermoPhase object must be compatible with the ThermoPhase objects
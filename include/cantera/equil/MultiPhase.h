@@ -365,6 +365,56 @@ public:
                      double rtol=1e-9, int max_steps=50000, int max_iter=100,
                      int estimate_equil=0, int log_level=0);
 
+    //! Cached component basis of the Gibbs (MultiPhaseEquil) solver.
+    /*!
+     * Sequential solves on the same phase assembly reuse the previously
+     * converged component basis, reaction stoichiometry and linear
+     * dependency bookkeeping; MultiPhaseEquil validates the cache against
+     * its included species/element lists and the current composition
+     * before skipping the Gaussian elimination.
+     */
+    struct EquilBasisCache {
+        bool valid = false; //!< `true` if a converged basis is stored
+        std::vector<size_t> species; //!< included species (fingerprint)
+        std::vector<size_t> elements; //!< included elements (fingerprint)
+        std::vector<size_t> order; //!< species order, components first
+        DenseMatrix N; //!< reaction stoichiometry matrix
+        DenseMatrix A; //!< reduced atomic composition matrix
+        std::vector<bool> solnrxn; //!< solution-reaction flags
+    };
+
+    //! Access the cached Gibbs-solver component basis
+    //! @see EquilBasisCache
+    EquilBasisCache& equilBasisCache() {
+        return m_basisCache;
+    }
+
+    //! Equilibrate a batch of states in parallel.
+    /*!
+     * Each state is defined by a temperature, a pressure and a vector of
+     * species moles (global species indexing, as for setMoles()). The
+     * states are partitioned into contiguous chunks across worker threads;
+     * each worker operates on its own MultiPhase built from clones of the
+     * phases (sharing the immutable species data, see ThermoPhase::clone())
+     * with its own solver workspace, and each cell starts from the
+     * converged composition of the preceding cell of its chunk, which
+     * warm-starts smooth sweeps. Results overwrite the input moles array
+     * and, for non-TP property pairs, the temperature array.
+     *
+     * @param XY  property pair held constant, as for equilibrate()
+     * @param nStates  number of states
+     * @param[in,out] T  temperatures [K]; length nStates
+     * @param P  pressures [Pa]; length nStates
+     * @param[in,out] moles  species moles [kmol]; nStates blocks of
+     *     nSpecies() values
+     * @param nThreads  number of worker threads (0 or 1: serial)
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    void equilibrateBatch(const std::string& XY, size_t nStates, double* T,
+                          const double* P, double* moles, size_t nThreads=0);
+
     //! Set the temperature [K].
     /*!
      * @param T   value of the temperature (Kelvin)
@@ -571,6 +621,28 @@ private:
     vector_fp m_moles;
 
     //! Vector of the ThermoPhase pointers.
+    //! Cached Gibbs-solver component basis
+    //! @see equilBasisCache()
+    EquilBasisCache m_basisCache;
+
+    //! Cached per-phase element abundance contributions
+    //! @see calcElemAbundances()
+    mutable std::vector<vector_fp> m_abundCache;
+
+    //! Mole fractions of each phase at the last abundance update
+    mutable std::vector<vector_fp> m_abundCacheX;
+
+    //! Phase moles at the last abundance update
+    mutable vector_fp m_abundCacheMoles;
+
+    //! Mole fractions pushed to the phases by the last updatePhases()
+    //! @see updatePhases()
+    mutable vector_fp m_lastPhaseX;
+
+    //! Composition numbers of the phases after the last push, used to
+    //! detect external modifications of a phase
+    mutable vector_int m_lastPhaseStateNum;
+
     std::vector<ThermoPhase*> m_phase;
 
     //! Global Stoichiometric Coefficient array
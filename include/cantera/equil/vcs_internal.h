@@ -17,6 +17,16 @@ namespace Cantera
  */
 #define plogf writelogf
 
+//! Compile-time switch for the VCS diagnostic printing layer. When defined
+//! to 0 (for example with the compiler option -DCT_VCS_DEBUG=0), the debug
+//! print level collapses to a compile-time constant zero, so every
+//! `m_debug_print_lvl` guarded diagnostic block - including its argument
+//! expressions and string formatting - is eliminated as dead code. The
+//! default of 1 preserves the runtime-selectable diagnostics.
+#ifndef CT_VCS_DEBUG
+#define CT_VCS_DEBUG 1
+#endif
+
 //! Global hook for turning on and off time printing.
 /*!
  * Default is to allow printing. But, you can assign this to zero globally to
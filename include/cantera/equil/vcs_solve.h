@@ -22,6 +22,7 @@
 */
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/DenseMatrix.h"
 #include "cantera/equil/vcs_defs.h"
 #include "cantera/equil/vcs_internal.h"
 #include "cantera/base/Array.h"
@@ -978,6 +979,21 @@ private:
     vector_fp m_ss;
     vector_fp m_sa;
     vector_fp m_aw;
+
+    //! Reusable workspace for the per-phase mole change check, sized to the
+    //! number of phases
+    vector_fp m_wsPhaseChange;
+
+    //! Reusable component matrix workspace for vcs_basopt()
+    DenseMatrix m_wsBasisMatrix;
+
+    //! Reusable workspaces for vcs_phaseStabilityTest(), sized to the number
+    //! of species of the tested phase
+    vector_fp m_wsStab1;
+    vector_fp m_wsStab2;
+    vector_fp m_wsStab3;
+    vector_fp m_wsStab4;
+    vector_fp m_wsStab5;
     vector_fp m_wx;
 
 public:
@@ -1496,7 +1512,13 @@ public:
      *     * 6  Each decision in solve_TP gets a line per species in addition to 4
      *     * 10 Additionally Hessian matrix is printed out
      */
+#if CT_VCS_DEBUG
     int m_debug_print_lvl;
+#else
+    //! With the diagnostic layer compiled out, the print level is a
+    //! constant and all guarded blocks are eliminated as dead code
+    static constexpr int m_debug_print_lvl = 0;
+#endif
 
     //! printing level of timing information
     /*!
@@ -171,6 +171,11 @@ protected:
     std::string m_Ea_str = "Ea"; //!< The string for activation energy
     std::string m_E4_str = ""; //!< The string for an optional 4th parameter
     Units m_rate_units{0.}; //!< Reaction rate units
+
+    //! allow the batched evaluators to mirror parameters bit-exactly
+    friend class ArrheniusMultiRate;
+    friend class TwoTempPlasmaMultiRate;
+    template <class RateType> friend class FalloffMultiRate;
 };
 
 //! Arrhenius reaction rate type depends only on temperature
@@ -188,9 +193,10 @@ class ArrheniusRate : public ArrheniusBase
 public:
     using ArrheniusBase::ArrheniusBase; // inherit constructors
 
-    unique_ptr<MultiRateBase> newMultiRate() const override {
-        return unique_ptr<MultiRateBase>(new MultiRate<ArrheniusRate, ArrheniusData>);
-    }
+    //! Create rate evaluator; a batched evaluator storing rate parameters in
+    //! contiguous arrays is returned if enabled via
+    //! Cantera::use_batched_rate_evaluators().
+    unique_ptr<MultiRateBase> newMultiRate() const override;
 
     virtual const std::string type() const override {
         return "Arrhenius";
@@ -224,6 +230,80 @@ public:
     }
 };
 
+
+//! A rate evaluator for ArrheniusRate using structure-of-arrays storage
+/*!
+ * Rate parameters of all managed reactions are mirrored in contiguous arrays,
+ * so that getRateConstants() reduces to two tight loops over plain `double`
+ * arrays: accumulation of the exponents \f$ b_i \log T - E_{a,i}/RT \f$,
+ * which compilers can vectorize, followed by exponentiation. Results are
+ * identical to those of the generic per-reaction evaluator; only the
+ * evaluation order differs. This evaluator is selected by
+ * ArrheniusRate::newMultiRate() if Cantera::use_batched_rate_evaluators()
+ * is enabled.
+ *
+ * @ingroup arrheniusGroup
+ */
+class ArrheniusMultiRate : public MultiRate<ArrheniusRate, ArrheniusData>
+{
+public:
+    virtual void add(size_t rxn_index, ReactionRate& rate) override {
+        MultiRate<ArrheniusRate, ArrheniusData>::add(rxn_index, rate);
+        _appendParameters(m_rxn_rates.back());
+    }
+
+    virtual bool replace(size_t rxn_index, ReactionRate& rate) override {
+        bool found = MultiRate<ArrheniusRate, ArrheniusData>::replace(rxn_index, rate);
+        _rebuildParameters();
+        return found;
+    }
+
+    virtual void getRateConstants(double* kf) override {
+        double logT = m_shared.logT;
+        double recipT = m_shared.recipT;
+        size_t n = m_batchA.size();
+        // separate passes keep each loop free of function calls, so the
+        // exponent accumulation can be vectorized by the compiler
+        for (size_t i = 0; i < n; i++) {
+            m_batchWork[i] = m_batchB[i] * logT - m_batchEaR[i] * recipT;
+        }
+        for (size_t i = 0; i < n; i++) {
+            m_batchWork[i] = m_batchA[i] * std::exp(m_batchWork[i]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            kf[m_batchIndex[i]] = m_batchWork[i];
+        }
+    }
+
+protected:
+    //! Append parameters of a newly added rate to the contiguous arrays
+    void _appendParameters(const std::pair<size_t, ArrheniusRate>& rxn) {
+        m_batchIndex.push_back(rxn.first);
+        m_batchA.push_back(rxn.second.m_A);
+        m_batchB.push_back(rxn.second.m_b);
+        m_batchEaR.push_back(rxn.second.m_Ea_R);
+        m_batchWork.push_back(0.);
+    }
+
+    //! Mirror parameters of all managed rates into contiguous arrays
+    void _rebuildParameters() {
+        m_batchIndex.clear();
+        m_batchA.clear();
+        m_batchB.clear();
+        m_batchEaR.clear();
+        m_batchWork.clear();
+        for (const auto& rxn : m_rxn_rates) {
+            _appendParameters(rxn);
+        }
+    }
+
+    std::vector<size_t> m_batchIndex; //!< Reaction indices of managed rates
+    vector_fp m_batchA; //!< Pre-exponential factors
+    vector_fp m_batchB; //!< Temperature exponents
+    vector_fp m_batchEaR; //!< Activation energies (in temperature units)
+    vector_fp m_batchWork; //!< Work array holding exponents / rate constants
+};
+
 }
 
 #endif
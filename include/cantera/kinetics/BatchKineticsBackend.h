@@ -0,0 +1,67 @@
+/**
+ * @file BatchKineticsBackend.h
+ *   Backend interface for evaluating chemistry over large batches of
+ *   thermodynamic states, with pluggable device (GPU) implementations.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BATCHKINETICSBACKEND_H
+#define CT_BATCHKINETICSBACKEND_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class GasKinetics;
+
+//! Interface for backends evaluating net production rates over a batch of
+//! thermodynamic states.
+/*!
+ * A backend is attached to one mechanism: initialize() uploads (or mirrors)
+ * the constant mechanism tables once, and evaluate() processes a batch of
+ * (T, rho, Y) states per call. The host-side reference implementation
+ * (HostBatchKineticsBackend) streams the batch through the threaded
+ * ensemble evaluation; an accelerator implementation provides the same
+ * contract with device-resident tables and one kernel launch per batch,
+ * and registers itself through newBatchKineticsBackend().
+ *
+ * @warning  This interface is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ */
+class BatchKineticsBackend
+{
+public:
+    virtual ~BatchKineticsBackend() {}
+
+    //! Mirror the constant mechanism data of *kin* into backend storage.
+    //! Must be called before evaluate() and again after the mechanism
+    //! changes.
+    virtual void initialize(GasKinetics& kin) = 0;
+
+    //! Evaluate net production rates for a batch of states.
+    /*!
+     * @param nStates  number of states
+     * @param T  temperatures [K]; length nStates
+     * @param rho  mass densities [kg/m^3]; length nStates
+     * @param Y  mass fractions; nStates blocks of nSpecies values
+     * @param[out] wdot  net production rates [kmol/m^3/s]; nStates blocks
+     */
+    virtual void evaluate(size_t nStates, const double* T, const double* rho,
+                          const double* Y, double* wdot) = 0;
+
+    //! Short identifier of the backend implementation
+    virtual std::string backendType() const = 0;
+};
+
+//! Create the best available batch evaluation backend: a device backend
+//! when the library was built with accelerator support (CT_ENABLE_CUDA)
+//! and a device is present, otherwise the threaded host backend.
+//! @param nThreads  worker threads used by the host backend
+shared_ptr<BatchKineticsBackend> newBatchKineticsBackend(size_t nThreads=0);
+
+}
+
+#endif
@@ -90,9 +90,10 @@ public:
         setParameters(node, rate_units);
     }
 
-    unique_ptr<MultiRateBase> newMultiRate() const override {
-        return unique_ptr<MultiRateBase>(new MultiRate<BlowersMaselRate, BlowersMaselData>);
-    }
+    //! Create rate evaluator; a batched evaluator storing rate parameters
+    //! in contiguous arrays is returned if enabled via
+    //! Cantera::use_batched_rate_evaluators().
+    unique_ptr<MultiRateBase> newMultiRate() const override;
 
     virtual const std::string type() const override {
         return "Blowers-Masel";
@@ -184,6 +185,75 @@ protected:
     std::vector<std::pair<size_t, double>> m_stoich_coeffs;
 
     double m_deltaH_R; //!< enthalpy change of reaction (in temperature units)
+
+    //! allow the batched evaluator to reuse the per-reaction enthalpy data
+    friend class BlowersMaselMultiRate;
+};
+
+
+//! A rate evaluator for BlowersMaselRate using structure-of-arrays storage
+/*!
+ * The pre-exponential factors and temperature exponents of all managed
+ * reactions are mirrored in contiguous arrays. The enthalpy snapshot is
+ * already shared per state through BlowersMaselData, and the per-reaction
+ * reaction enthalpies are refreshed by updateFromStruct(); the batched
+ * kernel then evaluates the effective activation energies and all rate
+ * constants in exponent-accumulation and exponentiation sweeps. Selected
+ * by BlowersMaselRate::newMultiRate() if
+ * Cantera::use_batched_rate_evaluators() is enabled.
+ */
+class BlowersMaselMultiRate
+    : public MultiRate<BlowersMaselRate, BlowersMaselData>
+{
+public:
+    virtual void add(size_t rxn_index, ReactionRate& rate) override {
+        MultiRate<BlowersMaselRate, BlowersMaselData>::add(rxn_index, rate);
+        _rebuildParameters();
+    }
+
+    virtual bool replace(size_t rxn_index, ReactionRate& rate) override {
+        bool found =
+            MultiRate<BlowersMaselRate, BlowersMaselData>::replace(rxn_index, rate);
+        _rebuildParameters();
+        return found;
+    }
+
+    virtual void getRateConstants(double* kf) override {
+        double logT = m_shared.logT;
+        double recipT = m_shared.recipT;
+        size_t n = m_batchA.size();
+        for (size_t i = 0; i < n; i++) {
+            const BlowersMaselRate& rate = m_rxn_rates[i].second;
+            double Ea_R = rate.effectiveActivationEnergy_R(rate.m_deltaH_R);
+            m_batchWork[i] = m_batchB[i] * logT - Ea_R * recipT;
+        }
+        for (size_t i = 0; i < n; i++) {
+            m_batchWork[i] = m_batchA[i] * std::exp(m_batchWork[i]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            kf[m_batchIndex[i]] = m_batchWork[i];
+        }
+    }
+
+protected:
+    //! Mirror parameters of all managed rates into contiguous arrays
+    void _rebuildParameters() {
+        size_t n = m_rxn_rates.size();
+        m_batchIndex.resize(n);
+        m_batchA.resize(n);
+        m_batchB.resize(n);
+        m_batchWork.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            m_batchIndex[i] = m_rxn_rates[i].first;
+            m_batchA[i] = m_rxn_rates[i].second.m_A;
+            m_batchB[i] = m_rxn_rates[i].second.m_b;
+        }
+    }
+
+    std::vector<size_t> m_batchIndex; //!< Reaction indices of managed rates
+    vector_fp m_batchA; //!< Pre-exponential factors
+    vector_fp m_batchB; //!< Temperature exponents
+    vector_fp m_batchWork; //!< Work array holding exponents / rate constants
 };
 
 }
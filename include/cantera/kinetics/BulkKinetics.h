@@ -27,6 +27,7 @@ public:
     virtual bool isReversible(size_t i);
 
     virtual void getDeltaGibbs(doublereal* deltaG);
+    virtual void getDeltaAll(double* deltaH, double* deltaS, double* deltaG);
     virtual void getDeltaEnthalpy(doublereal* deltaH);
     virtual void getDeltaEntropy(doublereal* deltaS);
 
@@ -42,12 +43,26 @@ public:
 
     virtual void resizeSpecies();
 
+    //! @copydoc Kinetics::setMultiplier
+    //! Setting a multiplier of exactly zero additionally deactivates the
+    //! reaction in its rate evaluator, so dormant reactions are skipped
+    //! instead of being evaluated and zeroed (batched evaluators may still
+    //! evaluate them; the result is zeroed either way).
     virtual void setMultiplier(size_t i, double f);
     virtual void invalidateCache();
 
     void addThirdBody(shared_ptr<Reaction> r);
 
 protected:
+    //! Scratch vectors for the fused delta-property evaluation
+    //! @see getDeltaAll()
+    vector_fp m_sbuf_h;
+    vector_fp m_sbuf_s;
+
+    //! Number of reactions whose multiplier differs from one; the
+    //! perturbation pass over the rate coefficients is skipped when zero
+    size_t m_nPerturbed = 0;
+
     //! Vector of rate handlers
     std::vector<unique_ptr<MultiRateBase>> m_bulk_rates;
     std::map<std::string, size_t> m_bulk_types; //!< Mapping of rate handlers
@@ -86,7 +86,7 @@ protected:
  * therefore extrapolation of rates outside the range of temperatures and
  * pressures for which they are defined is strongly discouraged.
  */
-class ChebyshevRate final : public ReactionRate
+class ChebyshevRate : public ReactionRate
 {
 public:
     //! Default constructor.
@@ -111,10 +111,10 @@ public:
         setParameters(node, rate_units);
     }
 
-    unique_ptr<MultiRateBase> newMultiRate() const {
-        return unique_ptr<MultiRateBase>(
-            new MultiRate<ChebyshevRate, ChebyshevData>);
-    }
+    //! Create rate evaluator; a batched evaluator processing the temperature
+    //! recurrences of all reactions in lockstep is returned if enabled via
+    //! Cantera::use_batched_rate_evaluators().
+    unique_ptr<MultiRateBase> newMultiRate() const;
 
     const std::string type() const { return "Chebyshev"; }
 
@@ -239,6 +239,115 @@ protected:
     vector_fp dotProd_; //!< dot product of coeffs with the reduced pressure polynomial
 
     Units m_rate_units; //!< Reaction rate units
+
+    //! allow the batched evaluator to mirror per-reaction data
+    friend class ChebyshevMultiRate;
+};
+
+
+//! A rate evaluator for ChebyshevRate using structure-of-arrays storage
+/*!
+ * The per-reaction dot products of the coefficient matrices with the reduced
+ * pressure polynomial (refreshed by ChebyshevRate::updateFromStruct() when
+ * the pressure changes) are mirrored in a column-major array padded to the
+ * largest temperature order of the mechanism. getRateConstants() then runs
+ * the Clenshaw-style temperature recurrence for all reactions in lockstep,
+ * so the inner loops are over contiguous arrays and vectorize across
+ * reactions. Padding coefficients are zero, so results are identical to the
+ * per-reaction evaluation. This evaluator is selected by
+ * ChebyshevRate::newMultiRate() if Cantera::use_batched_rate_evaluators()
+ * is enabled.
+ */
+class ChebyshevMultiRate : public MultiRate<ChebyshevRate, ChebyshevData>
+{
+public:
+    virtual void add(size_t rxn_index, ReactionRate& rate) override {
+        MultiRate<ChebyshevRate, ChebyshevData>::add(rxn_index, rate);
+        _rebuildParameters();
+    }
+
+    virtual bool replace(size_t rxn_index, ReactionRate& rate) override {
+        bool found = MultiRate<ChebyshevRate, ChebyshevData>::replace(rxn_index, rate);
+        _rebuildParameters();
+        return found;
+    }
+
+    virtual void getRateConstants(double* kf) override {
+        size_t n = m_rxn_rates.size();
+        if (!n || !m_batchRows) {
+            return;
+        }
+        if (m_shared.log10P != m_batchLog10P) {
+            // per-reaction pressure polynomials were refreshed by
+            // updateFromStruct(); mirror the new dot products
+            m_batchLog10P = m_shared.log10P;
+            _gatherDotProd();
+        }
+        double recipT = m_shared.recipT;
+        for (size_t i = 0; i < n; i++) {
+            m_Tr[i] = (2 * recipT + m_trNum[i]) * m_trDen[i];
+            m_Cnm1[i] = m_Tr[i];
+            m_Cn[i] = 1;
+            m_logk[i] = m_dotProd[i];
+        }
+        for (size_t j = 1; j < m_batchRows; j++) {
+            const double* dot = m_dotProd.data() + j * n;
+            for (size_t i = 0; i < n; i++) {
+                double Cnp1 = 2 * m_Tr[i] * m_Cn[i] - m_Cnm1[i];
+                m_logk[i] += Cnp1 * dot[i];
+                m_Cnm1[i] = m_Cn[i];
+                m_Cn[i] = Cnp1;
+            }
+        }
+        for (size_t i = 0; i < n; i++) {
+            kf[m_rxn_rates[i].first] = std::pow(10, m_logk[i]);
+        }
+    }
+
+protected:
+    //! Update batch storage layout after adding or replacing rates
+    void _rebuildParameters() {
+        size_t n = m_rxn_rates.size();
+        m_batchRows = 0;
+        for (const auto& rxn : m_rxn_rates) {
+            m_batchRows = std::max(m_batchRows, rxn.second.m_coeffs.nRows());
+        }
+        m_trNum.resize(n);
+        m_trDen.resize(n);
+        m_dotProd.assign(m_batchRows * n, 0.);
+        m_Tr.resize(n);
+        m_Cn.resize(n);
+        m_Cnm1.resize(n);
+        m_logk.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            m_trNum[i] = m_rxn_rates[i].second.TrNum_;
+            m_trDen[i] = m_rxn_rates[i].second.TrDen_;
+        }
+        // force re-mirroring of the pressure-dependent dot products
+        m_batchLog10P = NAN;
+    }
+
+    //! Mirror per-reaction pressure polynomial dot products (column-major)
+    void _gatherDotProd() {
+        size_t n = m_rxn_rates.size();
+        for (size_t i = 0; i < n; i++) {
+            const vector_fp& dot = m_rxn_rates[i].second.dotProd_;
+            size_t rows = m_rxn_rates[i].second.m_coeffs.nRows();
+            for (size_t j = 0; j < rows; j++) {
+                m_dotProd[j * n + i] = dot[j];
+            }
+        }
+    }
+
+    size_t m_batchRows = 0; //!< Largest temperature order among managed rates
+    double m_batchLog10P = NAN; //!< log10(P) at which m_dotProd was mirrored
+    vector_fp m_trNum; //!< Numerator terms of the reduced temperatures
+    vector_fp m_trDen; //!< Denominator terms of the reduced temperatures
+    vector_fp m_dotProd; //!< Column-major padded pressure polynomial products
+    vector_fp m_Tr; //!< Work array of reduced temperatures
+    vector_fp m_Cn; //!< Work array for the Clenshaw recurrence
+    vector_fp m_Cnm1; //!< Work array for the Clenshaw recurrence
+    vector_fp m_logk; //!< Work array of log10 rate constants
 };
 
 }
@@ -16,6 +16,7 @@
 #include "cantera/kinetics/Arrhenius.h"
 #include "ReactionRate.h"
 #include "MultiRate.h"
+#include "cantera/numerics/Func1.h"
 
 namespace Cantera
 {
@@ -69,6 +70,10 @@ public:
 
 protected:
     shared_ptr<Func1> m_ratefunc;
+
+    //! Flattened evaluator for #m_ratefunc
+    //! @see setRateFunction()
+    Func1Tape m_tape;
 };
 
 
@@ -272,6 +272,128 @@ protected:
     double m_rc_low; //!< Evaluated reaction rate in the low-pressure limit
     double m_rc_high; //!< Evaluated reaction rate in the high-pressure limit
     vector_fp m_work; //!< Work vector
+
+    //! allow the batched evaluator to mirror parameters and reuse the
+    //! per-reaction work arrays
+    template <class RateType> friend class FalloffMultiRate;
+};
+
+
+//! A rate evaluator for falloff rates using structure-of-arrays storage
+/*!
+ * The Arrhenius parameters of the low- and high-pressure limits of all
+ * managed reactions are mirrored in contiguous arrays, so that both limiting
+ * rate constants are evaluated in tight, auto-vectorizable sweeps before the
+ * reduced pressure and the family-specific falloff function F are applied per
+ * reaction. The temperature-dependent terms of F cached in the per-reaction
+ * work arrays are only refreshed when the temperature changes, rather than on
+ * every evaluation. Results are identical to those of the generic evaluator.
+ * This evaluator is selected by the newMultiRate() implementations of the
+ * falloff parameterizations if Cantera::use_batched_rate_evaluators() is
+ * enabled.
+ *
+ * @ingroup falloffGroup
+ */
+template <class RateType>
+class FalloffMultiRate : public MultiRate<RateType, FalloffData>
+{
+    using MultiRate<RateType, FalloffData>::m_rxn_rates;
+    using MultiRate<RateType, FalloffData>::m_shared;
+
+public:
+    virtual void add(size_t rxn_index, ReactionRate& rate) override {
+        MultiRate<RateType, FalloffData>::add(rxn_index, rate);
+        _rebuildParameters();
+    }
+
+    virtual bool replace(size_t rxn_index, ReactionRate& rate) override {
+        bool found = MultiRate<RateType, FalloffData>::replace(rxn_index, rate);
+        _rebuildParameters();
+        return found;
+    }
+
+    virtual void getRateConstants(double* kf) override {
+        size_t n = m_rxn_rates.size();
+        double logT = m_shared.logT;
+        double recipT = m_shared.recipT;
+
+        // batched evaluation of the low- and high-pressure Arrhenius limits
+        for (size_t i = 0; i < n; i++) {
+            m_rcLow[i] = m_bLow[i] * logT - m_EaLow[i] * recipT;
+            m_rcHigh[i] = m_bHigh[i] * logT - m_EaHigh[i] * recipT;
+        }
+        for (size_t i = 0; i < n; i++) {
+            m_rcLow[i] = m_ALow[i] * std::exp(m_rcLow[i]);
+            m_rcHigh[i] = m_AHigh[i] * std::exp(m_rcHigh[i]);
+        }
+
+        // refresh cached temperature-dependent falloff terms only when the
+        // temperature changed
+        if (m_shared.temperature != m_batchT) {
+            m_batchT = m_shared.temperature;
+            for (auto& rxn : m_rxn_rates) {
+                rxn.second.updateTemp(m_batchT, rxn.second.m_work.data());
+            }
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            auto& rxn = m_rxn_rates[i];
+            double conc3b;
+            if (m_shared.ready) {
+                conc3b = m_shared.conc_3b[rxn.first];
+            } else {
+                conc3b = m_shared.conc_3b[0];
+            }
+            double pr = conc3b * m_rcLow[i] / (m_rcHigh[i] + SmallNumber);
+            double f = rxn.second.F(pr, rxn.second.m_work.data()) / (1.0 + pr);
+            if (m_chemAct[i]) {
+                // 1 / (1 + Pr) * F
+                kf[rxn.first] = f * m_rcLow[i];
+            } else {
+                // Pr / (1 + Pr) * F
+                kf[rxn.first] = pr * f * m_rcHigh[i];
+            }
+        }
+    }
+
+protected:
+    //! Mirror the limiting Arrhenius parameters of all managed rates into
+    //! contiguous arrays
+    void _rebuildParameters() {
+        size_t n = m_rxn_rates.size();
+        m_ALow.resize(n);
+        m_bLow.resize(n);
+        m_EaLow.resize(n);
+        m_AHigh.resize(n);
+        m_bHigh.resize(n);
+        m_EaHigh.resize(n);
+        m_rcLow.resize(n);
+        m_rcHigh.resize(n);
+        m_chemAct.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            const RateType& rate = m_rxn_rates[i].second;
+            m_ALow[i] = rate.m_lowRate.m_A;
+            m_bLow[i] = rate.m_lowRate.m_b;
+            m_EaLow[i] = rate.m_lowRate.m_Ea_R;
+            m_AHigh[i] = rate.m_highRate.m_A;
+            m_bHigh[i] = rate.m_highRate.m_b;
+            m_EaHigh[i] = rate.m_highRate.m_Ea_R;
+            m_chemAct[i] = rate.m_chemicallyActivated;
+        }
+        // force a refresh of the cached temperature-dependent falloff terms
+        m_batchT = NAN;
+    }
+
+    double m_batchT = NAN; //!< Temperature of the cached falloff terms
+    vector_fp m_ALow; //!< Low-pressure pre-exponential factors
+    vector_fp m_bLow; //!< Low-pressure temperature exponents
+    vector_fp m_EaLow; //!< Low-pressure activation energies (temperature units)
+    vector_fp m_AHigh; //!< High-pressure pre-exponential factors
+    vector_fp m_bHigh; //!< High-pressure temperature exponents
+    vector_fp m_EaHigh; //!< High-pressure activation energies (temperature units)
+    vector_fp m_rcLow; //!< Work array of low-pressure limit rate constants
+    vector_fp m_rcHigh; //!< Work array of high-pressure limit rate constants
+    std::vector<bool> m_chemAct; //!< Chemically-activated flags
 };
 
 
@@ -301,7 +423,10 @@ public:
         setFalloffCoeffs(c);
     }
 
-    unique_ptr<MultiRateBase> newMultiRate() const override{
+    unique_ptr<MultiRateBase> newMultiRate() const override {
+        if (batched_rate_evaluators_used()) {
+            return unique_ptr<MultiRateBase>(new FalloffMultiRate<LindemannRate>);
+        }
         return unique_ptr<MultiRateBase>(
             new MultiRate<LindemannRate, FalloffData>);
     }
@@ -363,7 +488,11 @@ public:
     }
 
     unique_ptr<MultiRateBase> newMultiRate() const override {
-        return unique_ptr<MultiRateBase>(new MultiRate<TroeRate, FalloffData>);
+        if (batched_rate_evaluators_used()) {
+            return unique_ptr<MultiRateBase>(new FalloffMultiRate<TroeRate>);
+        }
+        return unique_ptr<MultiRateBase>(
+            new MultiRate<TroeRate, FalloffData>);
     }
 
     //! Set coefficients used by parameterization
@@ -466,7 +595,11 @@ public:
     }
 
     unique_ptr<MultiRateBase> newMultiRate() const override {
-        return unique_ptr<MultiRateBase>(new MultiRate<SriRate, FalloffData>);
+        if (batched_rate_evaluators_used()) {
+            return unique_ptr<MultiRateBase>(new FalloffMultiRate<SriRate>);
+        }
+        return unique_ptr<MultiRateBase>(
+            new MultiRate<SriRate, FalloffData>);
     }
 
     //! Set coefficients used by parameterization
@@ -577,7 +710,11 @@ public:
     }
 
     unique_ptr<MultiRateBase> newMultiRate() const override {
-        return unique_ptr<MultiRateBase>(new MultiRate<TsangRate, FalloffData>);
+        if (batched_rate_evaluators_used()) {
+            return unique_ptr<MultiRateBase>(new FalloffMultiRate<TsangRate>);
+        }
+        return unique_ptr<MultiRateBase>(
+            new MultiRate<TsangRate, FalloffData>);
     }
 
     //! Set coefficients used by parameterization
@@ -60,6 +60,68 @@ public:
     virtual void resizeReactions();
     void updateROP();
 
+    virtual void getRevRateConstants(double* krev,
+                                     bool doIrreversible=false);
+
+    using Kinetics::getEquilibriumConstants;
+
+    //! Batched evaluation of the equilibrium constants over an array of
+    //! temperatures, for table generation; one thermodynamic update per
+    //! temperature serves all reactions. The thermodynamic state of the
+    //! phase is modified. Output is nTemps blocks of nReactions() values.
+    void getEquilibriumConstants(size_t nTemps, const double* T, double* kc);
+
+    //! Enable tabulated rate-constant evaluation over a temperature window.
+    /*!
+     * Dense log(k) versus 1/T tables are built for all reactions at the
+     * current pressure and composition (nodes uniform in 1/T), and
+     * update_rates_T() evaluates by vectorized interpolation while the
+     * state stays inside the window at the frozen pressure; outside it,
+     * or at a different pressure, exact evaluation is used. Accuracy is
+     * controlled by the node count. The interpolated constants reflect
+     * the third-body/falloff concentrations of the build state, so the
+     * mode is intended for fixed-pressure studies where those vary
+     * weakly; composition-driven changes to pressure-dependent rates are
+     * frozen at the build state.
+     *
+     * @param Tmin  lower edge of the temperature window [K]
+     * @param Tmax  upper edge of the temperature window [K]
+     * @param nPoints  number of table nodes (at least 2)
+     */
+    void enableRateTables(double Tmin, double Tmax, size_t nPoints=200);
+
+    //! Disable tabulated rate-constant evaluation
+    void disableRateTables() {
+        m_rateTabOn = false;
+    }
+
+    using Kinetics::getNetProductionRates;
+
+    //! Batched evaluation of species net production rates for an ensemble of
+    //! thermodynamic states.
+    /*!
+     * Each state is defined by its temperature, density and mass fraction
+     * array; rates for all states are evaluated in one pass. States are
+     * processed in ascending temperature order, so that states sharing a
+     * temperature reuse the cached temperature-dependent rate updates; the
+     * output ordering matches the input ordering. The thermodynamic state of
+     * the phase is modified by this method.
+     *
+     * @param nStates  number of thermodynamic states
+     * @param T  array of temperatures [K]; length nStates
+     * @param density  array of mass densities [kg/m^3]; length nStates
+     * @param Y  array of mass fractions; length nStates * nTotalSpecies(),
+     *     with the fractions of each state stored contiguously
+     * @param[out] wdot  output array of net production rates [kmol/m^3/s];
+     *     length nStates * nTotalSpecies(), ordered like `Y`
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    void getNetProductionRates(size_t nStates, const double* T,
+                               const double* density, const double* Y,
+                               double* wdot);
+
     virtual void getDerivativeSettings(AnyMap& settings) const;
     virtual void setDerivativeSettings(const AnyMap& settings);
     virtual void getFwdRateConstants_ddT(double* dkfwd);
@@ -77,6 +139,9 @@ public:
     virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddX();
     virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddX();
     virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddX();
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddCi();
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddCi();
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddCi();
 
     //! Update temperature-dependent portions of reaction rates and falloff
     //! functions.
@@ -102,6 +167,13 @@ protected:
     //! Multiply rate with third-body collider concentrations
     void processThirdBodies(double* rop);
 
+    //! Update the reciprocal equilibrium constants if they are out of date
+    //! with respect to the temperature. The update is deferred from
+    //! update_rates_T() to the first consumer of m_rkcn, so state updates
+    //! that only evaluate forward quantities (or mechanisms without
+    //! reversible reactions) skip the exp-heavy updateKc() entirely.
+    void checkKc();
+
     //! Multiply rate with inverse equilibrium constant
     void processEquilibriumConstants(double* rop);
 
@@ -133,8 +205,10 @@ protected:
     //! Process mole fraction derivative
     //! @param stoich  stoichiometry manager
     //! @param in  rate expression used for the derivative calculation
+    //! @param ddX  `true`: derivatives with respect to mole fractions;
+    //!     `false`: derivatives with respect to species concentrations
     Eigen::SparseMatrix<double> process_ddX(StoichManagerN& stoich,
-                                            const vector_fp& in);
+                                            const vector_fp& in, bool ddX=true);
 
     //! Helper function ensuring that all rate derivatives can be calculated
     //! @param name  method name used for error output
@@ -150,6 +224,33 @@ protected:
 
     doublereal m_pres; //!< Last pressure at which rates were evaluated
 
+    //! Boolean flag indicating whether the reciprocal equilibrium constants
+    //! in m_rkcn are up to date
+    //! @see checkKc()
+    bool m_kc_ok;
+
+    //! Equilibrium constants cached by getEquilibriumConstants() and the
+    //! state at which they were evaluated
+    vector_fp m_kcEq;
+    double m_kcEqTemp = -1.0;
+    double m_kcEqLogC = 0.0;
+
+    //! Tabulated rate-constant mode
+    //! @see enableRateTables()
+    bool m_rateTabOn = false;
+    double m_rateTabTmin = 0.0; //!< Window lower edge [K]
+    double m_rateTabTmax = 0.0; //!< Window upper edge [K]
+    double m_rateTabPres = -1.0; //!< Pressure the tables were built at [Pa]
+    vector_fp m_rateTabX; //!< Table nodes in 1/T
+    vector_fp m_rateTabLogK; //!< log(k) tables; one node row per entry
+
+    //! Composition number, temperature and density at the last
+    //! concentration update
+    //! @see update_rates_C()
+    int m_stateNumC = -1;
+    double m_tempC = -1.0;
+    double m_rhoC = -1.0;
+
     //! @}
 
     //! Buffers for partial rop results with length nReactions()
@@ -308,6 +308,32 @@ private:
     //! and underlying routines.
     int m_ioFlag;
 };
+
+//! Advance a set of independent surface-chemistry integrators concurrently.
+/*!
+ * Each integrator owns its surface mechanism instance and CVODES context
+ * (typically built over cloned kinetics sharing one immutable mechanism),
+ * so the faces of a discretized washcoat can be advanced in parallel.
+ * Integrators are dispatched through a shared counter, so threads finishing
+ * early immediately take over the remaining (possibly stiffer) faces. When
+ * *warmStart* is `true`, each face is first brought to its pseudo
+ * steady-state coverages via solvePseudoSteadyStateProblem(), which is the
+ * standard warm start for transient washcoat integrations. The first error
+ * raised by any face is re-thrown after all threads finish.
+ *
+ * @param solvers  independent surface-chemistry integrators
+ * @param t0  start time [s]
+ * @param t1  end time [s]
+ * @param nThreads  number of worker threads (0 or 1: serial)
+ * @param warmStart  solve the pseudo steady-state problem per face first
+ *
+ * @warning  This function is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ */
+void advanceSurfChemBatch(std::vector<shared_ptr<ImplicitSurfChem>>& solvers,
+                          double t0, double t1, size_t nThreads=0,
+                          bool warmStart=false);
+
 }
 
 #endif
@@ -377,6 +377,14 @@ protected:
      */
     vector_fp m_phi;
 
+    //! Per-phase composition numbers, temperatures and densities at the
+    //! last concentration update, used to skip redundant updates during
+    //! potential-only iterations
+    //! @see _update_rates_C()
+    vector_int m_lastStateNumC;
+    vector_fp m_lastTempC;
+    vector_fp m_lastDensC;
+
     //! Pointer to the single surface phase
     SurfPhase* m_surf;
 
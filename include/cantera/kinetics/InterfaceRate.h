@@ -16,6 +16,9 @@
 namespace Cantera
 {
 
+//! ln(10), used by the coverage modifications of interface rates
+const double CoverageLn10 = 2.302585092994045684;
+
 class AnyMap;
 
 /**
@@ -237,7 +240,10 @@ protected:
     double m_deltaPotential_RT; //!< Normalized electric potential energy change
     double m_deltaGibbs0_RT; //!< Normalized standard state Gibbs free energy change
     double m_prodStandardConcentrations; //!< Products of standard concentrations
-    std::map<size_t, size_t> m_indices; //!< Map holding indices of coverage species
+    //! Pairs of (coverage entry, species index) for the coverage species,
+    //! in entry order; flat storage keeps the per-update accumulation loops
+    //! over contiguous memory
+    std::vector<std::pair<size_t, size_t>> m_indices;
     std::vector<std::string> m_cov; //!< Vector holding names of coverage species
     vector_fp m_ac; //!< Vector holding coverage-specific exponential dependence
     vector_fp m_ec; //!< Vector holding coverage-specific activation energy dependence
@@ -407,7 +413,7 @@ public:
     //! @param shared_data  data shared by all reactions of a given type
     double evalFromStruct(const DataType& shared_data) const {
         double out = RateType::evalRate(shared_data.logT, shared_data.recipT) *
-            std::exp(std::log(10.0) * m_acov - m_ecov * shared_data.recipT + m_mcov);
+            std::exp(CoverageLn10 * m_acov - m_ecov * shared_data.recipT + m_mcov);
         if (m_chargeTransfer) {
             out *= voltageCorrection();
         }
@@ -423,7 +429,7 @@ public:
 
     virtual double preExponentialFactor() const override {
         return RateType::preExponentialFactor() *
-            std::exp(std::log(10.0) * m_acov + m_mcov);
+            std::exp(CoverageLn10 * m_acov + m_mcov);
     }
 
     virtual double activationEnergy() const override {
@@ -545,7 +551,7 @@ public:
     //! @param shared_data  data shared by all reactions of a given type
     double evalFromStruct(const DataType& shared_data) const {
         double out = RateType::evalRate(shared_data.logT, shared_data.recipT) *
-            std::exp(std::log(10.0) * m_acov - m_ecov * shared_data.recipT + m_mcov);
+            std::exp(CoverageLn10 * m_acov - m_ecov * shared_data.recipT + m_mcov);
         if (m_chargeTransfer) {
             // @todo  the physical interpretation of a 'sticking' charge transfer
             //      reaction remains to be resolved.
@@ -566,7 +572,7 @@ public:
 
     virtual double preExponentialFactor() const override {
         return RateType::preExponentialFactor() *
-            std::exp(std::log(10.0) * m_acov + m_mcov);
+            std::exp(CoverageLn10 * m_acov + m_mcov);
     }
 
     virtual double activationEnergy() const override {
@@ -125,6 +125,25 @@ public:
     Kinetics(const Kinetics&) = delete;
     Kinetics& operator=(const Kinetics&)= delete;
 
+    //! Create a new Kinetics manager of the same type, sharing the immutable
+    //! mechanism description of this object.
+    /*!
+     * The clone is attached to the supplied phases (typically created by
+     * ThermoPhase::clone()), which must match the phases of this object in
+     * number, order and name. The Reaction objects are shared with the clone
+     * rather than copied, so no input data is re-parsed; the stoichiometry
+     * managers and rate evaluators are rebuilt from the shared reactions,
+     * and all scratch arrays are per-clone. The caller is responsible for
+     * keeping the phase objects alive for the lifetime of the clone.
+     *
+     * @param phases  phase objects used by the cloned kinetics manager
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual shared_ptr<Kinetics> clone(
+        const std::vector<shared_ptr<ThermoPhase>>& phases) const;
+
     //! Identifies the Kinetics manager type.
     //! Each class derived from Kinetics should override this method to return
     //! a meaningful identifier.
@@ -469,6 +488,26 @@ public:
         throw NotImplementedError("Kinetics::getDeltaEntropy");
     }
 
+    //! Fused evaluation of the reaction delta properties.
+    /*!
+     * Computes any subset of the enthalpy, entropy and Gibbs energy
+     * changes of reaction from one fused fetch of the species partial
+     * molar properties (see ThermoPhase::getPartialMolarAll()) and one
+     * stoichiometric contraction per requested quantity; outputs that are
+     * not needed may be null. Flux-analysis tooling needing all three per
+     * snapshot thus gathers the species properties once.
+     *
+     * @param[out] deltaH  enthalpy of reaction [J/kmol]; length
+     *     nReactions() or null
+     * @param[out] deltaS  entropy of reaction [J/kmol/K]; length
+     *     nReactions() or null
+     * @param[out] deltaG  Gibbs energy of reaction [J/kmol]; length
+     *     nReactions() or null
+     */
+    virtual void getDeltaAll(double* deltaH, double* deltaS, double* deltaG) {
+        throw NotImplementedError("Kinetics::getDeltaAll");
+    }
+
     /**
      * Return the vector of values for the reaction standard state Gibbs free
      * energy change. These values don't depend upon the concentration of the
@@ -567,6 +606,21 @@ public:
      */
     virtual void getNetProductionRates(doublereal* wdot);
 
+    //! Borrowed view of the species net production rates at the current
+    //! state [kmol/m^3/s].
+    /*!
+     * Returns a reference to internal storage, so consumers that only read
+     * the rates avoid a copy per query; the contents remain valid until
+     * the next evaluation at a changed state. Combined with the
+     * state-epoch short-circuiting of the rate-of-progress update,
+     * repeated queries at one state reduce to the sparse
+     * stoichiometry product.
+     *
+     * @warning  This method is an experimental part of the %Cantera API
+     *      and may be changed or removed without notice.
+     */
+    const vector_fp& netProductionRates();
+
     //! @}
     //! @name Routines to Calculate Derivatives (Jacobians)
     //!
@@ -706,6 +760,24 @@ public:
             "Not implemented for kinetics type '{}'.", kineticsType());
     }
 
+    /**
+     * Calculate derivatives for forward rates-of-progress with respect to species
+     * concentration at constant temperature, pressure and remaining species
+     * concentrations.
+     *
+     * The method returns a matrix with nReactions rows and nTotalSpecies columns.
+     * For a derivative with respect to \f$c_i\f$, all other \f$c_j\f$ are held
+     * constant.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddCi()
+    {
+        throw NotImplementedError("Kinetics::fwdRatesOfProgress_ddCi",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
     /**
      * Calculate derivatives for reverse rates-of-progress with respect to temperature
      * at constant pressure, molar concentration and mole fractions.
@@ -759,6 +831,24 @@ public:
             "Not implemented for kinetics type '{}'.", kineticsType());
     }
 
+    /**
+     * Calculate derivatives for reverse rates-of-progress with respect to species
+     * concentration at constant temperature, pressure and remaining species
+     * concentrations.
+     *
+     * The method returns a matrix with nReactions rows and nTotalSpecies columns.
+     * For a derivative with respect to \f$c_i\f$, all other \f$c_j\f$ are held
+     * constant.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddCi()
+    {
+        throw NotImplementedError("Kinetics::revRatesOfProgress_ddCi",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
     /**
      * Calculate derivatives for net rates-of-progress with respect to temperature
      * at constant pressure, molar concentration and mole fractions.
@@ -812,6 +902,24 @@ public:
             "Not implemented for kinetics type '{}'.", kineticsType());
     }
 
+    /**
+     * Calculate derivatives for net rates-of-progress with respect to species
+     * concentration at constant temperature, pressure and remaining species
+     * concentrations.
+     *
+     * The method returns a matrix with nReactions rows and nTotalSpecies columns.
+     * For a derivative with respect to \f$c_i\f$, all other \f$c_j\f$ are held
+     * constant.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddCi()
+    {
+        throw NotImplementedError("Kinetics::netRatesOfProgress_ddCi",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
     /**
      * Calculate derivatives for species creation rates with respect to temperature
      * at constant pressure, molar concentration and mole fractions.
@@ -923,6 +1031,20 @@ public:
      */
     Eigen::SparseMatrix<double> netProductionRates_ddX();
 
+    /**
+     * Calculate derivatives for species net production rates with respect to species
+     * concentration at constant temperature, pressure and remaining species
+     * concentrations.
+     *
+     * The method returns a matrix with nTotalSpecies rows and nTotalSpecies columns.
+     * For a derivative with respect to \f$c_i\f$, all other \f$c_j\f$ are held
+     * constant.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    Eigen::SparseMatrix<double> netProductionRates_ddCi();
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
@@ -1120,6 +1242,39 @@ public:
      */
     virtual void resizeSpecies();
 
+    //! Compact the retained reaction descriptions after setup.
+    /*!
+     * The evaluation path compiles all stoichiometry and rate data into
+     * its own flat arrays at setup time; the Reaction objects are kept
+     * only for introspection and serialization. This method deduplicates
+     * the third-body descriptions shared by many reactions (large
+     * mechanisms repeat identical efficiency maps hundreds of times) so
+     * equal objects are stored once and referenced via shared pointers.
+     * Returns the number of third-body objects released.
+     *
+     * @warning  This method is an experimental part of the %Cantera API
+     *      and may be changed or removed without notice.
+     */
+    size_t compactReactionData();
+
+    //! Begin a batched mechanism modification: until endAddition() is
+    //! called, addReaction() defers all geometry updates (stoichiometry
+    //! manager setup, rate evaluator resizing) regardless of its *resize*
+    //! argument, so building a large mechanism programmatically is O(n)
+    //! instead of O(n^2). The per-reaction containers grow with the usual
+    //! amortized capacity doubling. The object is not usable for
+    //! evaluations between the two calls.
+    void beginAddition() {
+        m_deferResize = true;
+    }
+
+    //! Finish a batched modification started with beginAddition() by
+    //! performing the single deferred geometry update
+    void endAddition() {
+        m_deferResize = false;
+        resizeReactions();
+    }
+
     /**
      * Add a single reaction to the mechanism. Derived classes should call the
      * base class method in addition to handling their own specialized behavior.
@@ -1283,6 +1438,10 @@ protected:
     Eigen::SparseMatrix<double> m_stoichMatrix;
     //! @}
 
+    //! `true` while a batched modification defers geometry updates
+    //! @see beginAddition()
+    bool m_deferResize = false;
+
     //! Boolean indicating whether Kinetics object is fully configured
     bool m_ready;
 
@@ -1339,6 +1498,9 @@ protected:
     //! number of spatial dimensions of lowest-dimensional phase.
     size_t m_mindim;
 
+    //! Storage backing the borrowed netProductionRates() view
+    vector_fp m_wdotNet;
+
     //! Forward rate constant for each reaction
     vector_fp m_rfn;
 
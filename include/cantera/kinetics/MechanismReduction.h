@@ -0,0 +1,78 @@
+/**
+ * @file MechanismReduction.h
+ *   Declarations for runtime skeletal mechanism reduction by the directed
+ *   relation graph (DRG) method.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_MECHANISMREDUCTION_H
+#define CT_MECHANISMREDUCTION_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Kinetics;
+
+//! Select the active species of a skeletal mechanism by the directed
+//! relation graph (DRG) method at the current state of *kin*.
+/*!
+ * The interaction coefficient of species A with species B,
+ * \f[
+ *   r_{AB} = \frac{\sum_i |\nu_{A,i} R_i| \delta_{B,i}}
+ *                 {\sum_i |\nu_{A,i} R_i|},
+ * \f]
+ * is evaluated from the net rates of progress at the current state, and
+ * species reachable from the targets through edges with
+ * \f$ r_{AB} \ge \f$ *threshold* are retained.
+ *
+ * @param kin  kinetics manager at the state of interest
+ * @param targets  names of the target species (fuel, oxidizer, ...)
+ * @param threshold  DRG threshold; larger values prune more aggressively
+ * @returns  flags marking the active species (kinetics species indexing)
+ *
+ * @warning  This function is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ */
+std::vector<bool> drgActiveSpecies(Kinetics& kin,
+                                   const std::vector<std::string>& targets,
+                                   double threshold);
+
+//! Apply a skeletal reduction to a live kinetics manager.
+/*!
+ * Every reaction involving an inactive species is disabled via
+ * Kinetics::setMultiplier(i, 0), which also deactivates it inside the rate
+ * evaluators so the pruned reactions cost nothing per evaluation; all other
+ * reactions have their multipliers restored to one. The mechanism can be
+ * re-expanded at any time by reapplying with a different active set.
+ *
+ * @param kin  kinetics manager to prune
+ * @param activeSpecies  active-species flags, as from drgActiveSpecies()
+ * @returns  the number of reactions remaining active
+ */
+size_t applySkeletalReduction(Kinetics& kin,
+                              const std::vector<bool>& activeSpecies);
+
+//! Compute a cache-friendly species ordering for the mechanism of *kin*.
+/*!
+ * Runs reverse Cuthill-McKee on the species adjacency graph induced by the
+ * reactions (species are adjacent when they participate in a common
+ * reaction), which clusters the indices touched together by the
+ * stoichiometry managers and the species Jacobian. The returned
+ * permutation maps new positions to current kinetics species indices and
+ * is intended for declaring species in that order when building a phase
+ * programmatically (or regenerating an input file); the library does not
+ * reorder existing phases, as every user-visible index would otherwise
+ * need a translation layer.
+ *
+ * @warning  This function is an experimental part of the %Cantera API and
+ *      may be changed or removed without notice.
+ */
+std::vector<size_t> cacheOptimizedSpeciesOrder(Kinetics& kin);
+
+}
+
+#endif
@@ -12,12 +12,14 @@
 #include "MultiRateBase.h"
 #include "cantera/base/utilities.h"
 
+#include <set>
+
 namespace Cantera
 {
 
 //! A class template handling ReactionRate specializations.
 template <class RateType, class DataType>
-class MultiRate final : public MultiRateBase
+class MultiRate : public MultiRateBase
 {
     CT_DEFINE_HAS_MEMBER(has_update, updateFromStruct)
     CT_DEFINE_HAS_MEMBER(has_ddT, ddTScaledFromStruct)
@@ -65,8 +67,31 @@ public:
     }
 
     virtual void getRateConstants(double* kf) override {
-        for (auto& rxn : m_rxn_rates) {
-            kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+        if (m_inactive.empty()) {
+            for (auto& rxn : m_rxn_rates) {
+                kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+            }
+            return;
+        }
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            auto& rxn = m_rxn_rates[i];
+            if (m_inactive.count(i)) {
+                kf[rxn.first] = 0.;
+            } else {
+                kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+            }
+        }
+    }
+
+    virtual void setActive(size_t rxn_index, bool active) override {
+        auto iter = m_indices.find(rxn_index);
+        if (iter == m_indices.end()) {
+            return;
+        }
+        if (active) {
+            m_inactive.erase(iter->second);
+        } else {
+            m_inactive.insert(iter->second);
         }
     }
 
@@ -265,6 +290,10 @@ protected:
     std::vector<std::pair<size_t, RateType>> m_rxn_rates;
     std::map<size_t, size_t> m_indices; //! Mapping of indices
     DataType m_shared;
+
+    //! Positions within m_rxn_rates whose evaluation is deactivated
+    //! @see setActive()
+    std::set<size_t> m_inactive;
 };
 
 }
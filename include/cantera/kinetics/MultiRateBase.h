@@ -111,6 +111,16 @@ public:
     //! @returns  flag indicating whether reaction rates need to be re-evaluated
     virtual bool update(const ThermoPhase& phase, const Kinetics& kin) = 0;
 
+    //! Activate or deactivate evaluation of a managed reaction rate.
+    /*!
+     * Deactivated rates are skipped by getRateConstants(), leaving their
+     * rate constant at zero, so dormant reactions (for example those
+     * disabled via Kinetics::setMultiplier(i, 0)) cost nothing per
+     * evaluation. Rates are active by default; indices not handled by this
+     * evaluator are ignored.
+     */
+    virtual void setActive(size_t rxn_index, bool active) {}
+
     //! Get the rate for a single reaction. Used to implement ReactionRate::eval,
     //! which allows for the evaluation of a reaction rate expression outside of
     //! Kinetics reaction rate evaluators. Mainly used for testing purposes.
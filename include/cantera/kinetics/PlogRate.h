@@ -115,21 +115,26 @@ public:
                 return;
             }
 
-            auto iter = pressures_.upper_bound(logP_);
-            AssertThrowMsg(iter != pressures_.end(), "PlogRate::updateFromStruct",
+            // binary search on the contiguous pressure grid built in setRates()
+            auto iter = std::upper_bound(logPressures_.begin(),
+                                         logPressures_.end(), logP_);
+            AssertThrowMsg(iter != logPressures_.end(),
+                           "PlogRate::updateFromStruct",
                            "Pressure out of range: {}", logP_);
-            AssertThrowMsg(iter != pressures_.begin(), "PlogRate::updateFromStruct",
+            AssertThrowMsg(iter != logPressures_.begin(),
+                           "PlogRate::updateFromStruct",
                            "Pressure out of range: {}", logP_);
 
             // upper interpolation pressure
-            logP2_ = iter->first;
-            ihigh1_ = iter->second.first;
-            ihigh2_ = iter->second.second;
+            size_t j = iter - logPressures_.begin();
+            logP2_ = logPressures_[j];
+            ihigh1_ = rateRanges_[j].first;
+            ihigh2_ = rateRanges_[j].second;
 
             // lower interpolation pressure
-            logP1_ = (--iter)->first;
-            ilow1_ = iter->second.first;
-            ilow2_ = iter->second.second;
+            logP1_ = logPressures_[j - 1];
+            ilow1_ = rateRanges_[j - 1].first;
+            ilow2_ = rateRanges_[j - 1].second;
 
             rDeltaP_ = 1.0 / (logP2_ - logP1_);
         }
@@ -185,6 +190,13 @@ protected:
     //! log(p) to (index range) in the rates_ vector
     std::map<double, std::pair<size_t, size_t>> pressures_;
 
+    //! Contiguous copies of the keys and values of pressures_, set up by
+    //! setRates(). Interval selection in updateFromStruct() uses these
+    //! flat arrays, which are considerably faster to search than the
+    //! node-based map.
+    vector_fp logPressures_;
+    std::vector<std::pair<size_t, size_t>> rateRanges_;
+
     // Rate expressions which are referenced by the indices stored in pressures_
     std::vector<ArrheniusRate> rates_;
 
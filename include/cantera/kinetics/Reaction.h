@@ -175,6 +175,13 @@ public:
     void setRate(shared_ptr<ReactionRate> rate);
 
     //! Get pointer to third-body handler
+    //! Install a (possibly shared) third-body description, for example to
+    //! flyweight identical efficiency maps across reactions
+    //! @see Kinetics::compactReactionData()
+    void setThirdBody(shared_ptr<ThirdBody> tbody) {
+        m_third_body = tbody;
+    }
+
     shared_ptr<ThirdBody> thirdBody() {
         return m_third_body;
     }
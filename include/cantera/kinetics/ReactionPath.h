@@ -299,6 +299,30 @@ public:
     int build(Kinetics& s, const std::string& element, std::ostream& output,
               ReactionPathDiagram& r, bool quiet=false);
 
+    //! Rebuild the flux diagram *r* for the current rates of progress using
+    //! the edge topology cached by a previous build() for the same element.
+    /*!
+     * The element-flux graph topology (species pairs, atom-transfer
+     * factors and edge labels) depends only on the mechanism and is cached
+     * on the first build() per element; update() then recomputes only the
+     * edge fluxes from the current rates in one pass, which is what
+     * flux-diagram animation over a transient needs. Falls back to a full
+     * build() when no topology is cached for *element*.
+     */
+    int update(Kinetics& s, const std::string& element,
+               ReactionPathDiagram& r);
+
+    //! One cached edge of the element-flux graph
+    //! @see update()
+    struct FluxEdge {
+        size_t rxn; //!< Reaction index
+        size_t kkr; //!< Reactant-side species
+        size_t kkp; //!< Product-side species
+        double f; //!< Atoms of the element transferred along this edge
+        std::string fwdlabel; //!< Label of the forward edge
+        std::string revlabel; //!< Label of the reverse edge
+    };
+
     //! Analyze a reaction to determine which reactants lead to which products.
     int findGroups(std::ostream& logfile, Kinetics& s);
 
@@ -323,6 +347,10 @@ protected:
     //! for "A+B -> C+D", "B" is reactant number 1 and "C" is product number 0.
     std::map<size_t, std::map<size_t, std::map<size_t, Group> > > m_transfer;
 
+    //! Cached element-flux edges per element
+    //! @see update()
+    std::map<std::string, std::vector<FluxEdge>> m_edgeCache;
+
     std::vector<bool> m_determinate;
     Array2D m_atoms;
     std::map<std::string, size_t> m_enamemap;
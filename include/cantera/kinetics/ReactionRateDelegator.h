@@ -26,14 +26,46 @@ public:
                 return 0.0; // necessary to set lambda's function signature
             }
         );
+        install("evalBatch", m_evalBatch,
+            [](void*) {
+                throw NotImplementedError("ReactionRateDelegator::evalBatch");
+                return 0.0; // necessary to set lambda's function signature
+            }
+        );
         install("setParameters", m_setParameters,
             [this](const AnyMap& node, const UnitStack& units) {
                 ReactionRate::setParameters(node, units); });
     }
 
-    virtual unique_ptr<MultiRateBase> newMultiRate() const override {
-        return unique_ptr<MultiRateBase>(
-            new MultiRate<ReactionRateDelegator, ArrheniusData>);
+    virtual unique_ptr<MultiRateBase> newMultiRate() const override;
+
+    //! Request describing one batched external rate evaluation
+    //! @see setHasBatchEval()
+    struct BatchRequest {
+        double temperature; //!< temperature [K]
+        size_t n; //!< number of managed reactions
+        const size_t* indices; //!< reaction index of each entry
+        double* kf; //!< output rate constants; length n
+    };
+
+    //! Declare that this rate's external provider implements the
+    //! 'evalBatch' delegate: a single callback per state receiving a
+    //! BatchRequest and filling the contiguous output slice for all
+    //! reactions of this rate type, amortizing the language boundary
+    //! crossing (for example over a NumPy-vectorized implementation). Set
+    //! by the binding layer when the user type provides the batched form.
+    void setHasBatchEval(bool hasBatch) {
+        m_hasBatchEval = hasBatch;
+    }
+
+    //! Returns `true` if the external provider evaluates in batch
+    bool hasBatchEval() const {
+        return m_hasBatchEval;
+    }
+
+    //! Perform a batched evaluation through the 'evalBatch' delegate
+    void evalBatch(BatchRequest& request) {
+        m_evalBatch(&request);
     }
 
     //! Set the reaction type based on the user-provided reaction rate parameterization
@@ -63,10 +95,50 @@ public:
 
 private:
     std::string m_rateType;
+    bool m_hasBatchEval = false;
     std::function<double(void*)> m_evalFromStruct;
+    std::function<double(void*)> m_evalBatch;
     std::function<void(const AnyMap&, const UnitStack&)> m_setParameters;
 };
 
+//! A rate evaluator for delegated (external) rates supporting batched
+//! evaluation: when the external provider implements the 'evalBatch'
+//! delegate, all managed reactions are evaluated with a single boundary
+//! crossing per state; otherwise each rate is delegated individually as
+//! before.
+class DelegatedMultiRate
+    : public MultiRate<ReactionRateDelegator, ArrheniusData>
+{
+public:
+    virtual void getRateConstants(double* kf) override {
+        size_t n = m_rxn_rates.size();
+        if (n && m_rxn_rates[0].second.hasBatchEval()) {
+            m_indices.resize(n);
+            m_buf.resize(n);
+            for (size_t i = 0; i < n; i++) {
+                m_indices[i] = m_rxn_rates[i].first;
+            }
+            ReactionRateDelegator::BatchRequest request{
+                m_shared.temperature, n, m_indices.data(), m_buf.data()};
+            m_rxn_rates[0].second.evalBatch(request);
+            for (size_t i = 0; i < n; i++) {
+                kf[m_indices[i]] = m_buf[i];
+            }
+            return;
+        }
+        MultiRate<ReactionRateDelegator, ArrheniusData>::getRateConstants(kf);
+    }
+
+protected:
+    std::vector<size_t> m_indices; //!< Reaction indices of managed rates
+    vector_fp m_buf; //!< Contiguous output slice handed to the provider
+};
+
+inline unique_ptr<MultiRateBase> ReactionRateDelegator::newMultiRate() const
+{
+    return unique_ptr<MultiRateBase>(new DelegatedMultiRate);
+}
+
 }
 
 #endif
@@ -596,11 +596,28 @@ public:
     /**
      * Constructor for the StoichManagerN class.
      */
-    StoichManagerN() : m_ready(true) {
+    StoichManagerN() : m_ready(true), m_useSpmv(false) {
         m_stoichCoeffs.setZero();
         m_stoichCoeffs.resize(0, 0);
     }
 
+    //! Switch the linear operations (incrementSpecies, decrementSpecies,
+    //! incrementReactions and decrementReactions) between the unrolled
+    //! per-reaction implementation and compressed-sparse-row matrix-vector
+    //! products with sequential memory access. Results are equivalent; the
+    //! summation order of the two modes differs. The nonlinear multiply()
+    //! operation is unaffected.
+    void setSpmvMode(bool enable) {
+        m_useSpmv = enable;
+    }
+
+    //! Returns `true` if sparse matrix-vector products are used for the
+    //! linear stoichiometry operations
+    //! @see setSpmvMode()
+    bool spmvMode() const {
+        return m_useSpmv;
+    }
+
     //! Resize the sparse coefficient matrix
     void resizeCoeffs(size_t nSpc, size_t nRxn)
     {
@@ -611,6 +628,9 @@ public:
         m_stoichCoeffs.reserve(nCoeffs);
         m_stoichCoeffs.setFromTriplets(m_coeffList.begin(), m_coeffList.end());
 
+        // Row-major copy used for matrix-vector products over species
+        m_stoichCoeffsRow = m_stoichCoeffs;
+
         // Set up outer/inner indices for mapped derivative output
         Eigen::SparseMatrix<double> tmp = m_stoichCoeffs.transpose();
         m_outerIndices.resize(nSpc + 1); // number of columns + 1
@@ -730,6 +750,12 @@ public:
     }
 
     void incrementSpecies(const doublereal* input, doublereal* output) const {
+        if (m_useSpmv && m_ready) {
+            Eigen::Map<const Eigen::VectorXd> R(input, m_stoichCoeffsRow.cols());
+            Eigen::Map<Eigen::VectorXd> S(output, m_stoichCoeffsRow.rows());
+            S.noalias() += m_stoichCoeffsRow * R;
+            return;
+        }
         _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
         _incrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
@@ -737,6 +763,12 @@ public:
     }
 
     void decrementSpecies(const doublereal* input, doublereal* output) const {
+        if (m_useSpmv && m_ready) {
+            Eigen::Map<const Eigen::VectorXd> R(input, m_stoichCoeffsRow.cols());
+            Eigen::Map<Eigen::VectorXd> S(output, m_stoichCoeffsRow.rows());
+            S.noalias() -= m_stoichCoeffsRow * R;
+            return;
+        }
         _decrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _decrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
         _decrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
@@ -744,6 +776,12 @@ public:
     }
 
     void incrementReactions(const doublereal* input, doublereal* output) const {
+        if (m_useSpmv && m_ready) {
+            Eigen::Map<const Eigen::VectorXd> S(input, m_stoichCoeffs.rows());
+            Eigen::Map<Eigen::VectorXd> R(output, m_stoichCoeffs.cols());
+            R.noalias() += m_stoichCoeffs.transpose() * S;
+            return;
+        }
         _incrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output);
         _incrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output);
         _incrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output);
@@ -751,6 +789,12 @@ public:
     }
 
     void decrementReactions(const doublereal* input, doublereal* output) const {
+        if (m_useSpmv && m_ready) {
+            Eigen::Map<const Eigen::VectorXd> S(input, m_stoichCoeffs.rows());
+            Eigen::Map<Eigen::VectorXd> R(output, m_stoichCoeffs.cols());
+            R.noalias() -= m_stoichCoeffs.transpose() * S;
+            return;
+        }
         _decrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output);
         _decrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output);
         _decrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output);
@@ -806,6 +850,10 @@ public:
 private:
     bool m_ready; //!< Boolean flag indicating whether object is fully configured
 
+    //! Boolean flag selecting sparse matrix-vector products for the linear
+    //! operations
+    bool m_useSpmv;
+
     std::vector<C1> m_c1_list;
     std::vector<C2> m_c2_list;
     std::vector<C3> m_c3_list;
@@ -815,6 +863,10 @@ private:
     SparseTriplets m_coeffList;
     Eigen::SparseMatrix<double> m_stoichCoeffs;
 
+    //! Row-major (CSR) copy of m_stoichCoeffs used for matrix-vector products
+    //! writing to species arrays with sequential memory access
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_stoichCoeffsRow;
+
     //! Storage indicies used to build derivatives
     std::vector<int> m_outerIndices;
     std::vector<int> m_innerIndices;
@@ -9,6 +9,7 @@
 #define CT_THIRDBODYCALC_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -68,11 +69,43 @@ public:
         defaults.reserve(triplets.size());
         defaults.setFromTriplets(triplets.begin(), triplets.end());
         m_multipliers = efficiencies + defaults;
+
+        // Compacted row-major efficiency corrections: one row per third-body
+        // reaction, holding the non-default efficiencies relative to the
+        // default. Used by update() to evaluate all corrections as one
+        // sparse matrix-vector product.
+        std::vector<Eigen::Triplet<double>> compact;
+        compact.reserve(m_efficiencyList.size());
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            for (size_t j = 0; j < m_species[i].size(); j++) {
+                compact.emplace_back(static_cast<int>(i),
+                    static_cast<int>(m_species[i][j]), m_eff[i][j]);
+            }
+        }
+        m_efficienciesRow.setZero();
+        m_efficienciesRow.resize(m_reaction_index.size(), nSpc);
+        m_efficienciesRow.reserve(compact.size());
+        m_efficienciesRow.setFromTriplets(compact.begin(), compact.end());
+        m_work.resize(m_reaction_index.size());
     }
 
     //! Update third-body concentrations in full vector
     void update(const vector_fp& conc, double ctot, double* concm) const {
-        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+        size_t nRxn = m_reaction_index.size();
+        if (m_work.size() == nRxn && nRxn) {
+            // shared total-concentration term plus sparse corrections of
+            // non-default efficiencies, evaluated as one matrix-vector product
+            Eigen::Map<const Eigen::VectorXd> conc_v(
+                conc.data(), m_efficienciesRow.cols());
+            Eigen::Map<Eigen::VectorXd> work(m_work.data(), nRxn);
+            work.noalias() = m_efficienciesRow * conc_v;
+            for (size_t i = 0; i < nRxn; i++) {
+                concm[m_reaction_index[i]] = m_default[i] * ctot + m_work[i];
+            }
+            return;
+        }
+        // resizeCoeffs() has not been called; fall back to per-reaction lists
+        for (size_t i = 0; i < nRxn; i++) {
             double sum = 0.0;
             for (size_t j = 0; j < m_species[i].size(); j++) {
                 sum += m_eff[i][j] * conc[m_species[i][j]];
@@ -149,6 +182,13 @@ protected:
 
     //! Sparse derivative multiplier matrix
     Eigen::SparseMatrix<double> m_multipliers;
+
+    //! Compacted row-major matrix of non-default efficiency corrections,
+    //! with one row per installed third-body reaction
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_efficienciesRow;
+
+    //! Work array holding the efficiency corrections of each reaction
+    mutable vector_fp m_work;
 };
 
 using ThirdBodyCalc3 = ThirdBodyCalc; // @todo: remove after Cantera 3.0
@@ -79,10 +79,10 @@ public:
         setParameters(node, rate_units);
     }
 
-    unique_ptr<MultiRateBase> newMultiRate() const override {
-        return unique_ptr<MultiRateBase>(
-            new MultiRate<TwoTempPlasmaRate, TwoTempPlasmaData>);
-    }
+    //! Create rate evaluator; a batched evaluator storing rate parameters
+    //! in contiguous arrays is returned if enabled via
+    //! Cantera::use_batched_rate_evaluators().
+    unique_ptr<MultiRateBase> newMultiRate() const override;
 
     virtual const std::string type() const override {
         return "two-temperature-plasma";
@@ -117,6 +117,85 @@ public:
     }
 };
 
+
+//! A rate evaluator for TwoTempPlasmaRate using structure-of-arrays storage
+/*!
+ * The rate parameters of all managed reactions are mirrored in contiguous
+ * arrays, and the state-shared electron-energy factor
+ * \f$ (T_e - T) / (T_e T) \f$ is computed once per state instead of once
+ * per reaction. getRateConstants() then reduces to tight, auto-vectorizable
+ * sweeps accumulating the exponents followed by one exponentiation pass.
+ * Results are identical to the generic per-reaction evaluator. Selected by
+ * TwoTempPlasmaRate::newMultiRate() if
+ * Cantera::use_batched_rate_evaluators() is enabled.
+ */
+class TwoTempPlasmaMultiRate
+    : public MultiRate<TwoTempPlasmaRate, TwoTempPlasmaData>
+{
+public:
+    virtual void add(size_t rxn_index, ReactionRate& rate) override {
+        MultiRate<TwoTempPlasmaRate, TwoTempPlasmaData>::add(rxn_index, rate);
+        _appendParameters(m_rxn_rates.back());
+    }
+
+    virtual bool replace(size_t rxn_index, ReactionRate& rate) override {
+        bool found =
+            MultiRate<TwoTempPlasmaRate, TwoTempPlasmaData>::replace(rxn_index, rate);
+        _rebuildParameters();
+        return found;
+    }
+
+    virtual void getRateConstants(double* kf) override {
+        double logTe = m_shared.logTe;
+        double recipT = m_shared.recipT;
+        // electron-energy factor shared by every reaction at this state
+        double eFac = (m_shared.electronTemp - m_shared.temperature)
+                      * m_shared.recipTe * m_shared.recipT;
+        size_t n = m_batchA.size();
+        for (size_t i = 0; i < n; i++) {
+            m_batchWork[i] = m_batchB[i] * logTe - m_batchEaR[i] * recipT
+                             + m_batchE4R[i] * eFac;
+        }
+        for (size_t i = 0; i < n; i++) {
+            m_batchWork[i] = m_batchA[i] * std::exp(m_batchWork[i]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            kf[m_batchIndex[i]] = m_batchWork[i];
+        }
+    }
+
+protected:
+    //! Append parameters of a newly added rate to the contiguous arrays
+    void _appendParameters(const std::pair<size_t, TwoTempPlasmaRate>& rxn) {
+        m_batchIndex.push_back(rxn.first);
+        m_batchA.push_back(rxn.second.m_A);
+        m_batchB.push_back(rxn.second.m_b);
+        m_batchEaR.push_back(rxn.second.m_Ea_R);
+        m_batchE4R.push_back(rxn.second.m_E4_R);
+        m_batchWork.push_back(0.);
+    }
+
+    //! Mirror parameters of all managed rates into contiguous arrays
+    void _rebuildParameters() {
+        m_batchIndex.clear();
+        m_batchA.clear();
+        m_batchB.clear();
+        m_batchEaR.clear();
+        m_batchE4R.clear();
+        m_batchWork.clear();
+        for (const auto& rxn : m_rxn_rates) {
+            _appendParameters(rxn);
+        }
+    }
+
+    std::vector<size_t> m_batchIndex; //!< Reaction indices of managed rates
+    vector_fp m_batchA; //!< Pre-exponential factors
+    vector_fp m_batchB; //!< Electron-temperature exponents
+    vector_fp m_batchEaR; //!< Activation energies (in temperature units)
+    vector_fp m_batchE4R; //!< Electron activation energies (temperature units)
+    vector_fp m_batchWork; //!< Work array holding exponents / rate constants
+};
+
 }
 
 #endif
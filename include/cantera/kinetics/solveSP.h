@@ -11,6 +11,7 @@
 
 #include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/eigen_dense.h"
 
 //! @defgroup solvesp_methods Surface Problem Solver Methods
 //! @{
@@ -151,6 +152,13 @@ public:
     //! Destructor. Deletes the integrator.
     ~solveSP() {}
 
+    //! Set the number of iterations the factored Jacobian may be reused
+    //! before a full re-evaluation (0 restores the previous
+    //! rebuild-every-iteration behavior)
+    void setMaxJacAge(int age) {
+        m_maxJacAge = age;
+    }
+
 private:
     //! Unimplemented private copy constructor
     solveSP(const solveSP& right);
@@ -503,6 +511,17 @@ private:
     //! Newton's method.
     DenseMatrix m_Jac;
 
+    //! Retained LU factorization of the Jacobian, reused across iterations
+    //! while step quality allows
+    Eigen::PartialPivLU<Eigen::MatrixXd> m_JacLU;
+
+    //! Number of iterations the current factorization has been reused
+    int m_jacAge = 0;
+
+    //! Maximum number of iterations a factorization may be reused
+    //! @see setMaxJacAge()
+    int m_maxJacAge = 5;
+
 public:
     int m_ioflag;
 };
@@ -91,6 +91,44 @@ public:
         m_solver.setFillfactor(fillFactor);
     }
 
+    //! Select the factorization algorithm: "ILUT" (default, Eigen's
+    //! incomplete LU with thresholding) or "ILU0" (zero fill-in incomplete
+    //! LU on the fixed mechanism sparsity pattern, with the symbolic
+    //! structure reused across updates while the pattern is unchanged).
+    void setFactorization(const std::string& algo) {
+        if (algo != "ILUT" && algo != "ILU0") {
+            throw CanteraError("AdaptivePreconditioner::setFactorization",
+                "Unknown factorization algorithm '{}'.", algo);
+        }
+        m_factorization = algo;
+    }
+
+    //! Selected factorization algorithm
+    //! @see setFactorization()
+    const std::string& factorization() const {
+        return m_factorization;
+    }
+
+    //! Share the symbolic ILU0 data with all preconditioners carrying the
+    //! same key (typically the mechanism name): the pattern and diagonal
+    //! index arrays are derived once per key in a process-wide registry
+    //! and referenced immutably by every instance, so ensembles of
+    //! identical networks keep one copy of the symbolic analysis while
+    //! each instance holds only its numeric factors.
+    void setSharedPatternKey(const std::string& key) {
+        m_patternKey = key;
+    }
+
+    //! Number of preconditioner factorizations since initialize()
+    int nSetups() const {
+        return m_nsetups;
+    }
+
+    //! Number of preconditioner applications since initialize()
+    int nSolves() const {
+        return m_nsolves;
+    }
+
     //! Print preconditioner contents
     void printPreconditioner() override;
 
@@ -122,6 +160,30 @@ protected:
 
     //! Bool set whether to prune the matrix or not
     double m_prune_precon = true;
+
+    //! Perform the zero fill-in incomplete LU factorization
+    //! @see setFactorization()
+    void factorizeILU0();
+
+    //! Selected factorization algorithm
+    std::string m_factorization = "ILUT";
+
+    //! Row-major copy of the preconditioner used by the ILU0 factorization
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_ilu0_matrix;
+
+    //! Cached diagonal positions within the ILU0 pattern; shared between
+    //! preconditioners of the same mechanism when a pattern key is set
+    shared_ptr<const std::vector<int>> m_ilu0_diag;
+
+    //! Cached pattern (outer then inner indices) of the ILU0 factorization
+    shared_ptr<const std::vector<int>> m_ilu0_pattern;
+
+    //! Key of the shared symbolic-pattern registry entry (empty: private)
+    //! @see setSharedPatternKey()
+    std::string m_patternKey;
+
+    int m_nsetups = 0; //!< Number of factorizations since initialize()
+    int m_nsolves = 0; //!< Number of applications since initialize()
 };
 
 }
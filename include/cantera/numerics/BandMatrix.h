@@ -133,6 +133,17 @@ public:
     virtual void mult(const doublereal* b, doublereal* prod) const;
     virtual void leftMult(const doublereal* const b, doublereal* const prod) const;
 
+    //! Control whether factor() preserves the unfactored matrix contents.
+    //! When retention is disabled, the factorization consumes the assembled
+    //! data directly instead of copying it aside first; afterwards the
+    //! matrix values are unspecified until the next assembly. Callers that
+    //! re-read the Jacobian after factoring (as the colored and
+    //! block-solver paths do) must leave retention enabled, which is the
+    //! default.
+    void retainUnfactored(bool retain) {
+        m_retain_unfactored = retain;
+    }
+
     //! Perform an LU decomposition, the LAPACK routine DGBTRF is used.
     /*!
      * The factorization is saved in ludata.
@@ -276,6 +287,10 @@ protected:
     //! Number of super diagonals of the matrix
     size_t m_ku;
 
+    //! `true` if factor() preserves the unfactored matrix
+    //! @see retainUnfactored()
+    bool m_retain_unfactored = true;
+
     //! value of zero
     doublereal m_zero;
 
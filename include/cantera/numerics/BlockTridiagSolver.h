@@ -0,0 +1,67 @@
+/**
+ * @file BlockTridiagSolver.h
+ *   Declarations for the class BlockTridiagSolver, which solves
+ *   block-tridiagonal linear systems by block cyclic reduction
+ *   (see \ref numerics).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BLOCKTRIDIAGSOLVER_H
+#define CT_BLOCKTRIDIAGSOLVER_H
+
+#include "cantera/numerics/eigen_dense.h"
+
+#include <vector>
+
+namespace Cantera
+{
+
+//! Solves block-tridiagonal linear systems by block cyclic reduction.
+/*!
+ * The system is defined by block rows
+ * \f[ A_i x_{i-1} + B_i x_i + C_i x_{i+1} = b_i \f]
+ * with square diagonal blocks \f$ B_i \f$ of possibly varying sizes and
+ * correspondingly rectangular couplings. At each reduction level, the
+ * odd-indexed blocks are eliminated simultaneously; their factorizations are
+ * mutually independent and are distributed across worker threads. The number
+ * of levels is logarithmic in the number of blocks, so the factor/solve
+ * parallelizes in contrast to the strictly sequential banded LU path.
+ */
+class BlockTridiagSolver
+{
+public:
+    //! Set the number of worker threads used for the independent block
+    //! eliminations of each reduction level (0 or 1 selects serial
+    //! execution)
+    void setThreads(size_t nThreads) {
+        m_threads = nThreads;
+    }
+
+    //! Solve the block-tridiagonal system.
+    /*!
+     * The leading coupling `A[0]` and the trailing coupling `C[n-1]` must be
+     * present with zero column count. The contents of all inputs are
+     * destroyed. Returns 0 on success, or 1 + the block index of the first
+     * pivot block whose elimination failed.
+     *
+     * @param A  lower couplings; A[i] has rows(B[i]) rows and rows(B[i-1])
+     *     columns
+     * @param B  square diagonal blocks
+     * @param C  upper couplings; C[i] has rows(B[i]) rows and rows(B[i+1])
+     *     columns
+     * @param b  right-hand side blocks
+     * @param[out] x  solution blocks
+     */
+    int solve(std::vector<Eigen::MatrixXd>& A, std::vector<Eigen::MatrixXd>& B,
+              std::vector<Eigen::MatrixXd>& C, std::vector<Eigen::VectorXd>& b,
+              std::vector<Eigen::VectorXd>& x);
+
+protected:
+    size_t m_threads = 0; //!< Number of worker threads
+};
+
+}
+
+#endif
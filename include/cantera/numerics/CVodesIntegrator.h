@@ -38,11 +38,46 @@ public:
     virtual void initialize(double t0, FuncEval& func);
     virtual void reinitialize(double t0, FuncEval& func);
     virtual void integrate(double tout);
+
+    //! Times at which event functions changed sign during integrate()
+    //! since the last (re-)initialization
+    //! @see FuncEval::evalEvents()
+    virtual const vector_fp& rootTimes() const {
+        return m_rootTimes;
+    }
+
+    //! Root-info flags reported by CVodes for each recorded event time
+    //! (nEvents() entries per time; nonzero entries mark the functions
+    //! that crossed)
+    virtual const vector_int& rootInfo() const {
+        return m_rootInfo;
+    }
     virtual doublereal step(double tout);
     virtual double& solution(size_t k);
     virtual double* solution();
     virtual double* derivative(double tout, int n);
     virtual int lastOrder() const;
+    virtual double lastStepSize() const;
+
+    //! Select the CVODES forward sensitivity corrector method:
+    //! "staggered" (default), "simultaneous" or "staggered-1". The
+    //! staggered methods solve the sensitivity systems after the state
+    //! corrector converges and are usually cheaper for many parameters;
+    //! "staggered-1" processes the parameters one at a time, bounding the
+    //! memory of the nonlinear corrector at the cost of more iterations.
+    //! Takes effect at the next (re-)initialization.
+    virtual void setSensitivityMethod(const std::string& method) {
+        if (method != "staggered" && method != "simultaneous"
+            && method != "staggered-1")
+        {
+            throw CanteraError("CVodesIntegrator::setSensitivityMethod",
+                "Unknown method '{}'.", method);
+        }
+        m_sens_method = method;
+    }
+    virtual void setInitialStepSize(double h0) {
+        m_h0 = h0;
+    }
     virtual int nEquations() const {
         return static_cast<int>(m_neq);
     }
@@ -101,6 +136,34 @@ private:
     N_Vector m_y, m_abstol;
     N_Vector m_dky;
     std::string m_type;
+
+    //! Problem type for which solver memory is currently allocated; used by
+    //! applyOptions() to reuse the linear solver across reinitializations
+    //! when the structure is unchanged
+    std::string m_applied_type;
+
+    //! Problem size for which solver memory is currently allocated
+    size_t m_applied_neq = 0;
+
+    //! Initial step size to attempt after (re-)initialization (0: choose
+    //! automatically)
+    //! @see setInitialStepSize()
+    double m_h0 = 0.0;
+
+    //! Sensitivity corrector method
+    //! @see setSensitivityMethod()
+    std::string m_sens_method = "staggered";
+
+    //! Band widths for which solver memory is currently allocated
+    int m_applied_mupper = -1;
+    int m_applied_mlower = -1;
+
+    //! Times at which event (root) functions changed sign during
+    //! integrate()
+    vector_fp m_rootTimes;
+
+    //! Root-info flags of each event, nEvents() entries per recorded time
+    vector_int m_rootInfo;
     int m_itol;
     int m_method;
     int m_maxord;
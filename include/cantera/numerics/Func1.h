@@ -10,6 +10,7 @@
 
 #include "cantera/base/ct_defs.h"
 #include "cantera/base/ctexceptions.h"
+#include <limits>
 
 #include <iostream>
 
@@ -40,6 +41,65 @@ class TimesConstant1;
 /**
  * Base class for 'functor' classes that evaluate a function of one variable.
  */
+class Func1;
+
+//! A flattened, non-recursive evaluator for Func1 expression trees.
+/*!
+ * compile() walks a Func1 tree once and emits a linear tape of stack
+ * operations: constants, the binary combinations (sum, difference, product,
+ * ratio, composition) and the constant-scaling nodes become dedicated
+ * opcodes, while any other node is referenced through a single virtual call
+ * of that node alone. eval() then runs the tape in a tight loop over a
+ * value stack without recursion, removing the per-timestep tree walk.
+ * The tape references the compiled tree's nodes and must not outlive it.
+ */
+class Func1Tape
+{
+public:
+    //! Flatten the expression tree rooted at *func*
+    void compile(Func1& func);
+
+    //! Evaluate the flattened expression. The most recent evaluation is
+    //! memoized, so the repeated queries at one time made by the multiple
+    //! reactors sharing a wall or flow device cost a single comparison.
+    double eval(double t) const {
+        if (t == m_lastT) {
+            return m_lastV;
+        }
+        m_lastV = evalTape(t);
+        m_lastT = t;
+        return m_lastV;
+    }
+
+    //! Returns `true` if a tape has been compiled
+    bool ready() const {
+        return !m_ops.empty();
+    }
+
+private:
+    //! Tape operation codes
+    enum class Op { Const, Call, Add, Sub, Mul, Div, Compose, TimesC, PlusC };
+
+    //! One tape entry
+    struct TapeOp {
+        Op op; //!< Operation code
+        double c; //!< Constant operand
+        Func1* f; //!< Called node (Op::Call only)
+    };
+
+    //! Emit operations for *func* in post-order
+    void emit(Func1& func);
+
+    //! Run the tape
+    double evalTape(double t) const;
+
+    mutable double m_lastT = std::numeric_limits<double>::quiet_NaN();
+    mutable double m_lastV = 0.0; //!< Memoized value at #m_lastT
+
+    std::vector<TapeOp> m_ops; //!< Flattened program
+    mutable vector_fp m_stack; //!< Value stack used during evaluation
+};
+
 class Func1
 {
 public:
@@ -294,6 +354,13 @@ public:
         return TabulatedFuncType;
     }
     virtual double eval(double t) const;
+
+    //! Table breakpoint times. Integrations can be advanced breakpoint to
+    //! breakpoint so the integrator restarts cleanly at each profile
+    //! discontinuity instead of discovering it with rejected small steps.
+    const vector_fp& tableTimes() const {
+        return m_tvec;
+    }
     virtual Func1& duplicate() const {
         if (m_isLinear) {
             return *(new Tabulated1(m_tvec.size(), &m_tvec[0], &m_fvec[0],
@@ -307,6 +374,10 @@ public:
     virtual Func1& derivative() const;
 private:
     vector_fp m_tvec; //!< Vector of time values
+
+    //! Segment index of the most recent evaluation
+    //! @see eval()
+    mutable size_t m_lastSegment = 0;
     vector_fp m_fvec; //!< Vector of function values
     bool m_isLinear; //!< Boolean indicating interpolation method
 };
@@ -9,6 +9,7 @@
 #define CT_FUNCEVAL_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_sparse.h"
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/global.h"
 
@@ -50,6 +51,67 @@ public:
      */
     int eval_nothrow(double t, double* y, double* ydot);
 
+    /**
+     * Evaluate the analytic Jacobian of the ODE system.
+     * @param[in] t time
+     * @param[in] y solution vector, length neq()
+     * @param[in] ydot rate of change of solution vector, length neq()
+     * @param[in] p sensitivity parameter vector, length nparams()
+     * @param[out] j column-major dense Jacobian d(ydot)/dy; neq() x neq()
+     *
+     * Derived classes providing an analytic Jacobian override this method
+     * together with hasJacobian(); direct linear solvers then use it
+     * instead of internal difference quotients.
+     */
+    virtual void evalJacobian(double t, double* y, double* ydot, double* p,
+                              double* j) {
+        throw NotImplementedError("FuncEval::evalJacobian");
+    }
+
+    //! Returns `true` if this evaluator provides an analytic Jacobian
+    //! through evalJacobian()
+    virtual bool hasJacobian() const {
+        return false;
+    }
+
+    //! Number of event (root) functions monitored during integration
+    virtual size_t nEvents() const {
+        return 0;
+    }
+
+    //! Evaluate the event functions \f$ g_i(t, y) \f$ whose sign changes
+    //! are located by the integrator
+    //! @param t  time
+    //! @param y  solution vector, length neq()
+    //! @param[out] g  event function values, length nEvents()
+    virtual void evalEvents(double t, double* y, double* g) {}
+
+    //! Evaluate the analytic Jacobian, and return a success/fail code
+    //! instead of throwing. Used by integrator library callbacks.
+    //! @see evalJacobian()
+    int jacobian_nothrow(double t, double* y, double* ydot, double* j);
+
+    /**
+     * Evaluate the analytic Jacobian in sparse triplet form.
+     * @param[in] t time
+     * @param[in] y solution vector, length neq()
+     * @param[in] ydot rate of change of solution vector, length neq()
+     * @param[in] p sensitivity parameter vector, length nparams()
+     * @param[out] jac triplets of d(ydot)/dy; cleared before filling
+     *
+     * Used by sparse-direct linear solvers. Evaluators overriding
+     * evalJacobian() should usually override this method as well.
+     */
+    virtual void evalJacobianSparse(double t, double* y, double* ydot,
+                                    double* p, SparseTriplets& jac) {
+        throw NotImplementedError("FuncEval::evalJacobianSparse");
+    }
+
+    //! Evaluate the sparse analytic Jacobian without throwing
+    //! @see evalJacobianSparse()
+    int jacobianSparse_nothrow(double t, double* y, double* ydot,
+                               SparseTriplets& jac);
+
     /*! Evaluate the setup processes for the Jacobian preconditioner.
      * @param[in] t time.
      * @param[in] y solution vector, length neq()
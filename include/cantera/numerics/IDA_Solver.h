@@ -25,6 +25,8 @@
 namespace Cantera
 {
 
+class AnyMap;
+
 class ResidData;
 
 /**
@@ -69,6 +71,11 @@ public:
      */
     virtual void setBandedLinearSolver(int m_upper, int m_lower);
 
+    //! Integrator statistics (steps, residual and Jacobian evaluation
+    //! counts, failure counts, last order and step size), matching the
+    //! layout of CVodesIntegrator::solverStats()
+    AnyMap solverStats() const;
+
     virtual void setMaxOrder(int n);
 
     //! Set the maximum number of time steps
@@ -181,6 +181,21 @@ public:
         warn("integrate");
     }
 
+    //! Times at which event (root) functions changed sign during
+    //! integration, for integrators supporting root finding
+    //! @see FuncEval::evalEvents()
+    virtual const vector_fp& rootTimes() const {
+        static vector_fp empty;
+        return empty;
+    }
+
+    //! Root-info flags for each recorded event time, with
+    //! FuncEval::nEvents() entries per time
+    virtual const vector_int& rootInfo() const {
+        static vector_int empty;
+        return empty;
+    }
+
     /**
      * Integrate the system of equations.
      * @param tout integrate to this time. Note that this is the
@@ -215,6 +230,18 @@ public:
         return 0;
     }
 
+    //! Step size of the last internal step [s]
+    virtual double lastStepSize() const {
+        warn("lastStepSize");
+        return 0.0;
+    }
+
+    //! Set the step size to attempt on the next (re-)initialization
+    //! (0: let the integrator choose)
+    virtual void setInitialStepSize(double h0) {
+        warn("setInitialStepSize");
+    }
+
     //! The number of equations.
     virtual int nEquations() const {
         warn("nEquations");
@@ -271,6 +298,13 @@ public:
         warn("setBandwidth");
     }
 
+    //! Select the forward sensitivity corrector method, for integrators
+    //! supporting sensitivity analysis
+    //! @see CVodesIntegrator::setSensitivityMethod()
+    virtual void setSensitivityMethod(const std::string& method) {
+        warn("setSensitivityMethod");
+    }
+
     virtual int nSensParams() {
         warn("nSensParams()");
         return 0;
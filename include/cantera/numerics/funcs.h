@@ -30,6 +30,51 @@ namespace Cantera
 doublereal linearInterp(doublereal x, const vector_fp& xpts,
                         const vector_fp& fpts);
 
+//! A one-dimensional interpolator with cached bracket state.
+/*!
+ * Unlike the free function linearInterp(), which binary-searches the node
+ * array on every call, an Interp1D carries the interval of its previous
+ * query, so the near-monotonic query sequences of residual loops and
+ * profile-driven boundary conditions locate their interval in O(1).
+ * Linear and monotone cubic Hermite (Fritsch-Carlson) interpolation are
+ * provided; the Hermite slopes are precomputed at construction. Queries
+ * outside the node range return the boundary values.
+ */
+class Interp1D
+{
+public:
+    //! Interpolation method
+    enum class Method {
+        Linear, //!< piecewise linear
+        MonotoneHermite //!< monotone cubic Hermite (Fritsch-Carlson)
+    };
+
+    //! @param x  node positions; strictly increasing, at least 2 entries
+    //! @param f  values at the nodes
+    //! @param method  interpolation method
+    Interp1D(const vector_fp& x, const vector_fp& f,
+             Method method=Method::Linear);
+
+    //! Evaluate the interpolant at *x*
+    double eval(double x) const;
+
+    //! Evaluate the interpolant at an array of points in one call
+    //! @param n  number of points
+    //! @param x  query positions
+    //! @param[out] f  interpolated values
+    void eval(size_t n, const double* x, double* f) const;
+
+private:
+    //! Locate the interval containing *x*, starting from the previous one
+    size_t findCell(double x) const;
+
+    vector_fp m_x; //!< Node positions
+    vector_fp m_f; //!< Node values
+    vector_fp m_slope; //!< Hermite slopes (MonotoneHermite only)
+    Method m_method; //!< Interpolation method
+    mutable size_t m_lastCell = 0; //!< Interval of the previous query
+};
+
 //! Numerical integration of a function using the trapezoidal rule.
 /*!
  * Vector x contanins a monotonic sequence of grid points, and
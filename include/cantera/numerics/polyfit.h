@@ -7,6 +7,7 @@
 #define CT_POLYFIT_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
@@ -32,5 +33,34 @@ namespace Cantera
 double polyfit(size_t n, size_t deg, const double* x, const double* y,
                const double* w, double* p);
 
+//! Performs a sequence of least-squares polynomial fits sharing the same
+//! abscissas.
+/*!
+ * The design (Vandermonde) matrix and its QR factorization are computed once
+ * at construction and reused for every right-hand side, so batches of
+ * unweighted fits over common nodes - as issued by the transport property
+ * fitting - cost one factorization plus a cheap solve per fit instead of an
+ * independent factorization each.
+ */
+class PolyFitter
+{
+public:
+    //! @param n  number of points
+    //! @param deg  degree of the fitted polynomial; must be less than n
+    //! @param xp  array of abscissa values; length n
+    PolyFitter(size_t n, size_t deg, const double* xp);
+
+    //! Fit the ordinate values *yp* (length n), writing the deg+1
+    //! polynomial coefficients to *pp* and returning the rms error of the
+    //! fit
+    double fit(const double* yp, double* pp) const;
+
+private:
+    size_t m_n; //!< Number of points
+    size_t m_deg; //!< Polynomial degree
+    Eigen::MatrixXd m_A; //!< Design matrix
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> m_QR; //!< Shared factorization
+};
+
 }
 #endif
@@ -36,12 +36,23 @@ public:
     IonFlow(shared_ptr<Solution> sol, size_t nsp = 1, size_t points = 1);
 
     //! set the solving stage
+    /*!
+     * Stage 1 freezes the ions, stage 2 solves the electric field fully
+     * coupled within the Newton iteration, and stage 3 solves it in a
+     * segregated manner: the field is integrated directly from Gauss's law
+     * with the charge density lagged, keeping the electric coupling out of
+     * the Jacobian.
+     */
     virtual void setSolvingStage(const size_t phase);
 
     virtual void resize(size_t components, size_t points);
     virtual bool componentActive(size_t n) const;
 
     virtual void _finalize(const double* x);
+    //! Integrate Gauss's law for the lagged electric field used by the
+    //! segregated solving stage
+    void updateElectricField(double* x);
+
     //! set to solve electric field on a point
     void solveElectricField(size_t j=npos);
     //! set to fix voltage on a point
@@ -104,6 +115,11 @@ protected:
     //! solving stage
     size_t m_stage;
 
+    //! Lagged electric field of the segregated solving stage, obtained by
+    //! direct integration of Gauss's law
+    //! @see updateElectricField()
+    vector_fp m_Efield;
+
     //! index of electron
     size_t m_kElectron;
 
@@ -32,6 +32,23 @@ public:
      */
     void eval(doublereal* x0, doublereal* resid0, double rdt);
 
+    //! Select colored finite differencing: components of one variable at all
+    //! grid points of the same color (stride 3) are perturbed together, so
+    //! the Jacobian is built from 3 x nVars full residual evaluations
+    //! independent of the grid size, instead of one local evaluation per
+    //! column. Correct for the nearest-neighbor stencils produced by the 1D
+    //! domains (the same assumption the per-column path makes when it
+    //! attributes rows j-1..j+1).
+    void setColoredMode(bool colored) {
+        m_colored = colored;
+    }
+
+    //! Returns `true` if colored finite differencing is enabled
+    //! @see setColoredMode()
+    bool coloredMode() const {
+        return m_colored;
+    }
+
     //! Elapsed CPU time spent computing the Jacobian.
     doublereal elapsedTime() const {
         return m_elapsed;
@@ -52,6 +69,12 @@ public:
         m_age++;
     }
 
+    //! Number of grid points of the OneDim system this Jacobian was sized
+    //! for
+    size_t gridPoints() const {
+        return m_points;
+    }
+
     void updateTransient(doublereal rdt, integer* mask);
 
     //! Set the Jacobian age.
@@ -78,6 +101,20 @@ protected:
     doublereal m_elapsed;
     vector_fp m_ssdiag;
     vector_int m_mask;
+
+    //! Boolean flag selecting colored finite differencing
+    //! @see setColoredMode()
+    bool m_colored = false;
+
+    //! Saved solution components of the perturbed color group
+    vector_fp m_xsaveCol;
+
+    //! Reciprocal perturbations of the perturbed color group
+    vector_fp m_rdxCol;
+
+    //! Evaluate the Jacobian by colored finite differencing
+    //! @see setColoredMode()
+    void evalColored(doublereal* x0, doublereal* resid0, double rdt);
     int m_nevals;
     int m_age;
     size_t m_size;
@@ -7,6 +7,7 @@
 #define CT_MULTINEWTON_H
 
 #include "MultiJac.h"
+#include "cantera/numerics/BlockTridiagSolver.h"
 
 namespace Cantera
 {
@@ -33,6 +34,58 @@ public:
     void step(doublereal* x, doublereal* step,
               OneDim& r, MultiJac& jac, int loglevel);
 
+    //! Number of damped-Newton solve() calls; structured telemetry
+    int nSolveCalls() const {
+        return m_nSolveCalls;
+    }
+
+    //! Number of damping backtracks taken across all solves; structured
+    //! telemetry replacing log-scraping for convergence monitoring
+    int nBacktracks() const {
+        return m_nBacktracks;
+    }
+
+    //! Enable limited-memory Broyden acceleration of aged Jacobians.
+    /*!
+     * Between full Jacobian evaluations, each Newton iterate contributes a
+     * rank-one Broyden update applied to the linear solves through the
+     * Sherman-Morrison formula, so the aged factorization tracks the
+     * solution much longer before a full MultiJac::eval() is needed. Updates
+     * are discarded whenever a fresh Jacobian is evaluated, and degenerate
+     * updates are skipped; the damped-step logic provides the fallback to a
+     * full re-evaluation when step quality degrades. *maxUpdates* bounds
+     * the stored update pairs (0 disables the acceleration; default).
+     */
+    void setBroydenUpdates(size_t maxUpdates) {
+        m_broydenMax = maxUpdates;
+        m_updU.clear();
+        m_updV.clear();
+        m_updZ.clear();
+        m_havePrevB = false;
+    }
+
+    //! Maximum number of stored Broyden updates (0 if disabled)
+    //! @see setBroydenUpdates()
+    size_t broydenUpdates() const {
+        return m_broydenMax;
+    }
+
+    //! Solve the Newton linear systems with the parallel block-tridiagonal
+    //! cyclic reduction solver using *nThreads* workers instead of the
+    //! sequential banded LU factorization (0 restores the banded path,
+    //! which also remains the fallback if the block solve fails).
+    void setBlockSolveThreads(size_t nThreads) {
+        m_blockThreads = nThreads;
+        m_blockSolver.setThreads(nThreads);
+    }
+
+    //! Number of threads of the block-tridiagonal solve mode (0 if the
+    //! banded path is used)
+    //! @see setBlockSolveThreads()
+    size_t blockSolveThreads() const {
+        return m_blockThreads;
+    }
+
     /**
      * Return the factor by which the undamped Newton step 'step0'
      * must be multiplied in order to keep all solution components in
@@ -73,6 +126,38 @@ public:
     void resize(size_t points);
 
 protected:
+    //! Attempt to solve jac * step = -resid with the block-tridiagonal
+    //! solver. Returns `false` if the system structure is unsuitable or the
+    //! solve failed, in which case the banded path should be used.
+    bool solveBlock(OneDim& r, MultiJac& jac, doublereal* step);
+
+    //! Block-tridiagonal cyclic reduction solver
+    //! @see setBlockSolveThreads()
+    BlockTridiagSolver m_blockSolver;
+
+    //! Number of threads of the block-tridiagonal solve mode
+    size_t m_blockThreads = 0;
+
+    int m_nSolveCalls = 0; //!< Number of solve() calls
+    int m_nBacktracks = 0; //!< Number of damping backtracks
+
+    //! Apply the stored Broyden corrections to a base linear-solve result
+    void applyBroyden(doublereal* v) const;
+
+    //! Record a Broyden update from the change of iterate and residual
+    //! since the previous step() call under the same Jacobian
+    void updateBroyden(const doublereal* x, const doublereal* f,
+                       OneDim& r, MultiJac& jac);
+
+    size_t m_broydenMax = 0; //!< Maximum stored Broyden updates (0: off)
+    std::vector<vector_fp> m_updU; //!< Broyden update vectors u
+    std::vector<vector_fp> m_updV; //!< Broyden update vectors v
+    std::vector<vector_fp> m_updZ; //!< Preconditioned update vectors
+    vector_fp m_xPrevB; //!< Iterate at the previous step() call
+    vector_fp m_fPrevB; //!< Residual at the previous step() call
+    bool m_havePrevB = false; //!< `true` if m_xPrevB/m_fPrevB are valid
+    int m_jacEvalsB = -1; //!< Jacobian evaluation count last seen
+
     //! Work arrays of size #m_n used in solve().
     vector_fp m_x, m_stp, m_stp1;
 
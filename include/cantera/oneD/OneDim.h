@@ -307,6 +307,21 @@ public:
         return m_timeSteps;
     }
 
+    //! Evaluate the residuals of the bulk domains concurrently on the
+    //! shared worker pool during full residual evaluations.
+    /*!
+     * Each bulk domain writes only its own residual rows and reads the
+     * shared solution vector; the connector domains coupling them run
+     * afterwards, so the pipeline dependency is respected. The domains
+     * must not share mutable objects (each needs its own phase/kinetics
+     * instances) - the usual configuration, but not enforced here.
+     * Composes with the per-domain threaded chemistry: nested parallel
+     * sections degrade gracefully to serial execution inside workers.
+     */
+    void setParallelDomains(bool parallel) {
+        m_parallel_domains = parallel;
+    }
+
     //! Set a function that will be called every time #eval is called.
     //! Can be used to provide keyboard interrupt support in the high-level
     //! language interfaces.
@@ -342,6 +357,21 @@ protected:
     std::vector<Domain1D*> m_dom, m_connect, m_bulk;
 
     bool m_init;
+    //! Boolean flag selecting concurrent bulk-domain residual evaluation
+    //! @see setParallelDomains()
+    bool m_parallel_domains = false;
+
+public:
+    //! Number of failed (backtracked) time steps since construction; part
+    //! of the structured convergence telemetry
+    int nTimeStepFails() const {
+        return m_nTimeStepFails;
+    }
+
+protected:
+    //! Number of failed time steps
+    int m_nTimeStepFails = 0;
+
     std::vector<size_t> m_nvars;
     std::vector<size_t> m_loc;
     vector_int m_mask;
@@ -10,6 +10,8 @@
 
 #include "OneDim.h"
 
+#include <functional>
+
 namespace Cantera
 {
 
@@ -139,6 +141,67 @@ public:
      */
     void restore(const std::string& fname, const std::string& id, int loglevel=2);
 
+    //! Solve over a sequence of parameter points with continuation.
+    /*!
+     * For each point, *apply* installs the parameter value (inlet
+     * composition, pressure, strain rate, ...) and the simulation is
+     * solved with grid refinement, starting from the converged solution of
+     * the previous point. A failed solve restores the last converged
+     * state and retries with the parameter step bisected, up to
+     * *maxBisect* times; unreachable points are marked and the sweep
+     * continues from the last converged state. Returns one status per
+     * point: 1 converged, -1 failed.
+     *
+     * The driver is deliberately free of MPI: a (phi, T, P) table is
+     * embarrassingly parallel, so each MPI rank runs its own contiguous
+     * slice of points with this driver and writes its own results (for
+     * example via saveBinary()), with no communication needed.
+     *
+     * @param points  parameter values in sweep order
+     * @param apply  callback installing one parameter value
+     * @param loglevel  amount of diagnostic output
+     * @param maxBisect  maximum bisections of a failing parameter step
+     */
+    std::vector<int> solveSweep(const vector_fp& points,
+                                const std::function<void(Sim1D&, double)>& apply,
+                                int loglevel=0, size_t maxBisect=3);
+
+    //! Aggregated solver statistics: per-solve grid sizes, function and
+    //! Jacobian evaluation counts and times, and time step counts, in the
+    //! same layout as ReactorNet::solverStats(). Schedulers can use these
+    //! to detect pathologically expensive solves without wall-time
+    //! postmortems.
+    AnyMap solverStats();
+
+    //! Save the current solution to a compact binary checkpoint file.
+    /*!
+     * The checkpoint holds a small header (per-domain identifiers, sizes and
+     * grids) followed by the raw solution vector, and is intended for fast
+     * save/restore cycles such as continuation databases; it does not
+     * replace the YAML format for archival, as it stores no mechanism or
+     * settings metadata.
+     *
+     * @param fname  name of the checkpoint file
+     */
+    void saveBinary(const std::string& fname);
+
+    //! Restore a solution from a binary checkpoint written by saveBinary().
+    /*!
+     * The simulation must be configured with the same domains (matching
+     * identifiers and component counts) as when the checkpoint was written.
+     * By default the grids are restored from the checkpoint; with
+     * *keepGrid* set, the current grids are kept and each domain's
+     * solution is transferred by a single index-merged interpolation sweep
+     * over the source grid - O(n+m) per domain for all components
+     * together, with no per-point searches - which is what per-step
+     * regridding continuation chains need.
+     *
+     * @param fname  name of the checkpoint file
+     * @param keepGrid  keep the current grids and interpolate the
+     *     checkpoint solution onto them
+     */
+    void restoreBinary(const std::string& fname, bool keepGrid=false);
+
     //! @}
 
     // @deprecated  To be removed after Cantera 3.0 (unused)
@@ -161,6 +224,21 @@ public:
         OneDim::eval(npos, m_x.data(), resid, rdt, 0);
     }
 
+    //! Coarsen the grids for nested-iteration cold starts.
+    /*!
+     * Each domain grid is replaced by a coarsened version keeping the
+     * endpoints and every *stride*-th interior point, with the current
+     * solution transferred to the remaining points. Converging on the
+     * coarse grid first and then letting solve() with grid refinement
+     * prolongate back to the fine resolution (refinement interpolates the
+     * converged solution as the Newton initial guess of each finer level)
+     * is substantially faster than a cold start on the fine grid.
+     *
+     * @param stride  keep every stride-th interior point (at least 2)
+     * @returns  number of grid points removed
+     */
+    int coarsenGrid(size_t stride);
+
     //! Refine the grid in all domains.
     int refine(int loglevel=0);
 
@@ -266,6 +344,10 @@ public:
     }
 
 protected:
+    //! Number of grid refinements performed; structured telemetry
+    //! @see solverStats()
+    int m_nRegrids = 0;
+
     //! the solution vector
     vector_fp m_x;
 
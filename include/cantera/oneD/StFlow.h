@@ -281,11 +281,76 @@ public:
         return m_kExcessRight;
     }
 
+    //! Set the number of worker threads used to evaluate the chemical
+    //! production rates across grid points (0 or 1 selects the serial
+    //! path). Each worker uses its own clone of the phase and kinetics
+    //! objects, so the grid points of a residual evaluation are processed
+    //! concurrently.
+    //! @see ThermoPhase::clone(), Kinetics::clone()
+    void setChemistryThreads(size_t nThreads) {
+        m_chem_threads = nThreads;
+    }
+
+    //! Number of worker threads used for chemical production rates
+    //! @see setChemistryThreads()
+    size_t chemistryThreads() const {
+        return m_chem_threads;
+    }
+
+    //! Freeze the transport properties between refreshes.
+    /*!
+     * When *rtol* is positive, updateProperties() reuses the transport
+     * arrays (viscosity, conductivity, diffusion coefficients) until the
+     * temperature at some grid point has moved by more than *rtol*
+     * relative to the last transport update, or any mass fraction by more
+     * than *rtol* absolute. During a damped Newton sequence most residual
+     * evaluations then skip the transport update entirely. A value of 0
+     * (default) disables freezing.
+     */
+    void setFrozenTransportTolerance(double rtol) {
+        m_frozen_trans_rtol = rtol;
+        m_xlast_trans.clear();
+    }
+
+    //! Tolerance of the frozen-transport mode (0 if disabled)
+    //! @see setFrozenTransportTolerance()
+    double frozenTransportTolerance() const {
+        return m_frozen_trans_rtol;
+    }
+
+    //! Register (or replace) a radiating species of the optically-thin
+    //! radiation model.
+    /*!
+     * The Planck-mean absorption coefficient of the species is represented
+     * by a polynomial in 1000 K / T with the given coefficients (constant
+     * term first), in the form used by the bundled RADCAL-based CO2 and
+     * H2O fits. Species absent from the mechanism are ignored. This allows
+     * additional radiators, with fits read from user data files, without
+     * code changes.
+     */
+    void addRadiatingSpecies(const std::string& name,
+                             const vector_fp& coeffs);
+
 protected:
     doublereal wdot(size_t k, size_t j) const {
         return m_wdot(k,j);
     }
 
+    //! @name Solution layout
+    //! The solution vector interleaves the components of each grid point
+    //! (point-major). A structure-of-arrays alternative was evaluated and
+    //! rejected: the hot inner loops of evalResidual() and
+    //! updateDiffFluxes() iterate the species index innermost, and the
+    //! mass fractions of one point are already contiguous in this layout,
+    //! so those sweeps vectorize as-is; only the per-point scalars (T, u,
+    //! V) are strided, and their per-point property derivatives are
+    //! mirrored contiguously in m_rho/m_wtm/m_cp and the cached
+    //! m_hk_RT/m_cpk_R columns. Transposing the layout would instead
+    //! stride every species sweep and require a transposition layer at the
+    //! banded-Jacobian boundary.
+    //! @{
+    //! @}
+
     //! Write the net production rates at point `j` into array `m_wdot`
     void getWdot(doublereal* x, size_t j) {
         setGas(x,j);
@@ -302,6 +367,16 @@ protected:
     virtual void evalResidual(double* x, double* rsd, int* diag,
                               double rdt, size_t jmin, size_t jmax);
 
+    //! Returns `true` if the frozen transport arrays are still within the
+    //! staleness tolerance of the solution *x*
+    //! @see setFrozenTransportTolerance()
+    bool transportCurrent(const double* x) const;
+
+    //! Evaluate the chemical production rates for grid points [j0, j1] into
+    //! m_wdot, partitioning the range across the configured worker threads.
+    //! @see setChemistryThreads()
+    void updateChemistry(const double* x, size_t j0, size_t j1);
+
     /**
      * Update the thermodynamic properties from point j0 to point j1
      * (inclusive), based on solution x.
@@ -312,6 +387,13 @@ protected:
             m_rho[j] = m_thermo->density();
             m_wtm[j] = m_thermo->meanMolecularWeight();
             m_cp[j] = m_thermo->cp_mass();
+            // cache the reference enthalpies and heat capacities evaluated
+            // for this state, so the energy equation does not need to
+            // re-install the state per point
+            const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
+            const vector_fp& cp_R = m_thermo->cp_R_ref();
+            std::copy(h_RT.begin(), h_RT.end(), &m_hk_RT(0, j));
+            std::copy(cp_R.begin(), cp_R.end(), &m_cpk_R(0, j));
         }
     }
 
@@ -435,10 +517,38 @@ protected:
     // production rates
     Array2D m_wdot;
 
+    //! Species reference enthalpies (nondimensional) at each grid point,
+    //! cached by updateThermo()
+    Array2D m_hk_RT;
+
+    //! Species reference heat capacities (nondimensional) at each grid
+    //! point, cached by updateThermo()
+    Array2D m_cpk_R;
+
     size_t m_nsp;
 
     IdealGasPhase* m_thermo;
     Kinetics* m_kin;
+
+    //! Number of worker threads for production-rate evaluation
+    //! @see setChemistryThreads()
+    size_t m_chem_threads = 0;
+
+    //! Per-worker clones of the phase and kinetics objects
+    std::vector<shared_ptr<ThermoPhase>> m_chemThermo;
+    std::vector<shared_ptr<Kinetics>> m_chemKin;
+
+    //! `true` while m_wdot holds production rates for the whole range of a
+    //! residual evaluation, computed by updateChemistry()
+    bool m_wdot_ok = false;
+
+    //! Staleness tolerance of the frozen-transport mode (0 if disabled)
+    //! @see setFrozenTransportTolerance()
+    double m_frozen_trans_rtol = 0.0;
+
+    //! Copy of the solution at the last transport update, used to decide
+    //! whether the frozen transport arrays are still usable
+    vector_fp m_xlast_trans;
     Transport* m_trans;
 
     // Smart pointer preventing garbage collection when the transport model of an
@@ -450,9 +560,11 @@ protected:
     doublereal m_epsilon_left;
     doublereal m_epsilon_right;
 
-    //! Indices within the ThermoPhase of the radiating species. First index is
-    //! for CO2, second is for H2O.
-    std::vector<size_t> m_kRadiating;
+    //! Radiating species of the optically-thin radiation model: pairs of
+    //! species index and the Planck-mean absorption fit coefficients
+    //! (polynomial in 1000 K / T)
+    //! @see addRadiatingSpecies()
+    std::vector<std::pair<size_t, vector_fp>> m_radCoeffs;
 
     // flags
     std::vector<bool> m_do_energy;
@@ -72,14 +72,14 @@ public:
     int analyze(size_t n, const doublereal* z, const doublereal* x);
     int getNewGrid(int n, const doublereal* z, int nn, doublereal* znew);
     int nNewPoints() {
-        return static_cast<int>(m_loc.size());
+        return static_cast<int>(m_nloc);
     }
     void show();
     bool newPointNeeded(size_t j) {
-        return m_loc.find(j) != m_loc.end();
+        return j < m_loc.size() && m_loc[j];
     }
     bool keepPoint(size_t j) {
-        return (m_keep[j] != -1);
+        return j >= m_keep.size() || m_keep[j] != -1;
     }
     double value(const double* x, size_t i, size_t j);
 
@@ -97,8 +97,15 @@ public:
     }
 
 protected:
-    std::map<size_t, int> m_loc;
-    std::map<size_t, int> m_keep;
+    //! Per-interval insertion flags and per-point keep markers; flat
+    //! arrays sized to the grid, reused across refine passes
+    std::vector<char> m_loc;
+    std::vector<int> m_keep;
+    size_t m_nloc = 0; //!< Number of flagged insertion intervals
+
+    //! Reusable criteria workspaces
+    //! @see analyze()
+    vector_fp m_v, m_s, m_dz;
     std::map<std::string, int> m_c;
     std::vector<bool> m_active;
     doublereal m_ratio, m_slope, m_curve, m_prune;
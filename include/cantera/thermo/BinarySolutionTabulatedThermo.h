@@ -225,6 +225,16 @@ protected:
      */
     double interpolate(const double x, const vector_fp& inputData) const;
 
+    //! Locate the table interval containing *x*, starting from the interval
+    //! of the previous query (state-of-charge sweeps move smoothly, so the
+    //! cached interval nearly always hits)
+    size_t findInterval(const double x) const;
+
+    //! Linear interpolation of tabulated data at *x* within interval *i*
+    //! located by findInterval(); one search serves all property tables
+    double interpolateAt(const double x, size_t i,
+                         const vector_fp& inputData) const;
+
     //! Numerical derivative of the molar volume table
     /*!
      *  Tabulated values are only interpolated within the limits of the provided mole
@@ -251,6 +261,10 @@ protected:
 
     //! Vector for storing tabulated thermo
     vector_fp m_molefrac_tab;
+
+    //! Interval of the most recent table query
+    //! @see findInterval()
+    mutable size_t m_lastInterval = 1;
     vector_fp m_enthalpy_tab;
     vector_fp m_entropy_tab;
     vector_fp m_molar_volume_tab;
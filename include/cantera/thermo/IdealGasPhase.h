@@ -472,6 +472,8 @@ public:
     //! @{
 
     virtual void getChemPotentials(doublereal* mu) const;
+    virtual void getPartialMolarAll(double* hbar, double* sbar, double* cpbar,
+                                    double* mu) const;
     virtual void getPartialMolarEnthalpies(doublereal* hbar) const;
     virtual void getPartialMolarEntropies(doublereal* sbar) const;
     virtual void getPartialMolarIntEnergies(doublereal* ubar) const;
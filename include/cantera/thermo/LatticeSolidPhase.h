@@ -481,6 +481,13 @@ protected:
 private:
     //! Update the reference thermodynamic functions
     void _updateThermo() const;
+
+    //! Composition number of the parent phase at the last sublattice push
+    mutable int m_stateNumLast = -1;
+
+    //! Mole fraction vector pushed to the sublattices last, used to limit
+    //! pushes to the sublattices whose slice actually changed
+    mutable vector_fp m_xlast;
 };
 }
 
@@ -201,6 +201,10 @@ protected:
     //! Mark species *k* as having its thermodynamic data installed
     void markInstalled(size_t k);
 
+    //! Rebuild the contiguous coefficient cache for NASA two-range
+    //! parameterizations used by the batched evaluation in update()
+    void updateNasa2Cache() const;
+
     typedef std::pair<size_t, shared_ptr<SpeciesThermoInterpType> > index_STIT;
     typedef std::map<int, std::vector<index_STIT> > STIT_map;
     typedef std::map<int, vector_fp> tpoly_map;
@@ -228,6 +232,20 @@ protected:
     //! reference pressure (Pa)
     doublereal m_p0;
 
+    //! Species indices of NASA two-range parameterizations, in the order of
+    //! the coefficient cache
+    mutable std::vector<size_t> m_nasa2_index;
+
+    //! Midrange temperatures of the cached NASA two-range parameterizations
+    mutable vector_fp m_nasa2_tmid;
+
+    //! Cached NASA polynomial coefficients; 14 contiguous values per species
+    //! (7 low-temperature followed by 7 high-temperature coefficients)
+    mutable vector_fp m_nasa2_coeffs;
+
+    //! Boolean flag indicating whether the NASA coefficient cache is current
+    mutable bool m_nasa2_ok;
+
     //! indicates if data for species has been installed
     std::vector<bool> m_installed;
 };
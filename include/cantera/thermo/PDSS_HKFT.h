@@ -203,6 +203,15 @@ private:
      */
     doublereal g(const doublereal temp, const doublereal pres, const int ifunc = 0) const;
 
+    //! Uncached evaluation of the g function
+    /*!
+     * Implements the calculation behind g(), which memoizes results shared
+     * by all PDSS_HKFT instances using the same water standard state.
+     * @copydetails g()
+     */
+    doublereal gCalc(const doublereal temp, const doublereal pres,
+                     const int ifunc = 0) const;
+
     //! Difference function f appearing in the formulation
     /*!
      * Function f appearing in the Johnson et al formulation of omega_j
@@ -254,6 +254,10 @@ protected:
      */
     double m_aAlpha_mix;
 
+    //! Temperature at which the species alpha functions and the binary
+    //! aAlpha matrix were last evaluated
+    double m_alphaTemp;
+
     // Vectors required to store species-specific a_coeff, b_coeff, alpha, kappa
     // and other derivatives. Length = m_kk.
     vector_fp m_b_coeffs;
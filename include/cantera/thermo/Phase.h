@@ -13,6 +13,8 @@
 #include "cantera/thermo/Elements.h"
 #include "cantera/base/ValueCache.h"
 
+#include <unordered_map>
+
 namespace Cantera
 {
 
@@ -237,6 +239,15 @@ public:
     //!             the value \ref npos is returned.
     size_t speciesIndex(const std::string& name) const;
 
+    //! Resolve a batch of species names in one call.
+    /*!
+     * Returns the index of each name (npos for unknown names), amortizing
+     * call overhead for mechanism-aware postprocessors that resolve many
+     * names at once.
+     */
+    std::vector<size_t> speciesIndices(
+        const std::vector<std::string>& names) const;
+
     //! Name of the species with index k
     //!     @param k index of the species
     std::string speciesName(size_t k) const;
@@ -494,6 +505,34 @@ public:
     //!          length greater than or equal to the number of species.
     void getMoleFractions(double* const x) const;
 
+    //! A composition resolved once against this phase: parallel arrays of
+    //! species indices and amounts. Compiling a composition string (or
+    //! map) once and re-applying the compiled form turns repeated
+    //! boundary-condition updates into an indexed scatter with no string
+    //! parsing or name lookups.
+    //! @see compileComposition()
+    struct IndexedComposition {
+        std::vector<size_t> indices; //!< Species indices
+        vector_fp values; //!< Amounts (moles or mass, by use)
+    };
+
+    //! Resolve a composition string such as "CH4:1, O2:2, N2:7.52" (or a
+    //! composition map) against this phase once, for repeated application
+    //! via the IndexedComposition setter overloads. Unknown species raise
+    //! an exception.
+    IndexedComposition compileComposition(const std::string& comp) const;
+
+    //! @copydoc compileComposition(const std::string&) const
+    IndexedComposition compileComposition(const compositionMap& comp) const;
+
+    //! Set the mole fractions from a compiled composition; species not
+    //! listed are set to zero
+    void setMoleFractions(const IndexedComposition& comp);
+
+    //! Set the mass fractions from a compiled composition; species not
+    //! listed are set to zero
+    void setMassFractions(const IndexedComposition& comp);
+
     //! Set the mole fractions to the specified values.
     //! There is no restriction on the sum of the mole fraction vector.
     //! Internally, the Phase object will normalize this vector before storing
@@ -528,7 +567,11 @@ public:
     //! Set the mass fractions to the specified values without normalizing.
     //! This is useful when the normalization condition is being handled by
     //! some other means, for example by a constraint equation as part of a
-    //! larger set of equations.
+    //! larger set of equations. This is also the trusted-input fast path for
+    //! callers (such as CFD couplings) that guarantee normalized,
+    //! non-negative compositions: no clipping, normalization or validation
+    //! is performed, and supplying unnormalized input silently yields
+    //! inconsistent intensive properties.
     //!     @param y  Input vector of mass fractions. Length is m_kk.
     virtual void setMassFractions_NoNorm(const double* const y);
 
@@ -880,6 +923,9 @@ public:
     void moleFractionsToMassFractions(const double* X, double* Y) const;
 
 protected:
+    //! Scratch vector for the compiled-composition setters
+    mutable vector_fp m_setScratch;
+
     //! Ensure that phase is compressible.
     //! An error is raised if the state is incompressible
     //!     @param setter  name of setter (used for exception handling)
@@ -988,10 +1034,13 @@ private:
     std::vector<std::string> m_speciesNames;
 
     //! Map of species names to indices
-    std::map<std::string, size_t> m_speciesIndices;
+    //! Hashed lookup table from species name (and registered aliases) to
+    //! index; an unordered map, so name resolution is O(1) with no string
+    //! comparisons along a tree path
+    std::unordered_map<std::string, size_t> m_speciesIndices;
 
     //! Map of lower-case species names to indices
-    std::map<std::string, size_t> m_speciesLower;
+    std::unordered_map<std::string, size_t> m_speciesLower;
 
     size_t m_mm; //!< Number of elements.
     vector_fp m_atomicWeights; //!< element atomic weights (kg kmol-1)
@@ -130,6 +130,21 @@ public:
     //! @param  x The shape factor
     void setIsotropicShapeFactor(double x);
 
+    //! Evaluate EEDF-weighted integrals of several integrands in one pass.
+    /*!
+     * Each integrand is sampled on the electron energy grid (nPoints
+     * values); the integrals against the current electron energy
+     * distribution are evaluated with the configured quadrature method as
+     * vectorized sweeps, so many cross sections can be folded with one
+     * distribution without per-integral setup.
+     *
+     * @param n  number of integrands
+     * @param integrands  n blocks of nPoints samples
+     * @param[out] results  the n integral values
+     */
+    void integrateDistribution(size_t n, const double* integrands,
+                               double* results) const;
+
     //! The shape factor of isotropic electron energy distribution
     double isotropicShapeFactor() const {
         return m_isotropicShapeFactor;
@@ -230,6 +245,12 @@ protected:
     //! #m_electronTemp
     void updateElectronTemperatureFromEnergyDist();
 
+    //! Shape factor for which the isotropic-distribution coefficients are
+    //! cached
+    double m_shapeFactorCached = -1.0;
+    double m_isotropicC1 = 0.0; //!< Cached isotropic-distribution coefficient
+    double m_isotropicC2 = 0.0; //!< Cached isotropic-distribution coefficient
+
     //! Electron energy distribution norm
     void normalizeElectronEnergyDistribution();
 
@@ -350,6 +350,9 @@ protected:
      */
     mutable vector_fp m_logsize;
 
+    //! Cached reciprocal site sizes, used by the coverage conversions
+    vector_fp m_invSize;
+
 private:
     //! Update the species reference state thermodynamic functions
     /*!
@@ -97,6 +97,9 @@ enum class ThermoBasis
  * @ingroup thermoprops
  * @ingroup phases
  */
+
+class ChemEquil;
+
 class ThermoPhase : public Phase
 {
 public:
@@ -505,6 +508,26 @@ public:
      */
     void getElectrochemPotentials(doublereal* mu) const;
 
+    //! Fused evaluation of partial molar enthalpies, entropies, heat
+    //! capacities and chemical potentials.
+    /*!
+     * Output arrays that are not needed may be null. The generic
+     * implementation forwards to the individual getters; phase models may
+     * override it to evaluate the shared reference-state polynomials once
+     * for all requested properties.
+     *
+     * @param[out] hbar  partial molar enthalpies [J/kmol]; length m_kk or null
+     * @param[out] sbar  partial molar entropies [J/kmol/K]; length m_kk or null
+     * @param[out] cpbar  partial molar heat capacities [J/kmol/K];
+     *     length m_kk or null
+     * @param[out] mu  chemical potentials [J/kmol]; length m_kk or null
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual void getPartialMolarAll(double* hbar, double* sbar, double* cpbar,
+                                    double* mu) const;
+
     //! Returns an array of partial molar enthalpies for the species
     //! in the mixture. Units (J/kmol)
     /*!
@@ -818,6 +841,20 @@ public:
      */
     virtual void setState_TPX(doublereal t, doublereal p, const std::string& x);
 
+    //! Seed the temperature iteration of the next property-pair state
+    //! setter call.
+    /*!
+     * The nested Newton iterations of setState_HP(), setState_UV(),
+     * setState_SP() and setState_SV() start from the phase's current
+     * temperature. When a better guess is available - the neighboring
+     * cell or the previous time step in a time-marching code - supplying
+     * it here (consumed by the next setter call) saves several iterations
+     * per call without perturbing the current state.
+     */
+    void seedPropertyPairSolver(double T) {
+        m_propertyPairSeed = T;
+    }
+
     //! Set the internally stored temperature (K), pressure (Pa), and mass
     //! fractions of the phase.
     /*!
@@ -831,6 +868,32 @@ public:
      */
     virtual void setState_TPY(doublereal t, doublereal p, const doublereal* y);
 
+    //! Evaluate properties for an array of thermodynamic states in one pass.
+    /*!
+     * Each state is defined by its temperature, pressure and mass fraction
+     * array. Output arrays that are not needed may be null. The generic
+     * implementation sweeps the states through setState_TPY(); phase models
+     * may override it to pipeline their property evaluations. The
+     * thermodynamic state of the phase is modified by this method.
+     *
+     * @param nStates  number of thermodynamic states
+     * @param T  array of temperatures [K]; length nStates
+     * @param P  array of pressures [Pa]; length nStates
+     * @param Y  array of mass fractions; length nStates * nSpecies(), with
+     *     the fractions of each state stored contiguously
+     * @param[out] rho  mass densities [kg/m^3]; length nStates or null
+     * @param[out] h  specific enthalpies [J/kg]; length nStates or null
+     * @param[out] s  specific entropies [J/kg/K]; length nStates or null
+     * @param[out] cp  specific heats at constant pressure [J/kg/K];
+     *     length nStates or null
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual void evaluateStates(size_t nStates, const double* T,
+                                const double* P, const double* Y, double* rho,
+                                double* h, double* s, double* cp);
+
     //! Set the internally stored temperature (K), pressure (Pa), and mass
     //! fractions of the phase
     /*!
@@ -1631,6 +1694,22 @@ public:
     virtual void setParameters(const AnyMap& phaseNode,
                                const AnyMap& rootNode=AnyMap());
 
+    //! Create a new ThermoPhase object of the same type, sharing the
+    //! immutable species definitions of this phase.
+    /*!
+     * The clone receives the model parameters reported by parameters() and
+     * the Species objects of this phase (shared, not copied), and is set to
+     * the same thermodynamic state. Cloning avoids re-parsing any input
+     * files and duplicates only the per-phase state, so each worker thread
+     * of a parallel application can be given its own lightweight copy.
+     * Phase models requiring data beyond parameters() and the species
+     * definitions may need to override this method.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual shared_ptr<ThermoPhase> clone() const;
+
     //! Returns the parameters of a ThermoPhase object such that an identical
     //! one could be reconstructed using the newPhase(AnyMap&) function.
     //! @param withInput  If true, include additional input data fields associated
@@ -1653,6 +1732,11 @@ public:
 
     virtual void invalidateCache();
 
+    //! Per-entry hit/miss statistics of this phase's property cache.
+    //! Populated only when built with -DCT_CACHE_STATS=1.
+    //! @see ValueCache::getStats()
+    AnyMap getCacheStats() const;
+
     //! @}
     //! @name  Derivatives of Thermodynamic Variables needed for Applications
     //! @{
@@ -1767,6 +1851,10 @@ public:
     //! @}
 
 protected:
+    //! Reusable element-potential equilibrium solver, kept across
+    //! equilibrate() calls so its phase-sized workspaces are allocated once
+    shared_ptr<ChemEquil> m_chemEquilSolver;
+
     //! Store the parameters of a ThermoPhase object such that an identical
     //! one could be reconstructed using the newPhase(AnyMap&) function. This
     //! does not include user-defined fields available in input().
@@ -1777,6 +1865,11 @@ protected:
     virtual void getCsvReportData(std::vector<std::string>& names,
                                   std::vector<vector_fp>& data) const;
 
+    //! One-shot temperature seed for the property-pair state setters
+    //! (Undef when unset)
+    //! @see seedPropertyPairSolver()
+    double m_propertyPairSeed = Undef;
+
     //! Pointer to the calculation manager for species reference-state
     //! thermodynamic properties
     /*!
@@ -195,6 +195,16 @@ protected:
 
     //! Last delta that was used to calculate polynomials
     doublereal DELTAsave;
+
+    //! Memoized values of the residual Helmholtz sums and their derivatives
+    //! (phiR, phiR_d, phiR_dd, phiR_t, phiR_tt, phiR_dt) at the state set by
+    //! tdpolycalc(). The sums involve dozens of transcendental terms, and the
+    //! property evaluations in WaterPropsIAPWS request the same derivatives
+    //! repeatedly at a fixed state.
+    mutable doublereal m_phiR_cached[6];
+
+    //! Validity flags for #m_phiR_cached
+    mutable bool m_phiR_valid[6];
 };
 
 } // namespace Cantera
@@ -176,6 +176,17 @@ public:
 
 protected:
     double T, Rho;
+
+    //! Build the lazily constructed saturation-curve table used to start
+    //! the Tsat() iteration
+    //! @see Tsat()
+    void buildSatTable();
+
+    //! Saturation-curve table: temperatures and the logarithms of the
+    //! corresponding saturation pressures, built lazily by buildSatTable().
+    //! A single entry marks a substance where table construction failed.
+    std::vector<double> m_satT;
+    std::vector<double> m_satLogP;
     double Tslast, Rhf, Rhv;
     double Pst;
     double m_energy_offset;
@@ -95,6 +95,22 @@ public:
                                 const doublereal* const state2, const doublereal delta,
                                 doublereal* const fluxes);
 
+    //! Batched evaluation of molar fluxes for several state pairs.
+    /*!
+     * Equivalent to calling getMolarFluxes() per pair; pairs sharing a
+     * midpoint state reuse a single factorization of the H matrix.
+     *
+     * @param nPairs  number of state pairs
+     * @param state1  array of nPairs state vectors at point 1, each holding
+     *     temperature, density and the mass fractions
+     * @param state2  array of nPairs state vectors at point 2
+     * @param delta   distances between the points; length nPairs
+     * @param[out] fluxes  molar fluxes; nPairs blocks of nSpecies values
+     */
+    void getMolarFluxes(size_t nPairs, const double* state1,
+                        const double* state2, const double* delta,
+                        double* fluxes);
+
     // new methods added in this class
 
     //! Set the porosity (dimensionless)
@@ -263,6 +279,22 @@ private:
     //! Update-to-date variable for Binary diffusion coefficients
     bool m_bulk_ok;
 
+    //! `true` if the inverted H matrix in m_multidiff is current with
+    //! respect to the state and the pore geometry
+    bool m_multidiff_ok = false;
+
+    //! Composition number of the phase at the last H matrix update
+    int m_stateNum = -1;
+
+    //! Pressure [Pa] at the last H matrix update
+    doublereal m_pres = -1.0;
+
+    //! Mole fractions at the last H matrix update (unclipped)
+    vector_fp m_xRaw;
+
+    //! Scratch vector for comparing mole fractions
+    vector_fp m_xLast;
+
     //! Porosity
     doublereal m_porosity;
 
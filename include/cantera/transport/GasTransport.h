@@ -9,6 +9,7 @@
 #define CT_GAS_TRANSPORT_H
 
 #include "Transport.h"
+#include "PolyPropertyEngine.h"
 #include "cantera/numerics/DenseMatrix.h"
 
 namespace Cantera
@@ -68,6 +69,13 @@ public:
      */
     virtual void getBinaryDiffCoeffs(const size_t ld, doublereal* const d);
 
+    //! Returns the binary diffusion coefficients [m^2/s] in packed upper
+    //! triangular storage, avoiding the unpacking copy of
+    //! getBinaryDiffCoeffs(). Entry `ic` holds the coefficient of the
+    //! species pair (i, j >= i) in row-major triangle order; the output
+    //! array must hold nSpecies*(nSpecies+1)/2 values.
+    void getBinaryDiffCoeffsPacked(double* const d);
+
     //! Returns the Mixture-averaged diffusion coefficients [m^2/s].
     /*!
      * Returns the mixture averaged diffusion coefficients for a gas,
@@ -88,6 +96,18 @@ public:
      */
     virtual void getMixDiffCoeffs(doublereal* const d);
 
+    //! Fused evaluation of the mixture-averaged diffusion coefficient
+    //! variants.
+    /*!
+     * Computes any subset of the mole-fraction-gradient (as
+     * getMixDiffCoeffs()), mole-based (getMixDiffCoeffsMole()) and
+     * mass-based (getMixDiffCoeffsMass()) coefficients from a single
+     * traversal of the binary diffusion matrix; outputs that are not
+     * needed may be null. Flamelet codes needing the mass- and mole-based
+     * forms together thus pay one K^2 pass instead of two.
+     */
+    void getMixDiffCoeffsAll(double* dMixAvg, double* dMole, double* dMass);
+
     //! Returns the mixture-averaged diffusion coefficients [m^2/s].
     //! These are the coefficients for calculating the molar diffusive fluxes
     //! from the species mole fraction gradients, computed according to
@@ -161,10 +181,19 @@ public:
         return m_mode == CK_Mode;
     }
 
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo=nullptr) const;
+
 protected:
     GasTransport(ThermoPhase* thermo=0);
 
     virtual void update_T();
+
+    //! Install *T* as the temperature at which the temperature-dependent
+    //! transport properties are evaluated, updating derived quantities and
+    //! invalidating stale fits. Factored out of update_T() so that derived
+    //! models may evaluate properties at a temperature other than the exact
+    //! phase temperature (for example, at a table node).
+    void updateTransportTemperature(double T);
     virtual void update_C() = 0;
 
     //! Update the temperature-dependent viscosity terms.
@@ -233,6 +262,23 @@ protected:
      */
     void fitCollisionIntegrals(MMCollisionInt& integrals);
 
+    //! Return the path of the on-disk cache file for the property fits, or
+    //! an empty string if caching is disabled. Caching is enabled by setting
+    //! the environment variable CANTERA_TRANSPORT_CACHE to a writable
+    //! directory; the file name includes a hash of all inputs the fits
+    //! depend on (collision parameters, temperature limits, fit mode and
+    //! species identities).
+    std::string fitCachePath() const;
+
+    //! Load previously fitted viscosity, conductivity and binary diffusion
+    //! polynomials from the cache file at *path*. Returns `false` (leaving
+    //! the object unmodified) if the file is missing, of a different format
+    //! version, or inconsistent with the current mechanism.
+    bool loadFits(const std::string& path);
+
+    //! Write the fitted property polynomials to the cache file at *path*.
+    void saveFits(const std::string& path) const;
+
     //! Generate polynomial fits to the viscosity and conductivity
     /*!
      * If CK_mode, then the fits are of the form
@@ -329,6 +375,10 @@ protected:
     //! viscosity as a function of temperature.
     std::vector<vector_fp> m_visccoeffs;
 
+    //! Vectorized evaluator over #m_visccoeffs used by
+    //! updateSpeciesViscosities()
+    PolyPropertyEngine m_viscPoly;
+
     //! Local copy of the species molecular weights.
     vector_fp m_mw;
 
@@ -347,6 +397,17 @@ protected:
      */
     DenseMatrix m_wratkj1;
 
+    //! Holds square root of (1/(8*(1 + mw[j]/mw[k]))); precomputed reciprocal
+    //! of the constant factor of the Wilke combination rule
+    DenseMatrix m_rwratkj1;
+
+    //! Reciprocals of the square roots of the species viscosities
+    vector_fp m_rsqvisc;
+
+    //! During clone(), points at the object whose fitted property tables are
+    //! copied instead of being recomputed; null otherwise
+    const GasTransport* m_fitDonor = nullptr;
+
     //! vector of square root of species viscosities sqrt(kg /m /s). These are
     //! used in Wilke's rule to calculate the viscosity of the solution.
     //! length = m_kk.
@@ -393,6 +454,14 @@ protected:
      */
     std::vector<vector_fp> m_diffcoeffs;
 
+    //! Vectorized evaluator over #m_diffcoeffs used by updateDiff_T()
+    PolyPropertyEngine m_diffPoly;
+
+    //! Binary diffusion coefficients at unit pressure in packed upper
+    //! triangular storage; entry ic corresponds to the pair (i, j >= i) in
+    //! row-major triangle order
+    vector_fp m_bdiff_packed;
+
     //! Matrix of binary diffusion coefficients at the reference pressure and
     //! the current temperature Size is nsp x nsp.
     DenseMatrix m_bdiff;
@@ -404,6 +473,10 @@ protected:
      */
     std::vector<vector_fp> m_condcoeffs;
 
+    //! Vectorized evaluator over #m_condcoeffs used by
+    //! MixTransport::updateCond_T()
+    PolyPropertyEngine m_condPoly;
+
     //! Indices for the (i,j) interaction in collision integral fits
     /*!
      *  m_poly[i][j] contains the index for (i,j) interactions in
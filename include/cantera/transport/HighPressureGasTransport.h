@@ -73,6 +73,10 @@ public:
     friend class TransportFactory;
 
 protected:
+    //! Derive and store the pure-species critical properties on first use
+    //! @see Tcrit_i()
+    void cacheCriticalProperties();
+
     virtual doublereal Tcrit_i(size_t i);
 
     virtual doublereal Pcrit_i(size_t i);
@@ -86,6 +90,13 @@ protected:
     virtual doublereal FQ_i(doublereal Q, doublereal Tr, doublereal MW);
 
     virtual doublereal setPcorr(doublereal Pr, doublereal Tr);
+    //! Cached pure-species critical properties
+    //! @see cacheCriticalProperties()
+    vector_fp m_Tcrit;
+    vector_fp m_Pcrit;
+    vector_fp m_Vcrit;
+    vector_fp m_Zcrit;
+
 };
 }
 #endif
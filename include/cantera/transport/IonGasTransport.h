@@ -81,6 +81,15 @@ public:
     virtual double electricalConductivity();
 
 protected:
+    //! Cached species mobilities and the state at which they were evaluated
+    //! @see getMobilities()
+    vector_fp m_mobi;
+    bool m_mobi_ok = false; //!< `true` if #m_mobi is current
+    double m_mobiTemp = -1.0; //!< Temperature of the cached mobilities
+    double m_mobiPres = -1.0; //!< Pressure of the cached mobilities
+    int m_mobiStateNum = -1; //!< Composition number of the cached mobilities
+
+
     //! setup parameters for n64 model
     void setupN64();
 
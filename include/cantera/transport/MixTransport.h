@@ -110,6 +110,16 @@ public:
      */
     virtual void getMobilities(doublereal* const mobil);
 
+    //! Evaluate the species viscosity and thermal conductivity fits
+    //! together whenever the temperature changes, instead of lazily on
+    //! first use of each. The two fits share the same powers of log(T),
+    //! so the fused evaluation halves the per-update sweep overhead for
+    //! callers (like the flame solvers) that always consume both;
+    //! callers using only one property family should leave this off.
+    void setFusedUpdates(bool fused) {
+        m_fused_updates = fused;
+    }
+
     //! Update the internal parameters whenever the temperature has changed
     /*!
      * This is called whenever a transport property is requested if the
@@ -167,6 +177,10 @@ protected:
      */
     vector_fp m_cond;
 
+    //! Boolean flag selecting fused viscosity/conductivity updates
+    //! @see setFusedUpdates()
+    bool m_fused_updates = false;
+
     //! Internal storage for the calculated mixture thermal conductivity
     /*!
      *  Units = W /m /K
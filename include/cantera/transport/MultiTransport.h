@@ -11,6 +11,7 @@
 
 // Cantera includes
 #include "GasTransport.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -36,6 +37,21 @@ public:
         return (m_mode == CK_Mode) ? "CK_Multi" : "Multi";
     }
 
+    //! Switch the solution of the L matrix system between the dense LU
+    //! factorization and a sparse LU factorization whose symbolic analysis
+    //! is reused while the sparsity pattern is unchanged. The L matrix
+    //! blocks are structurally sparse for large mechanisms, making the
+    //! sparse path considerably faster above roughly 50 species.
+    void setSparseLMatrixMode(bool enable) {
+        m_useSparseL = enable;
+    }
+
+    //! Returns `true` if the sparse L matrix solution path is enabled
+    //! @see setSparseLMatrixMode()
+    bool sparseLMatrixMode() const {
+        return m_useSparseL;
+    }
+
     //! Return the thermal diffusion coefficients (kg/m/s)
     /*!
      * Eqn. (12.126) displays how they are calculated. The reference work is
@@ -144,6 +160,20 @@ protected:
 
     // L matrix quantities
     DenseMatrix m_Lmatrix;
+
+    //! Sparse copy of the L matrix used when the sparse solution mode is
+    //! enabled
+    //! @see setSparseLMatrixMode()
+    Eigen::SparseMatrix<double> m_Lsparse;
+
+    //! Sparse LU solver with reusable symbolic factorization for #m_Lsparse
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> m_sparseLU;
+
+    //! Inner/outer index arrays of the pattern last analyzed by #m_sparseLU
+    std::vector<int> m_sparsePattern;
+
+    //! Boolean flag selecting the sparse L matrix solution path
+    bool m_useSparseL;
     DenseMatrix m_aa;
     vector_fp m_a;
     vector_fp m_b;
@@ -0,0 +1,110 @@
+/**
+ *  @file PolyPropertyEngine.h
+ *    Header for the PolyPropertyEngine helper, which evaluates families of
+ *    transport property polynomial fits for many species or species pairs
+ *    at once (see \ref tranprops).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_POLYPROPERTYENGINE_H
+#define CT_POLYPROPERTYENGINE_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/AlignedAllocator.h"
+
+#include <cmath>
+
+namespace Cantera
+{
+
+//! Evaluates a family of property polynomial fits in powers of log(T) from
+//! coefficient-major contiguous storage.
+/*!
+ * The temperature-dependent transport property fits (species viscosities and
+ * conductivities, binary diffusion coefficients) all follow the pattern
+ * `property = f(poly(logT))`, traditionally evaluated per species with
+ * dot4()/dot5() over one heap-allocated coefficient vector per species. This
+ * helper mirrors the coefficients in coefficient-major contiguous storage,
+ * so that each evaluation is a set of vectorizable sweeps over all entries
+ * of the family, followed by an optional vectorizable exp() pass. It is the
+ * single optimization point shared by the viscosity, conductivity and
+ * diffusion updates.
+ */
+class PolyPropertyEngine
+{
+public:
+    //! Mirror the per-entry coefficient vectors of *coeffs* (which must all
+    //! have the same length) into contiguous storage.
+    void setCoeffs(const std::vector<vector_fp>& coeffs) {
+        m_n = coeffs.size();
+        m_nc = m_n ? coeffs[0].size() : 0;
+        // pad each coefficient row to a whole cache line, so the sweeps in
+        // eval() run over aligned rows
+        m_stride = alignedPadding(m_n);
+        m_flat.assign(m_stride * m_nc, 0.0);
+        for (size_t k = 0; k < m_n; k++) {
+            for (size_t i = 0; i < m_nc; i++) {
+                m_flat[i * m_stride + k] = coeffs[k][i];
+            }
+        }
+    }
+
+    //! Discard the mirrored coefficients, for example after the source fits
+    //! changed
+    void clear() {
+        m_n = 0;
+        m_nc = 0;
+        m_stride = 0;
+        m_flat.clear();
+    }
+
+    //! Returns `true` if no coefficients are installed
+    bool empty() const {
+        return m_n == 0;
+    }
+
+    //! Number of entries (species or species pairs) in the family
+    size_t size() const {
+        return m_n;
+    }
+
+    //! Evaluate all polynomials: `out[k] = poly_k(tempvec)`, where *tempvec*
+    //! holds at least as many powers of log(T) as the fits have coefficients
+    //! (see GasTransport's m_polytempvec)
+    void eval(const double* tempvec, double* out) const {
+        const double* c = m_flat.data();
+        for (size_t k = 0; k < m_n; k++) {
+            out[k] = c[k] * tempvec[0];
+        }
+        for (size_t i = 1; i < m_nc; i++) {
+            double p = tempvec[i];
+            const double* ci = c + i * m_stride;
+            for (size_t k = 0; k < m_n; k++) {
+                out[k] += ci[k] * p;
+            }
+        }
+    }
+
+    //! Evaluate all polynomials and exponentiate:
+    //! `out[k] = exp(poly_k(tempvec))`
+    void evalExp(const double* tempvec, double* out) const {
+        eval(tempvec, out);
+        for (size_t k = 0; k < m_n; k++) {
+            out[k] = std::exp(out[k]);
+        }
+    }
+
+private:
+    size_t m_n = 0; //!< Number of entries in the family
+    size_t m_nc = 0; //!< Number of coefficients per entry
+    size_t m_stride = 0; //!< Padded (cache-line multiple) row stride
+
+    //! Coefficient-major aligned coefficient storage with padded rows
+    aligned_vector_fp m_flat;
+};
+
+}
+
+#endif
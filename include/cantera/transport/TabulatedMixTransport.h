@@ -0,0 +1,82 @@
+/**
+ *  @file TabulatedMixTransport.h
+ *    Headers for the TabulatedMixTransport object, which models transport
+ *    properties in ideal gas solutions by evaluating the mixture-averaged
+ *    rules on a temperature grid
+ *    (see \ref tranprops and \link Cantera::TabulatedMixTransport TabulatedMixTransport \endlink) .
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_TABULATEDMIXTRAN_H
+#define CT_TABULATEDMIXTRAN_H
+
+#include "MixTransport.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+//! Class TabulatedMixTransport evaluates the mixture-averaged transport
+//! properties of MixTransport on a fixed temperature grid: the
+//! temperature-dependent species fits are evaluated at the grid node nearest
+//! to the phase temperature and reused while the temperature stays within
+//! half a grid spacing of that node. Along smooth profiles, as in flame
+//! solvers, this removes nearly all re-evaluations of the species property
+//! fits in exchange for a controlled accuracy epsilon set by the grid
+//! spacing; composition-dependent mixture rules are always evaluated
+//! exactly.
+//! @ingroup tranprops
+class TabulatedMixTransport : public MixTransport
+{
+public:
+    virtual std::string transportModel() const {
+        return "tabulated-mixture";
+    }
+
+    //! Set the temperature grid spacing [K]. The relative property error is
+    //! bounded by roughly (dlnP/dlnT) * deltaT / (2 T); the default of 1 K
+    //! keeps it below 0.1% under typical flame conditions.
+    void setTemperatureStep(double deltaT) {
+        if (deltaT <= 0.0) {
+            throw CanteraError("TabulatedMixTransport::setTemperatureStep",
+                "Temperature step must be positive; got {}", deltaT);
+        }
+        m_deltaT = deltaT;
+    }
+
+    //! Temperature grid spacing [K]
+    //! @see setTemperatureStep()
+    double temperatureStep() const {
+        return m_deltaT;
+    }
+
+    virtual void update_T() {
+        if (m_thermo->nSpecies() != m_nsp) {
+            // Rebuild data structures if number of species has changed
+            init(m_thermo, m_mode, m_log_level);
+        }
+        double t = m_thermo->temperature();
+        if (t < 0.0) {
+            throw CanteraError("TabulatedMixTransport::update_T",
+                               "negative temperature {}", t);
+        }
+        // evaluate at the nearest grid node; while the temperature stays
+        // within the node's trust interval, all cached fits remain valid
+        double tq = m_deltaT * std::round(t / m_deltaT);
+        if (tq == m_temp) {
+            return;
+        }
+        updateTransportTemperature(tq);
+        // temperature has changed, so polynomial fits will need to be redone
+        m_spcond_ok = false;
+        m_bindiff_ok = false;
+        m_condmix_ok = false;
+    }
+
+protected:
+    //! Temperature grid spacing [K]
+    double m_deltaT = 1.0;
+};
+}
+#endif
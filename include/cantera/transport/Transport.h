@@ -163,6 +163,21 @@ public:
         return "None";
     }
 
+    //! Create a new transport manager of the same model, reusing this
+    //! object's fitted property data instead of re-running the fits.
+    /*!
+     * The clone is attached to *thermo* (or to the phase of this object if
+     * null, for example for per-thread workers sharing one immutable phase
+     * description) and carries its own scratch state.
+     *
+     * @warning  This method is an experimental part of the %Cantera API and
+     *      may be changed or removed without notice.
+     */
+    virtual shared_ptr<Transport> clone(ThermoPhase* thermo=nullptr) const {
+        throw NotImplementedError("Transport::clone",
+            "Not implemented for transport model '{}'.", transportModel());
+    }
+
     //! Identifies the Transport object type. Each derived class should override
     //! this method to return a meaningful identifier.
     //! @deprecated  To be removed after Cantera 3.0. Replaced by transportModel
@@ -7,6 +7,7 @@
 #define CT_FLOWDEVICE_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/Func1.h"
 #include "cantera/base/global.h"
 #include "cantera/base/ctexceptions.h"
 
@@ -96,6 +97,9 @@ protected:
     //! Function set by setTimeFunction; used by updateMassFlowRate
     Func1* m_tfunc;
 
+    //! Flattened evaluator for #m_tfunc, compiled by setTimeFunction()
+    Func1Tape m_ttape;
+
     //! Coefficient set by derived classes; used by updateMassFlowRate
     double m_coeff;
 
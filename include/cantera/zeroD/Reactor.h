@@ -9,10 +9,11 @@
 #include "ReactorBase.h"
 #include "cantera/numerics/eigen_sparse.h"
 
-
 namespace Cantera
 {
 
+class SourceTermCache;
+
 class Solution;
 class AnyMap;
 
@@ -186,7 +187,40 @@ public:
     //! Reset the reaction rate multipliers
     virtual void resetSensitivity(double* params);
 
+    //! Attach an in-situ source-term tabulation cache, consulted by the
+    //! governing equations before evaluating the kinetics. Pass an empty
+    //! pointer to disable. The cache may be shared between reactors using
+    //! the same mechanism within one thread.
+    //! @see SourceTermCache
+    void setSourceTermCache(shared_ptr<SourceTermCache> cache) {
+        m_source_cache = cache;
+    }
+
+    //! Attached source-term tabulation cache, if any
+    shared_ptr<SourceTermCache> sourceTermCache() {
+        return m_source_cache;
+    }
+
+    //! Evaluate this reactor's chemical production rates at its current
+    //! state into internal storage. Touches only this reactor's phase and
+    //! kinetics objects, so the reactors of a network (not sharing
+    //! Solution objects) can run it concurrently; the subsequent
+    //! evaluation inside eval() then hits the cached rates.
+    //! @see ReactorNet::setParallelChemistry()
+    virtual void updateChemistry() {
+        if (m_chem && m_kin) {
+            updateProductionRates();
+        }
+    }
+
 protected:
+    //! Update m_wdot with the net species production rates, consulting the
+    //! attached tabulation cache when one is set
+    void updateProductionRates();
+
+    //! In-situ source-term tabulation cache (may be null)
+    shared_ptr<SourceTermCache> m_source_cache;
+
     //! Return the index in the solution vector for this reactor of the species
     //! named *nm*, in either the homogeneous phase or a surface phase, relative
     //! to the start of the species terms. Used to implement componentIndex for
@@ -0,0 +1,81 @@
+//! @file ReactorEnsemble.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORENSEMBLE_H
+#define CT_REACTORENSEMBLE_H
+
+#include "ReactorNet.h"
+
+namespace Cantera
+{
+
+//! A driver integrating an ensemble of independent reactor networks in
+//! parallel.
+/*!
+ * The ensemble owns a set of mutually independent ReactorNet instances
+ * (typically built from cloned Solution objects sharing one mechanism, see
+ * Solution::clone()) and advances all of them to a common time on a pool of
+ * worker threads. Networks are handed out through a shared counter, so a
+ * thread that finishes its network immediately pulls the next one; stiff
+ * members that integrate much longer than the rest therefore do not idle
+ * the remaining workers. Each ReactorNet carries its own integrator, so no
+ * solver state is shared between threads.
+ *
+ * @warning  This class is an experimental part of the %Cantera API and may
+ *      be changed or removed without notice.
+ * @ingroup ZeroD
+ */
+class ReactorEnsemble
+{
+public:
+    ReactorEnsemble() {}
+    virtual ~ReactorEnsemble() {}
+    ReactorEnsemble(const ReactorEnsemble&) = delete;
+    ReactorEnsemble& operator=(const ReactorEnsemble&) = delete;
+
+    //! Add a reactor network to the ensemble. The network must not share
+    //! mutable objects (phases, kinetics, integrators) with any other
+    //! member of the ensemble.
+    void addNet(shared_ptr<ReactorNet> net) {
+        m_nets.push_back(net);
+    }
+
+    //! Number of reactor networks in the ensemble
+    size_t nNets() const {
+        return m_nets.size();
+    }
+
+    //! Access the n-th reactor network
+    ReactorNet& net(size_t n) {
+        return *m_nets.at(n);
+    }
+
+    //! Set the number of worker threads (0 or 1 integrates serially;
+    //! default 0)
+    void setThreads(size_t nThreads) {
+        m_threads = nThreads;
+    }
+
+    //! Number of worker threads
+    size_t threads() const {
+        return m_threads;
+    }
+
+    //! Advance all networks of the ensemble to time *t*.
+    /*!
+     * Networks are integrated concurrently on the configured worker
+     * threads with dynamic load balancing. If any network fails, the first
+     * error is re-thrown after all workers have finished.
+     */
+    void advanceAll(double t);
+
+protected:
+    std::vector<shared_ptr<ReactorNet>> m_nets; //!< Ensemble members
+    size_t m_threads = 0; //!< Number of worker threads
+};
+
+}
+
+#endif
@@ -9,6 +9,8 @@
 #include "Reactor.h"
 #include "cantera/numerics/FuncEval.h"
 
+#include <functional>
+#include <future>
 
 namespace Cantera
 {
@@ -41,6 +43,20 @@ public:
     //! Other options include: "DIAG", "DENSE", "GMRES", "BAND"
     void setLinearSolverType(const std::string& linSolverType="DENSE");
 
+    //! Select a banded direct linear solver with the given half-bandwidths.
+    /*!
+     * Convenience wrapper around setLinearSolverType("BAND") plus the
+     * integrator's bandwidth setting, for networks whose Jacobian is
+     * strongly banded - notably plug-flow marching chains and
+     * FlowReactor-style problems where each state component couples only
+     * to nearby components. The banded factorization is O(n b^2) instead
+     * of O(n^3). Couplings outside the band (for example a dense coverage
+     * border) are dropped from the iteration matrix; since CVODES uses it
+     * as a modified-Newton matrix, this trades iteration count, not
+     * accuracy.
+     */
+    void setBandedLinearSolver(int mupper, int mlower);
+
     //! Set preconditioner used by the linear solver
     //! @param preconditioner preconditioner object used for the linear solver
     void setPreconditioner(shared_ptr<PreconditionerBase> preconditioner);
@@ -200,6 +216,186 @@ public:
     virtual void eval(doublereal t, doublereal* y,
                       doublereal* ydot, doublereal* p);
 
+    //! Evaluate the Jacobian of the governing equations, assembled from the
+    //! reactor-specific jacobian() contributions.
+    /*!
+     * The reactor Jacobians are semi-analytic and may neglect some coupling
+     * terms (see Reactor::jacobian()); CVODES uses the matrix as a
+     * modified-Newton iteration matrix, so solution accuracy is governed by
+     * the residual while convergence speed depends on the matrix quality.
+     * @see setAnalyticJacobian()
+     */
+    virtual void evalJacobian(double t, double* y, double* ydot, double* p,
+                              double* j);
+
+    virtual bool hasJacobian() const {
+        return m_analytic_jac;
+    }
+
+    virtual void evalJacobianSparse(double t, double* y, double* ydot,
+                                    double* p, SparseTriplets& jac);
+
+    //! Select the forward sensitivity corrector method used by the
+    //! integrator ("staggered", "simultaneous" or "staggered-1"); see
+    //! CVodesIntegrator::setSensitivityMethod()
+    void setSensitivityMethod(const std::string& method);
+
+    /*! @name Adjoint sensitivities
+     * An adjoint (backward) capability - one backward solve yielding the
+     * gradient of a scalar objective with respect to every rate
+     * multiplier - is the right tool for high-dimensional uncertainty
+     * pipelines, and CVODES ships the CVODEA machinery for it. It is not
+     * implemented here yet because two pieces of plumbing are
+     * prerequisites: a per-parameter analytic partial
+     * \f$ \partial f / \partial p_i \f$ of the reactor equations (the
+     * per-reaction decomposition of each reactor's governing equations,
+     * which no reactor currently exposes), and checkpointed forward
+     * trajectories wired through the Integrator interface. The analytic
+     * Jacobian needed for the backward system itself is already available
+     * via evalJacobian(). Until then, forward sensitivities with the
+     * 'staggered-1' method bound memory for large parameter counts.
+     */
+    //! @{
+    //! @}
+
+    //! Evaluate the reactors' chemistry concurrently within each RHS
+    //! evaluation.
+    /*!
+     * After the shared state vector is distributed, each reactor's
+     * production rates are computed on the shared worker pool before the
+     * serial pass that assembles the coupled governing equations; with
+     * the state-epoch caching in the kinetics managers, the serial pass
+     * then reuses the precomputed rates. The reactors must not share
+     * Solution objects (each needs its own phase and kinetics instances),
+     * which is the standard configuration for coupled networks.
+     */
+    void setParallelChemistry(bool parallel) {
+        m_parallel_chem = parallel;
+    }
+
+    //! Advance the network to time *t* asynchronously.
+    /*!
+     * The integration runs on its own thread and the returned future
+     * completes when it finishes; solver failures propagate as exceptions
+     * when the future is waited on. This lets an operator-split driver
+     * overlap the chemistry integration with its transport update. The
+     * network (and the phases and kinetics it uses) must not be accessed
+     * between the call and the completion of the future.
+     *
+     * @warning  This method is an experimental part of the %Cantera API
+     *      and may be changed or removed without notice.
+     */
+    std::future<void> advanceAsync(double t) {
+        return std::async(std::launch::async, [this, t]() {
+            advance(t);
+        });
+    }
+
+    //! Capture the complete integrator state into one contiguous blob.
+    /*!
+     * The blob holds the simulation time, the last internal step size and
+     * the full solution vector. loadState() restores the network to this
+     * point and primes the integrator to resume with the captured step
+     * size, avoiding the small-step re-startup of a plain reinitialize().
+     * The integrator's internal history beyond the step size (the
+     * Nordsieck array and order) is not accessible through the CVODES
+     * public interface, so integration resumes at first order with the
+     * captured step.
+     *
+     * @param[out] state  blob receiving the state; resized as needed
+     */
+    void saveState(vector_fp& state);
+
+    //! Restore a state captured by saveState()
+    void loadState(const vector_fp& state);
+
+    //! Register an event function monitored natively during integration.
+    /*!
+     * The integrator locates the sign changes of every registered function
+     * \f$ g(t, y) \f$ within a single forward integration; the crossing
+     * times are available from eventTimes() afterwards. The function is
+     * called with the simulation time and the global state vector. Events
+     * must be registered before the network is initialized.
+     *
+     * @param g  event function whose roots are located
+     * @returns  the index of the registered event
+     */
+    size_t addEvent(std::function<double(double, const double*)> g) {
+        m_events.push_back(g);
+        return m_events.size() - 1;
+    }
+
+    virtual size_t nEvents() const {
+        return m_events.size();
+    }
+
+    virtual void evalEvents(double t, double* y, double* g) {
+        updateState(y);
+        for (size_t i = 0; i < m_events.size(); i++) {
+            g[i] = m_events[i](t, y);
+        }
+    }
+
+    //! Times at which registered event functions changed sign during
+    //! integration
+    const vector_fp& eventTimes();
+
+    //! Root-info flags for each event time, nEvents() entries per time
+    const vector_int& eventInfo();
+
+    //! Start recording a time series of selected global state components.
+    /*!
+     * After every step() call (and at the end of each advance() call), the
+     * simulation time and the selected components of the global state
+     * vector are appended to a contiguous sample buffer, avoiding
+     * per-sample copies across language boundaries. Component indices
+     * refer to the global state vector; see globalComponentIndex(). Any
+     * previously recorded data is discarded.
+     *
+     * @param components  global state component indices to record
+     */
+    void startRecording(const std::vector<size_t>& components) {
+        m_record_components = components;
+        m_recorded.clear();
+        m_recording = true;
+    }
+
+    //! Stop appending samples; recorded data remains available
+    void stopRecording() {
+        m_recording = false;
+    }
+
+    //! Number of recorded samples
+    size_t nRecordedSamples() const {
+        size_t stride = m_record_components.size() + 1;
+        return stride ? m_recorded.size() / stride : 0;
+    }
+
+    //! Recorded samples as one contiguous array. Each sample holds the time
+    //! followed by the values of the recorded components, in the order they
+    //! were passed to startRecording().
+    const vector_fp& recordedData() const {
+        return m_recorded;
+    }
+
+    //! Discard all recorded samples
+    void clearRecordedData() {
+        m_recorded.clear();
+    }
+
+    //! Write the recorded time series to *fname* as a compact binary file
+    //! (a small header with the recorded component indices followed by the
+    //! raw sample array), replacing multi-minute text serialization of
+    //! large histories with a single buffered write.
+    void writeRecordedData(const std::string& fname) const;
+
+    //! Use the reactor-provided (semi-)analytic Jacobian for direct linear
+    //! solvers instead of the integrator's internal difference quotients.
+    //! All reactors in the network must implement Reactor::jacobian().
+    void setAnalyticJacobian(bool useJac) {
+        m_analytic_jac = useJac;
+    }
+
     virtual void getState(doublereal* y);
 
     //! Return k-th derivative at the current time
@@ -284,6 +480,27 @@ public:
     virtual void setDerivativeSettings(AnyMap& settings);
 
 protected:
+    //! `true` if the reactor-provided analytic Jacobian should be used by
+    //! direct linear solvers
+    //! @see setAnalyticJacobian()
+    bool m_analytic_jac = false;
+
+    //! Append the current time and recorded components to the sample buffer
+    //! @see startRecording()
+    void recordSample();
+
+    //! Registered event functions
+    //! @see addEvent()
+    std::vector<std::function<double(double, const double*)>> m_events;
+
+    //! Boolean flag selecting concurrent per-reactor chemistry evaluation
+    //! @see setParallelChemistry()
+    bool m_parallel_chem = false;
+
+    bool m_recording = false; //!< `true` while samples are being recorded
+    std::vector<size_t> m_record_components; //!< Recorded component indices
+    vector_fp m_recorded; //!< Contiguous sample buffer
+
     //! Check if surfaces and preconditioning are included, if so throw an error because
     //! they are currently not supported.
     virtual void checkPreconditionerSupported();
@@ -93,6 +93,13 @@ protected:
     Kinetics* m_kinetics;
     ReactorBase* m_reactor;
     vector_fp m_cov;
+
+    //! Surface state installed by the last syncState() push: the phase's
+    //! composition number, the temperature and the coverages. Used to skip
+    //! redundant pushes.
+    int m_syncStateNum = -1;
+    double m_syncTemp = -1.0;
+    vector_fp m_syncCov;
     std::vector<SensitivityParameter> m_params;
 };
 
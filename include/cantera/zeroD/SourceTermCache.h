@@ -0,0 +1,93 @@
+//! @file SourceTermCache.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_SOURCETERMCACHE_H
+#define CT_SOURCETERMCACHE_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <unordered_map>
+
+namespace Cantera
+{
+
+class ThermoPhase;
+
+//! An in-situ tabulation cache for chemical source terms.
+/*!
+ * The cache stores net production rates keyed on a quantized thermodynamic
+ * state (logarithmic in temperature and density, absolute in mass
+ * fractions, with the quantum set by the tolerance). Queries landing in an
+ * already-tabulated cell reuse the stored rates without evaluating the
+ * kinetics, which pays off for operator-splitting workloads revisiting
+ * near-identical states. This is a conservative, zeroth-order variant of
+ * in-situ adaptive tabulation: there is no ellipsoid-of-accuracy growth or
+ * linear extrapolation, so retrieval errors are bounded directly by the
+ * state quantum rather than by an estimated mapping gradient.
+ *
+ * @warning  This class is an experimental part of the %Cantera API and may
+ *      be changed or removed without notice.
+ * @ingroup ZeroD
+ */
+class SourceTermCache
+{
+public:
+    //! @param tol  state quantization tolerance: relative for temperature
+    //!     and density, absolute for mass fractions
+    //! @param maxEntries  table capacity; the table is cleared when full
+    explicit SourceTermCache(double tol=1e-4, size_t maxEntries=500000)
+        : m_tol(tol)
+        , m_maxEntries(maxEntries)
+    {
+    }
+
+    //! Look up the production rates for the current state of *phase*.
+    //! Returns `true` and fills *wdot* on a hit.
+    bool retrieve(ThermoPhase& phase, double* wdot);
+
+    //! Store the production rates *wdot* for the current state of *phase*
+    void add(ThermoPhase& phase, const double* wdot);
+
+    //! Number of successful retrievals
+    size_t hits() const {
+        return m_hits;
+    }
+
+    //! Number of queries that required a kinetics evaluation
+    size_t misses() const {
+        return m_misses;
+    }
+
+    //! Number of stored entries
+    size_t size() const {
+        return m_table.size();
+    }
+
+    //! Discard all stored entries
+    void clear() {
+        m_table.clear();
+    }
+
+protected:
+    //! Build the quantized state key for the current state of *phase*
+    void makeKey(ThermoPhase& phase, std::vector<long long>& key) const;
+
+    //! A tabulated record
+    struct Record {
+        std::vector<long long> key; //!< Quantized state
+        vector_fp wdot; //!< Stored net production rates
+    };
+
+    double m_tol; //!< State quantization tolerance
+    size_t m_maxEntries; //!< Table capacity
+    size_t m_hits = 0; //!< Number of successful retrievals
+    size_t m_misses = 0; //!< Number of queries requiring evaluation
+    std::unordered_map<size_t, Record> m_table; //!< Tabulated records
+    std::vector<long long> m_key; //!< Scratch key
+};
+
+}
+
+#endif
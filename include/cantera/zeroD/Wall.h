@@ -9,13 +9,13 @@
 #include "cantera/base/ctexceptions.h"
 #include "cantera/zeroD/ReactorSurface.h"
 #include "cantera/zeroD/ReactorBase.h"
+#include "cantera/numerics/Func1.h"
 
 namespace Cantera
 {
 
 class Kinetics;
 class SurfPhase;
-class Func1;
 
 /**
  * Base class for 'walls' (walls, pistons, etc.) connecting reactors.
@@ -112,6 +112,7 @@ public:
     void setVelocity(Func1* f=0) {
         if (f) {
             m_vf = f;
+            m_vtape.compile(*f);
         }
     }
 
@@ -131,6 +132,7 @@ public:
     //! Specify the heat flux function \f$ q_0(t) \f$.
     void setHeatFlux(Func1* q) {
         m_qf = q;
+        m_qtape.compile(*q);
     }
 
     //! Heat flow rate through the wall (W).
@@ -197,8 +199,16 @@ protected:
     //! Velocity function
     Func1* m_vf;
 
+    //! Flattened evaluator for #m_vf
+    //! @see setVelocity()
+    Func1Tape m_vtape;
+
     //! Heat flux function
     Func1* m_qf;
+
+    //! Flattened evaluator for #m_qf
+    //! @see setHeatFlux()
+    Func1Tape m_qtape;
 };
 
 }
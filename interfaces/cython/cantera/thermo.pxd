@@ -55,6 +55,8 @@ cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
         cbool getElementPotentials(double*) except +translate_exception
         void equilibrate(string, string, double, int, int, int, int) except +translate_exception
         size_t stateSize()
+        void evaluateStates(size_t, double*, double*, double*, double*,
+                            double*, double*, double*) nogil except +translate_exception
         void saveState(size_t, double*) except +translate_exception
         void restoreState(size_t, double*) except +translate_exception
         CxxUnits standardConcentrationUnits() except +translate_exception
@@ -605,6 +605,58 @@ cdef class ThermoPhase(_SolutionBase):
         return self.thermo.nAtoms(self.species_index(species),
                                   self.element_index(element))
 
+    def evaluate_states(self, T, P, Y, properties=("density", "h", "s", "cp")):
+        """
+        Batched evaluation of an array of thermodynamic states.
+
+        Sets each state given by the temperature array ``T``, pressure array
+        ``P`` and mass-fraction matrix ``Y`` (``n_states`` rows of
+        ``n_species`` values) and returns the requested properties as
+        arrays. ``properties`` may contain any of ``'density'``, ``'h'``,
+        ``'s'`` and ``'cp'`` (mass basis). The state sweep runs in C++ with
+        the GIL released, so thread pools achieve real parallelism across
+        independent `ThermoPhase` objects. The phase state is modified.
+        """
+        cdef np.ndarray[np.double_t, ndim=1] TT = \
+            np.ascontiguousarray(T, dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=1] PP = \
+            np.ascontiguousarray(P, dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] YY = \
+            np.ascontiguousarray(Y, dtype=np.double)
+        cdef size_t n = TT.shape[0]
+        if PP.shape[0] != <Py_ssize_t> n or YY.shape[0] != <Py_ssize_t> n:
+            raise ValueError("Inconsistent array lengths")
+        if YY.shape[1] != <Py_ssize_t> self.n_species:
+            raise ValueError("Expected {} columns in Y".format(self.n_species))
+        out = {}
+        cdef np.ndarray[np.double_t, ndim=1] rho, h, s, cp
+        cdef double* rho_p = NULL
+        cdef double* h_p = NULL
+        cdef double* s_p = NULL
+        cdef double* cp_p = NULL
+        if "density" in properties:
+            rho = np.empty(n)
+            out["density"] = rho
+            rho_p = &rho[0]
+        if "h" in properties:
+            h = np.empty(n)
+            out["h"] = h
+            h_p = &h[0]
+        if "s" in properties:
+            s = np.empty(n)
+            out["s"] = s
+            s_p = &s[0]
+        if "cp" in properties:
+            cp = np.empty(n)
+            out["cp"] = cp
+            cp_p = &cp[0]
+        cdef double* T_p = &TT[0]
+        cdef double* P_p = &PP[0]
+        cdef double* Y_p = &YY[0,0]
+        with nogil:
+            self.thermo.evaluateStates(n, T_p, P_p, Y_p, rho_p, h_p, s_p, cp_p)
+        return out
+
     cdef np.ndarray _getArray1(self, thermoMethod1d method):
         cdef np.ndarray[np.double_t, ndim=1] data = np.empty(self.n_species)
         method(self.thermo, &data[0])
@@ -12,6 +12,8 @@
 #include <boost/algorithm/string.hpp>
 #include <fstream>
 #include <mutex>
+#include <cstring>
+#include <cstdio>
 #include <unordered_set>
 
 namespace ba = boost::algorithm;
@@ -1390,12 +1392,14 @@ AnyValue& AnyMap::createForYaml(const std::string& key, int line, int column)
 
 const AnyValue& AnyMap::at(const std::string& key) const
 {
-    try {
-        return m_data.at(key);
-    } catch (std::out_of_range&) {
+    // find() avoids the cost of raising and translating std::out_of_range
+    // on the (frequent) optional-key misses of mechanism construction
+    auto iter = m_data.find(key);
+    if (iter == m_data.end()) {
         throw InputFileError("AnyMap::at", *this,
             "Key '{}' not found.\nExisting keys: {}", key, keys_str());
     }
+    return iter->second;
 }
 
 bool AnyMap::empty() const
@@ -1486,23 +1490,28 @@ void AnyMap::copyMetadata(const AnyMap& other)
 
 bool AnyMap::getBool(const std::string& key, bool default_) const
 {
-    return (hasKey(key)) ? m_data.at(key).asBool() : default_;
+    // a single hash lookup serves both the existence check and the access
+    auto iter = m_data.find(key);
+    return (iter != m_data.end()) ? iter->second.asBool() : default_;
 }
 
 double AnyMap::getDouble(const std::string& key, double default_) const
 {
-    return (hasKey(key)) ? m_data.at(key).asDouble() : default_;
+    auto iter = m_data.find(key);
+    return (iter != m_data.end()) ? iter->second.asDouble() : default_;
 }
 
 long int AnyMap::getInt(const std::string& key, long int default_) const
 {
-    return (hasKey(key)) ? m_data.at(key).asInt() : default_;
+    auto iter = m_data.find(key);
+    return (iter != m_data.end()) ? iter->second.asInt() : default_;
 }
 
 const std::string& AnyMap::getString(const std::string& key,
                                      const std::string& default_) const
 {
-    return (hasKey(key)) ? m_data.at(key).asString() : default_;
+    auto iter = m_data.find(key);
+    return (iter != m_data.end()) ? iter->second.asString() : default_;
 }
 
 double AnyMap::convert(const std::string& key, const std::string& dest) const
@@ -1518,8 +1527,9 @@ double AnyMap::convert(const std::string& key, const Units& dest) const
 double AnyMap::convert(const std::string& key, const std::string& dest,
                        double default_) const
 {
-    if (hasKey(key)) {
-        return units().convert(at(key), dest);
+    auto iter = m_data.find(key);
+    if (iter != m_data.end()) {
+        return units().convert(iter->second, dest);
     } else {
         return default_;
     }
@@ -1740,6 +1750,270 @@ AnyMap AnyMap::fromYamlString(const std::string& yaml) {
     return amap;
 }
 
+namespace {
+
+//! Format version of binary AnyMap cache files
+const int AnyMapBinVersion = 1;
+
+//! Type tags of the binary AnyMap representation
+enum class BinTag : unsigned char {
+    Empty, Bool, Long, Double, String, VecDouble, VecLong, VecBool,
+    VecString, VecVecDouble, VecAny, VecMap, Map
+};
+
+void binWriteString(std::ostream& out, const std::string& str)
+{
+    uint64_t n = str.size();
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(str.data(), n);
+}
+
+std::string binReadString(std::istream& in)
+{
+    uint64_t n = 0;
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if (!in || n > (1ULL << 30)) {
+        throw CanteraError("AnyMap::readBinary", "Corrupt cache file");
+    }
+    std::string str(n, '\0');
+    in.read(&str[0], n);
+    return str;
+}
+
+template <class T>
+void binWritePod(std::ostream& out, T value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+T binReadPod(std::istream& in)
+{
+    T value{};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+void binWriteValue(std::ostream& out, const AnyValue& v);
+AnyValue binReadValue(std::istream& in);
+
+template <class T>
+void binWriteVector(std::ostream& out, const std::vector<T>& values)
+{
+    binWritePod<uint64_t>(out, values.size());
+    for (const T& value : values) {
+        binWritePod(out, value);
+    }
+}
+
+template <class T>
+std::vector<T> binReadVector(std::istream& in)
+{
+    std::vector<T> values(binReadPod<uint64_t>(in));
+    for (T& value : values) {
+        value = binReadPod<T>(in);
+    }
+    return values;
+}
+
+void binWriteValue(std::ostream& out, const AnyValue& v)
+{
+    if (v.is<bool>()) {
+        binWritePod(out, BinTag::Bool);
+        binWritePod(out, v.asBool());
+    } else if (v.is<long int>()) {
+        binWritePod(out, BinTag::Long);
+        binWritePod<int64_t>(out, v.asInt());
+    } else if (v.is<double>()) {
+        binWritePod(out, BinTag::Double);
+        binWritePod(out, v.asDouble());
+    } else if (v.is<std::string>()) {
+        binWritePod(out, BinTag::String);
+        binWriteString(out, v.asString());
+    } else if (v.is<vector_fp>()) {
+        binWritePod(out, BinTag::VecDouble);
+        binWriteVector(out, v.asVector<double>());
+    } else if (v.is<std::vector<long int>>()) {
+        binWritePod(out, BinTag::VecLong);
+        std::vector<int64_t> tmp;
+        for (long int i : v.asVector<long int>()) {
+            tmp.push_back(i);
+        }
+        binWriteVector(out, tmp);
+    } else if (v.is<std::vector<bool>>()) {
+        binWritePod(out, BinTag::VecBool);
+        const auto& values = v.asVector<bool>();
+        binWritePod<uint64_t>(out, values.size());
+        for (bool value : values) {
+            binWritePod(out, value);
+        }
+    } else if (v.is<std::vector<std::string>>()) {
+        binWritePod(out, BinTag::VecString);
+        const auto& values = v.asVector<std::string>();
+        binWritePod<uint64_t>(out, values.size());
+        for (const auto& value : values) {
+            binWriteString(out, value);
+        }
+    } else if (v.is<std::vector<vector_fp>>()) {
+        binWritePod(out, BinTag::VecVecDouble);
+        const auto& values = v.asVector<vector_fp>();
+        binWritePod<uint64_t>(out, values.size());
+        for (const auto& value : values) {
+            binWriteVector(out, value);
+        }
+    } else if (v.is<std::vector<AnyValue>>()) {
+        binWritePod(out, BinTag::VecAny);
+        const auto& values = v.asVector<AnyValue>();
+        binWritePod<uint64_t>(out, values.size());
+        for (const auto& value : values) {
+            binWriteValue(out, value);
+        }
+    } else if (v.is<std::vector<AnyMap>>()) {
+        binWritePod(out, BinTag::VecMap);
+        const auto& values = v.asVector<AnyMap>();
+        binWritePod<uint64_t>(out, values.size());
+        for (const auto& value : values) {
+            value.writeBinary(out);
+        }
+    } else if (v.is<AnyMap>()) {
+        binWritePod(out, BinTag::Map);
+        v.as<AnyMap>().writeBinary(out);
+    } else {
+        throw CanteraError("AnyMap::writeBinary",
+            "Unsupported value type '{}'", v.type_str());
+    }
+}
+
+AnyValue binReadValue(std::istream& in)
+{
+    AnyValue v;
+    switch (binReadPod<BinTag>(in)) {
+    case BinTag::Empty:
+        break;
+    case BinTag::Bool:
+        v = binReadPod<bool>(in);
+        break;
+    case BinTag::Long:
+        v = static_cast<long int>(binReadPod<int64_t>(in));
+        break;
+    case BinTag::Double:
+        v = binReadPod<double>(in);
+        break;
+    case BinTag::String:
+        v = binReadString(in);
+        break;
+    case BinTag::VecDouble:
+        v = binReadVector<double>(in);
+        break;
+    case BinTag::VecLong:
+    {
+        std::vector<long int> values;
+        for (int64_t value : binReadVector<int64_t>(in)) {
+            values.push_back(static_cast<long int>(value));
+        }
+        v = values;
+        break;
+    }
+    case BinTag::VecBool:
+    {
+        std::vector<bool> values(binReadPod<uint64_t>(in));
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i] = binReadPod<bool>(in);
+        }
+        v = values;
+        break;
+    }
+    case BinTag::VecString:
+    {
+        std::vector<std::string> values(binReadPod<uint64_t>(in));
+        for (auto& value : values) {
+            value = binReadString(in);
+        }
+        v = values;
+        break;
+    }
+    case BinTag::VecVecDouble:
+    {
+        std::vector<vector_fp> values(binReadPod<uint64_t>(in));
+        for (auto& value : values) {
+            value = binReadVector<double>(in);
+        }
+        v = values;
+        break;
+    }
+    case BinTag::VecAny:
+    {
+        std::vector<AnyValue> values(binReadPod<uint64_t>(in));
+        for (auto& value : values) {
+            value = binReadValue(in);
+        }
+        v = values;
+        break;
+    }
+    case BinTag::VecMap:
+    {
+        std::vector<AnyMap> values(binReadPod<uint64_t>(in));
+        for (auto& value : values) {
+            value = AnyMap::readBinary(in);
+        }
+        v = values;
+        break;
+    }
+    case BinTag::Map:
+        v = AnyMap::readBinary(in);
+        break;
+    default:
+        throw CanteraError("AnyMap::readBinary", "Corrupt cache file");
+    }
+    return v;
+}
+
+} // anonymous namespace
+
+void AnyMap::writeBinary(std::ostream& out) const
+{
+    // the unit system governs deferred unit conversions at access time and
+    // must survive the round trip
+    if (m_units) {
+        binWritePod<unsigned char>(out, 1);
+        auto defaults = m_units->defaults();
+        binWritePod<uint64_t>(out, defaults.size());
+        for (const auto& item : defaults) {
+            binWriteString(out, item.first);
+            binWriteString(out, item.second);
+        }
+    } else {
+        binWritePod<unsigned char>(out, 0);
+    }
+    binWritePod<uint64_t>(out, m_data.size());
+    for (const auto& item : m_data) {
+        binWriteString(out, item.first);
+        binWriteValue(out, item.second);
+    }
+}
+
+AnyMap AnyMap::readBinary(std::istream& in)
+{
+    AnyMap out;
+    if (binReadPod<unsigned char>(in)) {
+        std::map<std::string, std::string> defaults;
+        uint64_t nu = binReadPod<uint64_t>(in);
+        for (uint64_t i = 0; i < nu; i++) {
+            std::string dim = binReadString(in);
+            defaults[dim] = binReadString(in);
+        }
+        auto units = std::make_shared<UnitSystem>();
+        units->setDefaults(defaults);
+        out.m_units = units;
+    }
+    uint64_t n = binReadPod<uint64_t>(in);
+    for (uint64_t i = 0; i < n; i++) {
+        std::string key = binReadString(in);
+        out[key] = binReadValue(in);
+    }
+    return out;
+}
+
 AnyMap AnyMap::fromYamlFile(const std::string& name,
                             const std::string& parent_name)
 {
@@ -1771,9 +2045,43 @@ AnyMap AnyMap::fromYamlFile(const std::string& name,
             "on the Cantera search path.", name);
     }
 
+    // When the environment variable CANTERA_YAML_CACHE names a writable
+    // directory, parsed files are mirrored there in binary form keyed on
+    // the source path and invalidated by its modification time, so
+    // subsequent processes skip the YAML DOM parse entirely.
+    std::string binFile;
+    if (const char* cacheDir = getenv("CANTERA_YAML_CACHE")) {
+        size_t h = 14695981039346656037ULL;
+        for (char c : fullName) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ULL;
+        }
+        binFile = fmt::format("{}/ct{}_{:x}.ctmap", cacheDir,
+                              AnyMapBinVersion, h);
+    }
+
     // Generate an AnyMap from the YAML file and store it in the cache
     auto& cache_item = s_cache[fullName];
     cache_item.second = mtime;
+
+    if (!binFile.empty()) {
+        std::ifstream bin(binFile, std::ios::binary);
+        char magic[4] = {};
+        if (bin.read(magic, 4) && strncmp(magic, "CTBM", 4) == 0
+            && binReadPod<int32_t>(bin) == AnyMapBinVersion
+            && binReadPod<int32_t>(bin) == mtime)
+        {
+            try {
+                cache_item.first = AnyMap::readBinary(bin);
+                cache_item.first.setMetadata("filename", AnyValue(fullName));
+                return cache_item.first;
+            } catch (CanteraError&) {
+                // unreadable cache entry; fall through and reparse
+                cache_item.first = AnyMap();
+            }
+        }
+    }
+
     try {
         YAML::Node node = YAML::LoadFile(fullName);
         cache_item.first = node.as<AnyMap>();
@@ -1795,6 +2103,22 @@ AnyMap AnyMap::fromYamlFile(const std::string& name,
         warn_deprecated(fullName, cache_item.first["deprecated"].asString());
     }
 
+    if (!binFile.empty()) {
+        try {
+            std::ofstream bin(binFile, std::ios::binary);
+            if (bin) {
+                bin.write("CTBM", 4);
+                binWritePod<int32_t>(bin, AnyMapBinVersion);
+                binWritePod<int32_t>(bin, mtime);
+                cache_item.first.writeBinary(bin);
+            }
+        } catch (CanteraError&) {
+            // a value type without binary representation: leave no partial
+            // cache file behind
+            std::remove(binFile.c_str());
+        }
+    }
+
     // Return a copy of the AnyMap
     return cache_item.first;
 }
@@ -53,6 +53,11 @@ void Array2D::resize(size_t n, size_t m, double v)
 {
     m_nrows = n;
     m_ncols = m;
+    if (n * m > m_data.capacity()) {
+        // grow geometrically so the repeated slightly-larger resizes of
+        // grid refinement stop reallocating every pass
+        m_data.reserve(std::max(n * m, 2 * m_data.capacity()));
+    }
     m_data.resize(n*m, v);
 }
 
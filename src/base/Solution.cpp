@@ -10,15 +10,43 @@
 #include "cantera/base/Interface.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/Species.h"
+#include "cantera/thermo/SpeciesThermoInterpType.h"
+#include "cantera/kinetics/Reaction.h"
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/kinetics/KineticsFactory.h"
 #include "cantera/transport/Transport.h"
 #include "cantera/transport/TransportFactory.h"
 #include "cantera/base/stringUtils.h"
 
+#include <chrono>
+#include <fstream>
+
 namespace Cantera
 {
 
+namespace {
+
+//! Accumulates the wall time of its scope into the named setup phase
+//! @see getSetupTimings()
+struct ScopedSetupTimer {
+    explicit ScopedSetupTimer(const char* phaseName)
+        : phase(phaseName)
+        , start(std::chrono::steady_clock::now())
+    {
+    }
+    ~ScopedSetupTimer() {
+        std::chrono::duration<double> dt =
+            std::chrono::steady_clock::now() - start;
+        recordSetupTime(phase, dt.count());
+    }
+    const char* phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // anonymous namespace
+
+
 Solution::Solution() {}
 
 std::string Solution::name() const {
@@ -65,6 +93,208 @@ void Solution::setTransportModel(const std::string& model) {
     }
 }
 
+namespace {
+
+size_t anyMapBytes(const AnyMap& m);
+
+//! Estimated heap bytes held by an AnyValue, recursively
+size_t anyValueBytes(const AnyValue& v)
+{
+    size_t bytes = sizeof(AnyValue);
+    if (v.is<std::string>()) {
+        bytes += v.asString().capacity();
+    } else if (v.is<vector_fp>()) {
+        bytes += v.asVector<double>().capacity() * sizeof(double);
+    } else if (v.is<std::vector<long int>>()) {
+        bytes += v.asVector<long int>().capacity() * sizeof(long int);
+    } else if (v.is<std::vector<std::string>>()) {
+        for (const auto& str : v.asVector<std::string>()) {
+            bytes += sizeof(std::string) + str.capacity();
+        }
+    } else if (v.is<std::vector<vector_fp>>()) {
+        for (const auto& vec : v.asVector<vector_fp>()) {
+            bytes += sizeof(vector_fp) + vec.capacity() * sizeof(double);
+        }
+    } else if (v.is<std::vector<AnyValue>>()) {
+        for (const auto& item : v.asVector<AnyValue>()) {
+            bytes += anyValueBytes(item);
+        }
+    } else if (v.is<std::vector<AnyMap>>()) {
+        for (const auto& item : v.asVector<AnyMap>()) {
+            bytes += sizeof(AnyMap) + anyMapBytes(item);
+        }
+    } else if (v.is<AnyMap>()) {
+        bytes += sizeof(AnyMap) + anyMapBytes(v.as<AnyMap>());
+    } else {
+        bytes += 16; // scalar payload held by the type-erased storage
+    }
+    return bytes;
+}
+
+//! Estimated heap bytes held by an AnyMap, recursively
+size_t anyMapBytes(const AnyMap& m)
+{
+    size_t bytes = 0;
+    for (const auto& item : m) {
+        bytes += item.first.capacity() + 48 // hash node overhead
+                 + anyValueBytes(item.second);
+    }
+    return bytes;
+}
+
+} // anonymous namespace
+
+AnyMap Solution::autotuneKernels(size_t nEvals)
+{
+    AnyMap out;
+    if (!m_kinetics || !m_thermo) {
+        throw CanteraError("Solution::autotuneKernels",
+                           "Requires thermo and kinetics managers.");
+    }
+
+    // cached decision keyed by a mechanism fingerprint
+    std::string cacheFile;
+    if (const char* dir = getenv("CANTERA_TUNING_CACHE")) {
+        size_t h = 14695981039346656037ULL;
+        auto mix = [&h](size_t v) {
+            h ^= v;
+            h *= 1099511628211ULL;
+        };
+        mix(m_thermo->nSpecies());
+        mix(m_kinetics->nReactions());
+        for (char c : m_thermo->name()) {
+            mix(static_cast<unsigned char>(c));
+        }
+        cacheFile = fmt::format("{}/ct_tune_{:x}", dir, h);
+        std::ifstream in(cacheFile);
+        int batched = -1;
+        if (in >> batched && batched >= 0) {
+            use_batched_rate_evaluators(batched != 0);
+            out["batched-rate-evaluators"] = (batched != 0);
+            out["cached"] = true;
+            return out;
+        }
+    }
+
+    // time both configurations on clones at the current state
+    auto timeConfig = [this, nEvals](bool batched) {
+        bool previous = batched_rate_evaluators_used();
+        use_batched_rate_evaluators(batched);
+        auto trial = clone();
+        use_batched_rate_evaluators(previous);
+        auto& kin = *trial->kinetics();
+        vector_fp wdot(trial->thermo()->nSpecies());
+        double T0 = trial->thermo()->temperature();
+        kin.getNetProductionRates(wdot.data()); // warm caches
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < nEvals; i++) {
+            // nudge the temperature so per-state work is not short-circuited
+            trial->thermo()->setTemperature(T0 * (1.0 + 1e-9 * (i % 7)));
+            kin.getNetProductionRates(wdot.data());
+        }
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+    };
+    double tSerial = timeConfig(false);
+    double tBatched = timeConfig(true);
+    bool useBatched = tBatched < tSerial;
+    use_batched_rate_evaluators(useBatched);
+    out["time-per-reaction"] = tSerial;
+    out["time-batched"] = tBatched;
+    out["batched-rate-evaluators"] = useBatched;
+    out["cached"] = false;
+
+    if (!cacheFile.empty()) {
+        std::ofstream cache(cacheFile);
+        if (cache) {
+            cache << (useBatched ? 1 : 0) << "\n";
+        }
+    }
+    return out;
+}
+
+void Solution::dropRetainedInput()
+{
+    if (m_thermo) {
+        for (size_t k = 0; k < m_thermo->nSpecies(); k++) {
+            m_thermo->species(k)->input = AnyMap();
+        }
+        m_thermo->input() = AnyMap();
+    }
+    if (m_kinetics) {
+        for (size_t i = 0; i < m_kinetics->nReactions(); i++) {
+            m_kinetics->reaction(i)->input = AnyMap();
+        }
+    }
+}
+
+AnyMap Solution::memoryFootprint() const
+{
+    AnyMap out;
+    size_t speciesInput = 0, speciesThermo = 0;
+    if (m_thermo) {
+        for (size_t k = 0; k < m_thermo->nSpecies(); k++) {
+            auto spec = m_thermo->species(k);
+            speciesInput += anyMapBytes(spec->input);
+            speciesThermo += sizeof(Species);
+            if (spec->thermo) {
+                speciesThermo += spec->thermo->nCoeffs() * sizeof(double);
+            }
+        }
+        out["species-input"] = static_cast<long int>(speciesInput);
+        out["species-thermo"] = static_cast<long int>(speciesThermo);
+        // per-species work arrays of the phase itself
+        out["thermo-work"] = static_cast<long int>(
+            m_thermo->nSpecies() * 12 * sizeof(double));
+    }
+    size_t reactions = 0, reactionInput = 0;
+    if (m_kinetics) {
+        for (size_t i = 0; i < m_kinetics->nReactions(); i++) {
+            auto rxn = m_kinetics->reaction(i);
+            reactions += sizeof(Reaction) + 256; // rate object and stoich maps
+            reactionInput += anyMapBytes(rxn->input);
+        }
+        out["reactions"] = static_cast<long int>(reactions);
+        out["reaction-input"] = static_cast<long int>(reactionInput);
+        // rate-of-progress and related per-reaction work arrays
+        out["kinetics-work"] = static_cast<long int>(
+            m_kinetics->nReactions() * 10 * sizeof(double));
+    }
+    if (m_transport && m_transport->transportModel() != "None" && m_thermo) {
+        size_t K = m_thermo->nSpecies();
+        // viscosity/conductivity fits, packed binary diffusion fits, and
+        // the dense pair matrices of the collision parameters
+        out["transport-fits"] = static_cast<long int>(
+            sizeof(double) * (10 * K + 5 * K * (K + 1) / 2 + 6 * K * K));
+    }
+    long int total = 0;
+    for (const auto& item : out) {
+        total += item.second.asInt();
+    }
+    out["total"] = total;
+    return out;
+}
+
+shared_ptr<Solution> Solution::clone() const
+{
+    if (!m_adjacent.empty()) {
+        throw NotImplementedError("Solution::clone",
+            "Not supported for Solution objects with adjacent phases.");
+    }
+    auto sol = Solution::create();
+    sol->setSource(source());
+    sol->m_header = m_header;
+    auto thermo = m_thermo->clone();
+    sol->setThermo(thermo);
+    if (m_kinetics) {
+        sol->setKinetics(m_kinetics->clone({thermo}));
+    }
+    if (m_transport) {
+        sol->setTransportModel(m_transport->transportModel());
+    }
+    return sol;
+}
+
 void Solution::addAdjacent(shared_ptr<Solution> adjacent) {
     if (m_adjacentByName.count(adjacent->name())) {
         throw CanteraError("Solution::addAdjacent",
@@ -151,7 +381,11 @@ shared_ptr<Solution> newSolution(const std::string& infile,
     }
 
     // load YAML file
-    auto rootNode = AnyMap::fromYamlFile(infile);
+    AnyMap rootNode;
+    {
+        ScopedSetupTimer timer("yaml-parse");
+        rootNode = AnyMap::fromYamlFile(infile);
+    }
     AnyMap& phaseNode = rootNode["phases"].getMapWhere("name", name);
     auto sol = newSolution(phaseNode, rootNode, transport, adjacent);
     sol->setSource(infile);
@@ -180,7 +414,11 @@ shared_ptr<Solution> newSolution(const AnyMap& phaseNode,
                                  const std::map<std::string, shared_ptr<Solution>>& related)
 {
     // thermo phase
-    auto thermo = shared_ptr<ThermoPhase>(newPhase(phaseNode, rootNode));
+    shared_ptr<ThermoPhase> thermo;
+    {
+        ScopedSetupTimer timer("thermo-setup");
+        thermo = shared_ptr<ThermoPhase>(newPhase(phaseNode, rootNode));
+    }
 
     // instantiate Solution object of the correct derived type
     shared_ptr<Solution> sol;
@@ -269,10 +507,16 @@ shared_ptr<Solution> newSolution(const AnyMap& phaseNode,
     for (size_t i = 0; i < sol->nAdjacent(); i++) {
         phases.push_back(sol->adjacent(i)->thermo().get());
     }
-    sol->setKinetics(newKinetics(phases, phaseNode, rootNode));
+    {
+        ScopedSetupTimer timer("kinetics-setup");
+        sol->setKinetics(newKinetics(phases, phaseNode, rootNode));
+    }
 
     // set transport model by name
-    sol->setTransportModel(transport);
+    {
+        ScopedSetupTimer timer("transport-setup");
+        sol->setTransportModel(transport);
+    }
 
     // save root-level information (YAML header)
     AnyMap header;
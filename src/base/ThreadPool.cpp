@@ -0,0 +1,189 @@
+//! @file ThreadPool.cpp Shared worker pool
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/ThreadPool.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Cantera
+{
+
+struct ThreadPool::Impl
+{
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::vector<std::thread> workers;
+    Executor executor;
+
+    // current batch
+    std::function<void(size_t)> work;
+    std::atomic<size_t> next{0};
+    size_t count = 0;
+    size_t generation = 0;
+    size_t active = 0;
+    bool shutdown = false;
+    std::string firstError;
+    static thread_local bool inWorker;
+
+    void runBatch() {
+        while (true) {
+            size_t i = next.fetch_add(1);
+            if (i >= count) {
+                return;
+            }
+            try {
+                work(i);
+            } catch (std::exception& err) {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (firstError.empty()) {
+                    firstError = err.what();
+                }
+            }
+        }
+    }
+
+    void workerLoop() {
+        inWorker = true;
+        size_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this, seen]() {
+                    return shutdown || generation != seen;
+                });
+                if (shutdown) {
+                    return;
+                }
+                seen = generation;
+            }
+            runBatch();
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (--active == 0) {
+                    done.notify_all();
+                }
+            }
+        }
+    }
+
+    void stopWorkers() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            shutdown = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+        shutdown = false;
+    }
+};
+
+thread_local bool ThreadPool::Impl::inWorker = false;
+
+ThreadPool::ThreadPool()
+    : m_impl(new Impl)
+{
+    size_t n = std::max(1u, std::thread::hardware_concurrency());
+    resize(n);
+}
+
+ThreadPool::~ThreadPool()
+{
+    m_impl->stopWorkers();
+}
+
+ThreadPool& ThreadPool::instance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::resize(size_t nThreads)
+{
+    m_impl->stopWorkers();
+    for (size_t w = 0; w < nThreads; w++) {
+        m_impl->workers.emplace_back([this]() { m_impl->workerLoop(); });
+    }
+}
+
+size_t ThreadPool::size() const
+{
+    return m_impl->workers.size();
+}
+
+void ThreadPool::setExecutor(Executor executor)
+{
+    m_impl->executor = executor;
+}
+
+void ThreadPool::parallelFor(size_t n, const std::function<void(size_t)>& f)
+{
+    Impl& impl = *m_impl;
+    if (n == 0) {
+        return;
+    }
+    if (n == 1 || impl.workers.empty() || Impl::inWorker) {
+        // run serially: trivial batches, no workers, or a nested call from
+        // within a worker (which must not deadlock waiting for the pool)
+        for (size_t i = 0; i < n; i++) {
+            f(i);
+        }
+        return;
+    }
+
+    if (impl.executor) {
+        std::atomic<size_t> next(0);
+        std::mutex errMutex;
+        std::string firstError;
+        impl.executor([&]() {
+            while (true) {
+                size_t i = next.fetch_add(1);
+                if (i >= n) {
+                    return;
+                }
+                try {
+                    f(i);
+                } catch (std::exception& err) {
+                    std::unique_lock<std::mutex> lock(errMutex);
+                    if (firstError.empty()) {
+                        firstError = err.what();
+                    }
+                }
+            }
+        }, std::min(n, impl.workers.size()));
+        if (!firstError.empty()) {
+            throw CanteraError("ThreadPool::parallelFor", firstError);
+        }
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(impl.mutex);
+        impl.work = f;
+        impl.count = n;
+        impl.next = 0;
+        impl.firstError.clear();
+        impl.active = impl.workers.size();
+        impl.generation++;
+    }
+    impl.wake.notify_all();
+    // the calling thread participates in the batch
+    impl.runBatch();
+    std::unique_lock<std::mutex> lock(impl.mutex);
+    impl.done.wait(lock, [&impl]() { return impl.active == 0; });
+    if (!impl.firstError.empty()) {
+        throw CanteraError("ThreadPool::parallelFor", impl.firstError);
+    }
+}
+
+}
@@ -10,6 +10,8 @@
 #include "cantera/base/AnyMap.h"
 #include "cantera/base/utilities.h"
 #include <regex>
+#include <mutex>
+#include <unordered_map>
 
 namespace {
 using namespace Cantera;
@@ -141,6 +143,21 @@ Units::Units(const std::string& name, bool force_unity)
     , m_pressure_dim(0)
     , m_energy_dim(0)
 {
+    // Parsed unit strings are memoized process-wide: mechanism loading and
+    // YAML writing convert the same few strings thousands of times, and the
+    // regex-based parse below dominates that cost.
+    static std::mutex parseCacheMutex;
+    static std::unordered_map<std::string, Units> parseCache;
+    std::string cacheKey = name + (force_unity ? "\x01" : "");
+    {
+        std::unique_lock<std::mutex> lock(parseCacheMutex);
+        auto iter = parseCache.find(cacheKey);
+        if (iter != parseCache.end()) {
+            *this = iter->second;
+            return;
+        }
+    }
+
     size_t start = 0;
 
     // Determine factor
@@ -205,6 +222,10 @@ Units::Units(const std::string& name, bool force_unity)
             "input '{}' is equivalent to '{}' where the conversion factor is '{}'",
             name, str(), m_factor);
     }
+
+    // successful parses are retained; error paths above leave no entry
+    std::unique_lock<std::mutex> lock(parseCacheMutex);
+    parseCache.emplace(std::move(cacheKey), *this);
 }
 
 bool Units::convertible(const Units& other) const
@@ -6,6 +6,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/base/ValueCache.h"
+#include "cantera/base/AnyMap.h"
 #include <mutex>
 
 namespace
@@ -24,10 +25,37 @@ int ValueCache::getId()
     return ++m_last_id;
 }
 
+AnyMap ValueCache::getStats() const
+{
+    AnyMap out;
+#if CT_CACHE_STATS
+    for (size_t id = 0; id < m_scalarCache.size(); id++) {
+        const auto& entry = m_scalarCache[id];
+        if (entry.hits || entry.misses) {
+            AnyMap stats;
+            stats["hits"] = static_cast<long int>(entry.hits);
+            stats["misses"] = static_cast<long int>(entry.misses);
+            out[fmt::format("id-{}", id)] = stats;
+        }
+    }
+    for (size_t id = 0; id < m_arrayCache.size(); id++) {
+        const auto& entry = m_arrayCache[id];
+        if (entry.hits || entry.misses) {
+            AnyMap stats;
+            stats["hits"] = static_cast<long int>(entry.hits);
+            stats["misses"] = static_cast<long int>(entry.misses);
+            out[fmt::format("array-id-{}", id)] = stats;
+        }
+    }
+#endif
+    return out;
+}
+
 void ValueCache::clear()
 {
-    m_scalarCache.clear();
-    m_arrayCache.clear();
+    // reset entries in place; ids remain valid slots
+    m_scalarCache.assign(m_scalarCache.size(), CachedValue<double>());
+    m_arrayCache.assign(m_arrayCache.size(), CachedValue<vector_fp>());
 }
 
 }
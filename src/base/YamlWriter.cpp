@@ -194,6 +194,123 @@ std::string YamlWriter::toYamlString() const
     return output.toYamlString();
 }
 
+namespace {
+
+//! Emit *entry* as one item of a YAML list on *out*
+void writeListItem(std::ostream& out, AnyMap entry, long int precision)
+{
+    entry.setMetadata("precision", AnyValue(precision));
+    std::string yml = entry.toYamlString();
+    bool first = true;
+    size_t start = 0;
+    while (start < yml.size()) {
+        size_t stop = yml.find('\n', start);
+        if (stop == npos) {
+            stop = yml.size();
+        }
+        if (stop > start) {
+            out << (first ? "- " : "  ");
+            out.write(yml.data() + start, stop - start);
+            out << "\n";
+            first = false;
+        }
+        start = stop + 1;
+    }
+}
+
+} // anonymous namespace
+
+void YamlWriter::toYamlStream(std::ostream& out) const
+{
+    if (m_output_units.defaults() != UnitSystem().defaults()) {
+        throw NotImplementedError("YamlWriter::toYamlStream",
+            "Streaming output does not support non-default unit systems.");
+    }
+
+    // header section
+    AnyMap header;
+    bool hasDescription = m_header.hasKey("description");
+    if (hasDescription) {
+        header["description"] = m_header["description"];
+    }
+    header["generator"] = "YamlWriter";
+    header["cantera-version"] = CANTERA_VERSION;
+    header["git-commit"] = gitCommit();
+    time_t now = std::chrono::system_clock::to_time_t(
+        std::chrono::system_clock::now());
+    header["date"] = trimCopy(std::ctime(&now));
+    std::set<std::string> exclude = {
+        "description", "generator", "cantera-version", "git-commit", "date"};
+    for (const auto& item : m_header) {
+        if (!exclude.count(item.first)) {
+            header[item.first] = item.second;
+        }
+    }
+    out << header.toYamlString() << "\n";
+
+    // phase definitions; each phase with reactions references its own
+    // reactions section, so the sections can be streamed independently
+    bool shared = true;
+    size_t nReacting = 0;
+    for (const auto& phase : m_phases) {
+        const auto kin = phase->kinetics();
+        if (kin && kin->nReactions()) {
+            nReacting++;
+        }
+    }
+    shared = (nReacting <= 1);
+    out << "phases:\n";
+    for (const auto& phase : m_phases) {
+        AnyMap phaseDef = phase->thermo()->parameters(!m_skip_user_defined);
+        if (phase->nAdjacent()) {
+            std::vector<std::string> adj_names;
+            for (size_t j = 0; j < phase->nAdjacent(); j++) {
+                adj_names.push_back(phase->adjacent(j)->name());
+            }
+            phaseDef["adjacent-phases"] = adj_names;
+        }
+        const auto kin = phase->kinetics();
+        if (!shared && kin && kin->nReactions()) {
+            phaseDef["reactions"] = std::vector<std::string>{
+                phase->name() + "-reactions"};
+        }
+        writeListItem(out, std::move(phaseDef), m_float_precision);
+    }
+    out << "\n";
+
+    // species definitions, deduplicated by name
+    out << "species:\n";
+    std::set<std::string> written;
+    for (const auto& phase : m_phases) {
+        const auto thermo = phase->thermo();
+        for (const auto& name : thermo->speciesNames()) {
+            if (!written.insert(name).second) {
+                continue;
+            }
+            writeListItem(out, thermo->species(name)->parameters(
+                thermo.get(), !m_skip_user_defined), m_float_precision);
+        }
+    }
+
+    // one reactions section per reacting phase
+    for (const auto& phase : m_phases) {
+        const auto kin = phase->kinetics();
+        if (!kin || !kin->nReactions()) {
+            continue;
+        }
+        out << "\n";
+        if (shared) {
+            out << "reactions:\n";
+        } else {
+            out << phase->name() << "-reactions:\n";
+        }
+        for (size_t i = 0; i < kin->nReactions(); i++) {
+            writeListItem(out, kin->reaction(i)->parameters(!m_skip_user_defined),
+                          m_float_precision);
+        }
+    }
+}
+
 void YamlWriter::toYamlFile(const std::string& filename) const
 {
     std::ofstream out(filename);
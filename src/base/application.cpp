@@ -130,7 +130,8 @@ Application::Application() :
     m_suppress_thermo_warnings(false),
     m_suppress_warnings(false),
     m_fatal_warnings(false),
-    m_use_legacy_rate_constants(false)
+    m_use_legacy_rate_constants(false),
+    m_use_batched_rate_evaluators(false)
 {
     // install a default logwriter that writes to standard
     // output / standard error
@@ -306,6 +307,8 @@ void Application::setDefaultDirectories()
 void Application::addDataDirectory(const std::string& dir)
 {
     std::unique_lock<std::mutex> dirLock(dir_mutex);
+    // the search order changes, so cached resolutions are stale
+    m_resolvedInputFiles.clear();
     if (inputDirs.empty()) {
         setDefaultDirectories();
     }
@@ -371,6 +374,14 @@ std::string Application::findInputFile(const std::string& name)
         }
     }
 
+    // Check the resolution cache first: on networked filesystems every
+    // directory probe is a metadata operation, and the same includes are
+    // resolved over and over during mechanism loading
+    auto cached = m_resolvedInputFiles.find(name);
+    if (cached != m_resolvedInputFiles.end()) {
+        return cached->second;
+    }
+
     // Search the Cantera data directories for the input file, and return
     // the full path if a match is found
     size_t nd = dirs.size();
@@ -378,6 +389,7 @@ std::string Application::findInputFile(const std::string& name)
         string full_name = dirs[i] + "/" + name;
         std::ifstream fin(full_name);
         if (fin) {
+            m_resolvedInputFiles[name] = full_name;
             return full_name;
         }
     }
@@ -351,12 +351,25 @@ public:
         return m_suppress_warnings;
     }
 
+    //! Returns `true` if warnings are suppressed and not promoted to
+    //! errors, so callers can skip formatting their messages entirely
+    bool warnings_silenced() {
+        return m_suppress_warnings && !m_fatal_warnings;
+    }
+
     //! Turns Cantera warnings into exceptions. Activated within the test
     //! suite to make sure that your warning message are being raised.
     void make_warnings_fatal() {
         m_fatal_warnings = true;
     }
 
+    //! Returns `true` if deprecation warnings are currently suppressed (and
+    //! not promoted to errors), so callers can skip formatting their
+    //! messages entirely
+    bool deprecation_warnings_suppressed() {
+        return m_suppress_deprecation_warnings && !m_fatal_deprecation_warnings;
+    }
+
     //! Globally disable printing of warnings about problematic thermo data,
     //! such as NASA polynomials with discontinuities at the midpoint temperature.
     void suppress_thermo_warnings(bool suppress=true) {
@@ -386,6 +399,27 @@ public:
         return m_use_legacy_rate_constants;
     }
 
+    //! Set evaluation mode used by reaction rate evaluators.
+    /*!
+     * If set to 'true', kinetics evaluations that support it use batched
+     * kernels: rate parameterizations (currently ArrheniusRate) store their
+     * parameters in contiguous arrays and evaluate all rate constants of a
+     * mechanism in a single vectorizable sweep, and linear stoichiometry
+     * operations are computed as sparse matrix-vector products. This is
+     * considerably faster for large mechanisms. If set to 'false' (default
+     * value), per-reaction evaluation is used. Both modes yield equivalent
+     * results. The setting takes effect for Kinetics objects created after
+     * it is changed.
+     */
+    void use_batched_rate_evaluators(bool batched=true) {
+        m_use_batched_rate_evaluators = batched;
+    }
+
+    //! Returns `true` if batched reaction rate evaluators should be used
+    bool batched_rate_evaluators_used() {
+        return m_use_batched_rate_evaluators;
+    }
+
     //! @copydoc Messages::setLogger
     void setLogger(Logger* logwriter) {
         pMessenger->setLogger(logwriter);
@@ -432,6 +466,11 @@ protected:
     //! Current vector of input directories to search for input files
     std::vector<std::string> inputDirs;
 
+    //! Cache of resolved input file names, cleared when the search path
+    //! changes
+    //! @see findInputFile()
+    std::map<std::string, std::string> m_resolvedInputFiles;
+
     //! Vector of deprecation warnings that have been emitted (to suppress
     //! duplicates)
     std::set<std::string> warnings;
@@ -442,6 +481,7 @@ protected:
     bool m_suppress_warnings;
     bool m_fatal_warnings;
     bool m_use_legacy_rate_constants;
+    bool m_use_batched_rate_evaluators;
 
     std::set<std::pair<std::string, std::string>> m_loaded_extensions;
 
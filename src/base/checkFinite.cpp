@@ -10,8 +10,24 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/ctexceptions.h"
 
+#include <atomic>
+
 namespace Cantera {
 
+namespace {
+std::atomic<int> finite_check_level(2);
+}
+
+void setFiniteCheckLevel(int level)
+{
+    finite_check_level = level;
+}
+
+int finiteCheckLevel()
+{
+    return finite_check_level;
+}
+
 void checkFinite(const double tmp)
 {
     if (!std::isfinite(tmp)) {
@@ -27,6 +43,29 @@ void checkFinite(const double tmp)
 
 void checkFinite(const std::string& name, double* values, size_t N)
 {
+    // Fast vectorizable screen: the sum over the array is finite if and only
+    // if all elements are finite, barring overflow of the running sum itself.
+    // Only when the screen trips is the array scanned element by element to
+    // build the diagnostic (or to rule out a spurious overflow). The
+    // sampling levels reduce or skip the screen in production runs.
+    int level = finite_check_level;
+    if (level <= 0) {
+        return;
+    }
+    double sum = 0.0;
+    if (level == 1) {
+        for (size_t i = 0; i < N; i += 8) {
+            sum += values[i];
+        }
+    } else {
+        for (size_t i = 0; i < N; i++) {
+            sum += values[i];
+        }
+    }
+    if (std::isfinite(sum)) {
+        return;
+    }
+
     for (size_t i = 0; i < N; i++) {
         if (!std::isfinite(values[i])) {
             std::string message = name + " contains non-finite elements:\n\n";
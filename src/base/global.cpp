@@ -6,6 +6,9 @@
 #include "cantera/base/FactoryBase.h"
 #include "application.h"
 #include "cantera/base/AnyMap.h"
+
+#include <map>
+#include <mutex>
 #ifdef CT_USE_DEMANGLE
   #include <boost/core/demangle.hpp>
 #endif
@@ -109,6 +112,53 @@ bool legacy_rate_constants_used()
     return app()->legacy_rate_constants_used();
 }
 
+bool warnings_silenced()
+{
+    return app()->warnings_silenced();
+}
+
+bool deprecation_warnings_suppressed()
+{
+    return app()->deprecation_warnings_suppressed();
+}
+
+void use_batched_rate_evaluators(bool batched)
+{
+    app()->use_batched_rate_evaluators(batched);
+}
+
+bool batched_rate_evaluators_used()
+{
+    return app()->batched_rate_evaluators_used();
+}
+
+namespace {
+std::mutex setup_timing_mutex;
+std::map<std::string, double> setup_timings;
+}
+
+void recordSetupTime(const std::string& phase, double seconds)
+{
+    std::unique_lock<std::mutex> lock(setup_timing_mutex);
+    setup_timings[phase] += seconds;
+}
+
+AnyMap getSetupTimings()
+{
+    AnyMap out;
+    std::unique_lock<std::mutex> lock(setup_timing_mutex);
+    for (const auto& item : setup_timings) {
+        out[item.first] = item.second;
+    }
+    return out;
+}
+
+void clearSetupTimings()
+{
+    std::unique_lock<std::mutex> lock(setup_timing_mutex);
+    setup_timings.clear();
+}
+
 // **************** Global Data ****************
 
 void appdelete()
@@ -0,0 +1,116 @@
+//! @file profiling.cpp Hot-path instrumentation support
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/profiling.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cstdlib>
+#include <new>
+
+#include <mutex>
+#include <vector>
+
+#if CT_ALLOC_TRACKING
+namespace {
+thread_local long long ct_alloc_count = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    ct_alloc_count++;
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+#endif
+
+namespace Cantera
+{
+
+long long allocationCount()
+{
+#if CT_ALLOC_TRACKING
+    return ct_alloc_count;
+#else
+    return 0;
+#endif
+}
+
+AssertNoAllocations::~AssertNoAllocations() noexcept(false)
+{
+#if CT_ALLOC_TRACKING
+    long long made = allocationCount() - m_start;
+    if (made != 0) {
+        throw CanteraError("AssertNoAllocations",
+            "Scope '{}' performed {} heap allocation(s).", m_site, made);
+    }
+#endif
+}
+
+#if CT_PROFILING
+
+namespace {
+std::mutex profile_mutex;
+std::vector<HotPathTimer*>& profileSites()
+{
+    static std::vector<HotPathTimer*> sites;
+    return sites;
+}
+}
+
+HotPathTimer::HotPathTimer(const char* name)
+    : m_name(name)
+{
+    std::unique_lock<std::mutex> lock(profile_mutex);
+    profileSites().push_back(this);
+}
+
+AnyMap getProfilingData()
+{
+    AnyMap out;
+    std::unique_lock<std::mutex> lock(profile_mutex);
+    for (HotPathTimer* site : profileSites()) {
+        AnyMap entry;
+        entry["calls"] = static_cast<long int>(site->calls());
+        entry["seconds"] = site->seconds();
+        out[site->name()] = entry;
+    }
+    return out;
+}
+
+void clearProfilingData()
+{
+    std::unique_lock<std::mutex> lock(profile_mutex);
+    for (HotPathTimer* site : profileSites()) {
+        site->clear();
+    }
+}
+
+#else
+
+AnyMap getProfilingData()
+{
+    return AnyMap();
+}
+
+void clearProfilingData()
+{
+}
+
+#endif
+
+}
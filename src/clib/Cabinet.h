@@ -11,6 +11,10 @@
 #include "cantera/base/ctexceptions.h"
 #include "clib_utils.h"
 
+#include <array>
+#include <atomic>
+#include <mutex>
+
 /**
  * Template for classes to hold pointers to objects. The Cabinet<M>
  * class maintains a list of pointers to objects of class M (or of
@@ -48,9 +52,14 @@
  * with a pointer to the first object. In this way, if it is deleted
  * again inadvertently nothing happens, and if an attempt is made to
  * reference the object by its index number, the base-class object
- * will be referenced instead, which will throw an exception.  If
- * instead the pointer were stored in the referring code, there would
- * always be the chance that
+ * will be referenced instead, which will throw an exception.
+ *
+ * Handle resolution through item() is a lock-free acquire-load, so
+ * independent objects can be exercised concurrently from multiple host
+ * threads; the mutex is confined to add/copy/delete/clear. Handle
+ * storage uses fixed-capacity blocks allocated on demand, so entries
+ * never move once created. Concurrent use of one handle while another
+ * thread deletes that same handle remains the caller's responsibility.
  *
  * The Cabinet<M> class is implemented as a singlet. The constructor
  * is never explicitly called; instead, static function
@@ -66,21 +75,24 @@ template<class M, bool canDelete=true>
 class Cabinet
 {
 public:
-    typedef std::vector<M*>& dataRef;
     /**
      * Destructor. Delete all objects in the list.
      */
     virtual ~Cabinet() {
         clear();
+        for (auto& block : m_blocks) {
+            delete[] block.load(std::memory_order_relaxed);
+            block.store(nullptr, std::memory_order_relaxed);
+        }
     }
 
     /**
      * Add a new object. The index of the object is returned.
      */
     static int add(M* ptr) {
-        dataRef data = getData();
-        data.push_back(ptr);
-        return static_cast<int>(data.size()) - 1;
+        Cabinet& c = cabinet();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
+        return c.append(ptr);
     }
 
     /**
@@ -88,11 +100,11 @@ public:
      * object is returned.
      */
     static int newCopy(int i) {
-        dataRef data = getData();
+        Cabinet& c = cabinet();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
         try {
-            M* old = data[i];
-            data.push_back(new M(*old));
-            return static_cast<int>(data.size()) - 1;
+            M* old = &item(i);
+            return c.append(new M(*old));
         } catch (...) {
             return Cantera::handleAllExceptions(-1, -999);
         }
@@ -102,15 +114,17 @@ public:
      * Delete all objects but the first.
      */
     static int clear() {
-        dataRef data = getData();
-        for (size_t i = 1; i < data.size(); i++) {
-            del(i);
+        Cabinet& c = cabinet();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
+        size_t n = c.m_size.load(std::memory_order_relaxed);
+        for (size_t i = 1; i < n; i++) {
+            delNoLock(i);
         }
-        if (canDelete) {
-            delete data[0];
+        if (canDelete && n > 0) {
+            delete c.entry(0).load(std::memory_order_relaxed);
         }
-        data.clear();
-        add(new M);
+        c.m_size.store(0, std::memory_order_release);
+        c.append(new M);
         return 0;
     }
 
@@ -120,28 +134,18 @@ public:
      * in the list.
      */
     static void del(size_t n) {
-        dataRef data = getData();
-        if (n == 0) {
-            return;
-        }
-        if (data[n] != data[0]) {
-            if (canDelete) {
-                delete data[n];
-            }
-            data[n] = data[0];
-        } else {
-            throw Cantera::CanteraError("Cabinet::del",
-                                        "Attempt made to delete an already-deleted object.");
-        }
+        Cabinet& c = cabinet();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
+        delNoLock(n);
     }
 
     /**
      * Return a reference to object n.
      */
     static M& item(size_t n) {
-        dataRef data = getData();
-        if (n < data.size()) {
-            return *data[n];
+        Cabinet& c = cabinet();
+        if (n < c.m_size.load(std::memory_order_acquire)) {
+            return *c.entry(n).load(std::memory_order_acquire);
         } else {
             throw Cantera::CanteraError("Cabinet::item","index out of range {}", n);
         }
@@ -165,33 +169,96 @@ public:
      * if the object is not in the cabinet.
      */
     static int index(const M& obj) {
-        dataRef data = getData();
-        auto loc = std::find(data.begin(), data.end(), &obj);
-        if (loc != data.end()) {
-            return static_cast<int>(loc-data.begin());
-        } else {
-            return -1;
+        Cabinet& c = cabinet();
+        std::unique_lock<std::mutex> lock(c.m_mutex);
+        size_t n = c.m_size.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < n; i++) {
+            if (c.entry(i).load(std::memory_order_relaxed) == &obj) {
+                return static_cast<int>(i);
+            }
         }
+        return -1;
     }
 
     /**
      * Constructor.
      */
     Cabinet() {
-        m_table.push_back(new M);
+        for (auto& block : m_blocks) {
+            block.store(nullptr, std::memory_order_relaxed);
+        }
+        append(new M);
     }
 
 private:
+    //! log2 of the number of handles per storage block
+    static const size_t blockBits = 10;
+
+    //! Maximum number of storage blocks
+    static const size_t maxBlocks = 1024;
+
+    //! Delete object n; the caller holds the mutex
+    static void delNoLock(size_t n) {
+        Cabinet& c = cabinet();
+        if (n == 0) {
+            return;
+        }
+        if (n >= c.m_size.load(std::memory_order_relaxed)) {
+            throw Cantera::CanteraError("Cabinet::del",
+                                        "index out of range {}", n);
+        }
+        M* first = c.entry(0).load(std::memory_order_relaxed);
+        std::atomic<M*>& slot = c.entry(n);
+        M* old = slot.load(std::memory_order_relaxed);
+        if (old != first) {
+            if (canDelete) {
+                delete old;
+            }
+            slot.store(first, std::memory_order_release);
+        } else {
+            throw Cantera::CanteraError("Cabinet::del",
+                                        "Attempt made to delete an already-deleted object.");
+        }
+    }
+
+    //! Install *ptr* as the next handle; the caller holds the mutex (or is
+    //! the constructor)
+    int append(M* ptr) {
+        size_t n = m_size.load(std::memory_order_relaxed);
+        size_t b = n >> blockBits;
+        if (b >= maxBlocks) {
+            throw Cantera::CanteraError("Cabinet::add", "Too many objects");
+        }
+        if (!m_blocks[b].load(std::memory_order_relaxed)) {
+            std::atomic<M*>* block = new std::atomic<M*>[size_t(1) << blockBits];
+            for (size_t i = 0; i < (size_t(1) << blockBits); i++) {
+                block[i].store(nullptr, std::memory_order_relaxed);
+            }
+            m_blocks[b].store(block, std::memory_order_release);
+        }
+        entry(n).store(ptr, std::memory_order_release);
+        // the size is published last, so readers never observe the slot
+        // before the pointer is visible
+        m_size.store(n + 1, std::memory_order_release);
+        return static_cast<int>(n);
+    }
+
+    //! The slot holding handle n
+    std::atomic<M*>& entry(size_t n) {
+        std::atomic<M*>* block =
+            m_blocks[n >> blockBits].load(std::memory_order_acquire);
+        return block[n & ((size_t(1) << blockBits) - 1)];
+    }
+
     /**
-     * Static function that returns a pointer to the data member of
-     * the singleton Cabinet<M> instance. All member functions should
-     * access the data through this function.
+     * Static function that returns a reference to the singleton
+     * Cabinet<M> instance, creating it on first use.
      */
-    static dataRef getData() {
+    static Cabinet& cabinet() {
         if (s_storage == 0) {
             s_storage = new Cabinet<M, canDelete>();
         }
-        return s_storage->m_table;
+        return *s_storage;
     }
 
     /**
@@ -199,10 +266,15 @@ private:
      */
     static Cabinet<M, canDelete>* s_storage;
 
-    /**
-     * Vector to hold pointers to objects.
-     */
-    std::vector<M*> m_table;
+    //! Mutex guarding all mutating operations
+    std::mutex m_mutex;
+
+    //! Number of handles issued; published with release ordering
+    std::atomic<size_t> m_size{0};
+
+    //! Blocks of handle slots; blocks are allocated on demand and never
+    //! move, so readers need no lock
+    std::array<std::atomic<std::atomic<M*>*>, 1024> m_blocks;
 };
 
 #endif
@@ -16,6 +16,7 @@
 
 // Cantera includes
 #include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/kinetics/GasKinetics.h"
 #include "cantera/transport/TransportFactory.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/thermo/ThermoFactory.h"
@@ -246,6 +247,21 @@ extern "C" {
         }
     }
 
+    int thermo_evaluateStates(int n, size_t nStates, const double* T,
+                              const double* P, const double* Y, double* rho,
+                              double* h, double* s, double* cp)
+    {
+        try {
+            // one boundary crossing and one handle lookup per field; the
+            // batched evaluation loops the states internally
+            ThermoCabinet::item(n).evaluateStates(nStates, T, P, Y, rho,
+                                                  h, s, cp);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     int thermo_setMassFractionsByName(int n, const char* y)
     {
         try {
@@ -1138,6 +1154,23 @@ extern "C" {
         }
     }
 
+    int kin_getNetProductionRatesBatch(int n, size_t nStates, const double* T,
+                                       const double* rho, const double* Y,
+                                       double* wdot)
+    {
+        try {
+            GasKinetics* k = dynamic_cast<GasKinetics*>(&KineticsCabinet::item(n));
+            if (!k) {
+                throw CanteraError("kin_getNetProductionRatesBatch",
+                    "Batched evaluation requires a gas kinetics manager.");
+            }
+            k->getNetProductionRates(nStates, T, rho, Y, wdot);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     int kin_getNetProductionRates(int n, size_t len, double* wdot)
     {
         try {
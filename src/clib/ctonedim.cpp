@@ -645,6 +645,80 @@ extern "C" {
         }
     }
 
+    int sim1D_getSolution(int i, int idom, size_t len, double* values,
+                          int pointMajor)
+    {
+        try {
+            Sim1D& sim = SimCabinet::item(i);
+            sim.checkDomainIndex(idom);
+            Domain1D& dom = sim.domain(idom);
+            size_t np = dom.nPoints();
+            size_t nc = dom.nComponents();
+            if (len < np * nc) {
+                throw CanteraError("sim1D_getSolution",
+                                   "Array too small ({} < {})", len, np * nc);
+            }
+            // one pass over the domain block; layout selected by the caller
+            for (size_t n = 0; n < np; n++) {
+                for (size_t c = 0; c < nc; c++) {
+                    double value = sim.value(idom, c, n);
+                    if (pointMajor) {
+                        values[n * nc + c] = value;
+                    } else {
+                        values[c * np + n] = value;
+                    }
+                }
+            }
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int sim1D_setSolution(int i, int idom, size_t len, const double* values,
+                          int pointMajor)
+    {
+        try {
+            Sim1D& sim = SimCabinet::item(i);
+            sim.checkDomainIndex(idom);
+            Domain1D& dom = sim.domain(idom);
+            size_t np = dom.nPoints();
+            size_t nc = dom.nComponents();
+            if (len < np * nc) {
+                throw CanteraError("sim1D_setSolution",
+                                   "Array too small ({} < {})", len, np * nc);
+            }
+            for (size_t n = 0; n < np; n++) {
+                for (size_t c = 0; c < nc; c++) {
+                    double value = pointMajor ? values[n * nc + c]
+                                              : values[c * np + n];
+                    sim.setValue(idom, c, n, value);
+                }
+            }
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int sim1D_getGrid(int i, int idom, size_t len, double* z)
+    {
+        try {
+            Sim1D& sim = SimCabinet::item(i);
+            sim.checkDomainIndex(idom);
+            Domain1D& dom = sim.domain(idom);
+            if (len < dom.nPoints()) {
+                throw CanteraError("sim1D_getGrid",
+                                   "Array too small ({} < {})",
+                                   len, dom.nPoints());
+            }
+            std::copy(dom.grid().begin(), dom.grid().end(), z);
+            return static_cast<int>(dom.nPoints());
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     double sim1D_value(int i, int idom, int icomp, int localPoint)
     {
         try {
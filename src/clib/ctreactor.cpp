@@ -13,6 +13,7 @@
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/zerodim.h"
+#include "cantera/zeroD/ReactorEnsemble.h"
 #include "Cabinet.h"
 
 using namespace Cantera;
@@ -293,6 +294,57 @@ extern "C" {
         }
     }
 
+    int reactornet_getState(int i, size_t len, double* y)
+    {
+        try {
+            ReactorNet& net = NetworkCabinet::item(i);
+            if (len < net.neq()) {
+                throw CanteraError("reactornet_getState",
+                                   "Array too small ({} < {})", len, net.neq());
+            }
+            net.getState(y);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int reactornet_advanceAll(size_t n, const int* handles, double t,
+                              int nThreads)
+    {
+        try {
+            // one boundary crossing advances the whole ensemble through the
+            // native parallel driver
+            ReactorEnsemble ensemble;
+            ensemble.setThreads(nThreads < 0 ? 0 : size_t(nThreads));
+            for (size_t j = 0; j < n; j++) {
+                ensemble.addNet(shared_ptr<ReactorNet>(
+                    &NetworkCabinet::item(handles[j]),
+                    [](ReactorNet*) { /* owned by the cabinet */ }));
+            }
+            ensemble.advanceAll(t);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int reactornet_recordedData(int i, size_t len, double* data)
+    {
+        try {
+            const vector_fp& recorded = NetworkCabinet::item(i).recordedData();
+            if (len < recorded.size()) {
+                throw CanteraError("reactornet_recordedData",
+                                   "Array too small ({} < {})",
+                                   len, recorded.size());
+            }
+            std::copy(recorded.begin(), recorded.end(), data);
+            return static_cast<int>(recorded.size());
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     double reactornet_step(int i)
     {
         try {
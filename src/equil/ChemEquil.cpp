@@ -8,6 +8,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/equil/ChemEquil.h"
+#include "cantera/numerics/eigen_dense.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/equil/MultiPhaseEquil.h"
 #include "cantera/thermo/ThermoPhase.h"
@@ -64,6 +65,12 @@ ChemEquil::~ChemEquil()
 
 void ChemEquil::initialize(ThermoPhase& s)
 {
+    if (m_phase == &s && m_kk == s.nSpecies() && m_mm == s.nElements()) {
+        // the solver is already sized for this phase; reuse the allocated
+        // workspaces and composition data
+        return;
+    }
+
     // store a pointer to s and some of its properties locally.
     m_phase = &s;
     m_p0 = s.refPressure();
@@ -497,24 +504,34 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         }
     }
 
-    setInitialMoles(s, elMolesGoal,loglevel);
-
-    // Calculate initial estimates of the element potentials. This algorithm
-    // uses the MultiPhaseEquil object's initialization capabilities to
-    // calculate an initial estimate of the mole fractions for a set of linearly
-    // independent component species. Then, the element potentials are solved
-    // for based on the chemical potentials of the component species.
-    estimateElementPotentials(s, x, elMolesGoal);
-
-    // Do a better estimate of the element potentials. We have found that the
-    // current estimate may not be good enough to avoid drastic numerical issues
-    // associated with the use of a numerically generated Jacobian.
-    //
-    // The Brinkley algorithm assumes a constant T, P system and uses a
-    // linearized analytical Jacobian that turns out to be very stable.
-    int info = estimateEP_Brinkley(s, x, elMolesGoal);
-    if (info == 0) {
+    int info = 0;
+    if (m_warmStart && m_lambdaWarm.size() == m_mm) {
+        // seed from the previous converged element potentials and skip the
+        // estimation phase entirely
+        copy(m_lambdaWarm.begin(), m_lambdaWarm.end(), x.begin());
         setToEquilState(s, x, s.temperature());
+    } else {
+        setInitialMoles(s, elMolesGoal,loglevel);
+
+        // Calculate initial estimates of the element potentials. This
+        // algorithm uses the MultiPhaseEquil object's initialization
+        // capabilities to calculate an initial estimate of the mole
+        // fractions for a set of linearly independent component species.
+        // Then, the element potentials are solved for based on the chemical
+        // potentials of the component species.
+        estimateElementPotentials(s, x, elMolesGoal);
+
+        // Do a better estimate of the element potentials. We have found
+        // that the current estimate may not be good enough to avoid drastic
+        // numerical issues associated with the use of a numerically
+        // generated Jacobian.
+        //
+        // The Brinkley algorithm assumes a constant T, P system and uses a
+        // linearized analytical Jacobian that turns out to be very stable.
+        info = estimateEP_Brinkley(s, x, elMolesGoal);
+        if (info == 0) {
+            setToEquilState(s, x, s.temperature());
+        }
     }
 
     // Install the log(temp) into the last solution unknown slot.
@@ -542,6 +559,10 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     vector_fp oldx(nvar, 0.0); // old solution
     vector_fp oldresid(nvar, 0.0);
 
+    Eigen::PartialPivLU<Eigen::MatrixXd> jacLU;
+    int jacAge = 0;
+    double lastF = 1e300;
+    double lastDamp = 1.0;
     for (int iter = 0; iter < options.maxIterations; iter++) {
         // check for convergence.
         equilResidual(s, x, elMolesGoal, res_trial, xval, yval);
@@ -590,6 +611,9 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                     "Temperature ({} K) outside valid range of {} K "
                     "to {} K", s.temperature(), s.minTemp(), s.maxTemp());
             }
+            // retain the converged element potentials for warm starts and
+            // for retrieval via elementPotentials()
+            m_lambdaWarm.assign(x.begin(), x.begin() + m_mm);
             return 0;
         }
         // compute the residual and the Jacobian using the current
@@ -597,8 +621,22 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         equilResidual(s, x, elMolesGoal, res_trial, xval, yval);
         f = 0.5*dot(res_trial.begin(), res_trial.end(), res_trial.begin());
 
-        // Compute the Jacobian matrix
-        equilJacobian(s, x, elMolesGoal, jac, xval, yval);
+        // Re-form and refactor the Jacobian only when step quality
+        // degrades: the element-potential Jacobian varies slowly along the
+        // iteration path, so a retained factorization is reused while the
+        // residual norm keeps contracting under full steps
+        bool rebuildJac = (iter == 0) || jacAge >= 4 || lastDamp < 0.95
+                          || f > 0.5 * lastF;
+        lastF = f;
+        if (rebuildJac) {
+            // Compute the Jacobian matrix
+            equilJacobian(s, x, elMolesGoal, jac, xval, yval);
+            jacLU.compute(Eigen::Map<Eigen::MatrixXd>(
+                jac.ptrColumn(0), nvar, nvar));
+            jacAge = 0;
+        } else {
+            jacAge++;
+        }
 
         if (m_loglevel > 0) {
             writelogf("Jacobian matrix %d:\n", iter);
@@ -625,15 +663,17 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         double oldf = f;
         scale(res_trial.begin(), res_trial.end(), res_trial.begin(), -1.0);
 
-        // Solve the system
-        try {
-            info = solve(jac, res_trial.data());
-        } catch (CanteraError& err) {
-            s.restoreState(state);
-            throw CanteraError("ChemEquil::equilibrate",
-                               "Jacobian is singular. \nTry adding more species, "
-                               "changing the elemental composition slightly, \nor removing "
-                               "unused elements.\n\n" + err.getMessage());
+        // Solve the system using the retained factorization
+        {
+            Eigen::Map<Eigen::VectorXd> r(res_trial.data(), nvar);
+            r = jacLU.solve(r);
+            if (!r.allFinite()) {
+                s.restoreState(state);
+                throw CanteraError("ChemEquil::equilibrate",
+                                   "Jacobian is singular. \nTry adding more species, "
+                                   "changing the elemental composition slightly, \nor removing "
+                                   "unused elements.\n");
+            }
         }
 
         // find the factor by which the Newton step can be multiplied
@@ -666,10 +706,12 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
 
         // multiply the step by the scaling factor
         scale(res_trial.begin(), res_trial.end(), res_trial.begin(), fctr);
+        lastDamp = fctr;
 
         if (!dampStep(s, oldx, oldf, grad, res_trial,
                       x, f, elMolesGoal , xval, yval)) {
             fail++;
+            lastDamp = 0.0; // force a Jacobian rebuild after a failed step
             if (fail > 3) {
                 s.restoreState(state);
                 throw CanteraError("ChemEquil::equilibrate",
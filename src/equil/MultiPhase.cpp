@@ -13,6 +13,9 @@
 #include "cantera/equil/vcs_MultiPhaseEquil.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/base/stringUtils.h"
+
+#include <mutex>
+#include <thread>
 #include "cantera/base/utilities.h"
 
 using namespace std;
@@ -453,6 +456,11 @@ void MultiPhase::calcElemAbundances() const
 {
     size_t loc = 0;
     doublereal spMoles;
+    if (m_abundCache.size() != nPhases()) {
+        m_abundCache.assign(nPhases(), vector_fp());
+        m_abundCacheX.assign(nPhases(), vector_fp());
+        m_abundCacheMoles.assign(nPhases(), -1.0);
+    }
     for (size_t eGlobal = 0; eGlobal < m_nel; eGlobal++) {
         m_elemAbundances[eGlobal] = 0.0;
     }
@@ -460,12 +468,30 @@ void MultiPhase::calcElemAbundances() const
         ThermoPhase* p = m_phase[ip];
         size_t nspPhase = p->nSpecies();
         doublereal phasemoles = m_moles[ip];
-        for (size_t ik = 0; ik < nspPhase; ik++) {
-            size_t kGlobal = loc + ik;
-            spMoles = m_moleFractions[kGlobal] * phasemoles;
-            for (size_t eGlobal = 0; eGlobal < m_nel; eGlobal++) {
-                m_elemAbundances[eGlobal] += m_atoms(eGlobal, kGlobal) * spMoles;
+
+        // per-phase contributions are cached; only phases whose moles or
+        // composition changed since the last call are recomputed
+        vector_fp& contrib = m_abundCache[ip];
+        vector_fp& xLast = m_abundCacheX[ip];
+        const double* xf = &m_moleFractions[loc];
+        bool changed = contrib.size() != m_nel
+            || m_abundCacheMoles[ip] != phasemoles
+            || xLast.size() != nspPhase
+            || !std::equal(xf, xf + nspPhase, xLast.begin());
+        if (changed) {
+            contrib.assign(m_nel, 0.0);
+            for (size_t ik = 0; ik < nspPhase; ik++) {
+                size_t kGlobal = loc + ik;
+                spMoles = m_moleFractions[kGlobal] * phasemoles;
+                for (size_t eGlobal = 0; eGlobal < m_nel; eGlobal++) {
+                    contrib[eGlobal] += m_atoms(eGlobal, kGlobal) * spMoles;
+                }
             }
+            xLast.assign(xf, xf + nspPhase);
+            m_abundCacheMoles[ip] = phasemoles;
+        }
+        for (size_t eGlobal = 0; eGlobal < m_nel; eGlobal++) {
+            m_elemAbundances[eGlobal] += contrib[eGlobal];
         }
         loc += nspPhase;
     }
@@ -642,6 +668,65 @@ double MultiPhase::equilibrate_MultiPhaseEquil(int XY, doublereal err,
     return -1.0;
 }
 
+void MultiPhase::equilibrateBatch(const std::string& XY, size_t nStates,
+                                  double* T, const double* P, double* moles,
+                                  size_t nThreads)
+{
+    size_t nsp = nSpecies();
+    size_t nt = std::max<size_t>(1, std::min(nThreads, nStates));
+    size_t chunk = (nStates + nt - 1) / nt;
+
+    // each worker owns an independent MultiPhase over cloned phases
+    std::mutex errMutex;
+    std::string firstError;
+    std::vector<std::thread> workers;
+    workers.reserve(nt);
+    auto runChunk = [&](size_t lo, size_t hi) {
+        try {
+            std::vector<shared_ptr<ThermoPhase>> phases;
+            MultiPhase mix;
+            for (size_t n = 0; n < nPhases(); n++) {
+                phases.push_back(m_phase[n]->clone());
+                mix.addPhase(phases.back().get(), 0.0);
+            }
+            mix.init();
+            for (size_t i = lo; i < hi; i++) {
+                mix.setMoles(moles + i * nsp);
+                mix.setTemperature(T[i]);
+                mix.setPressure(P[i]);
+                // the converged composition of the previous cell is still
+                // installed and serves as the initial estimate
+                mix.equilibrate(XY);
+                mix.getMoles(moles + i * nsp);
+                T[i] = mix.temperature();
+            }
+        } catch (std::exception& err) {
+            std::unique_lock<std::mutex> lock(errMutex);
+            if (firstError.empty()) {
+                firstError = err.what();
+            }
+        }
+    };
+    if (nt < 2) {
+        runChunk(0, nStates);
+    } else {
+        for (size_t w = 0; w < nt; w++) {
+            size_t lo = w * chunk;
+            size_t hi = std::min(nStates, lo + chunk);
+            if (lo >= hi) {
+                break;
+            }
+            workers.emplace_back(runChunk, lo, hi);
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    if (!firstError.empty()) {
+        throw CanteraError("MultiPhase::equilibrateBatch", firstError);
+    }
+}
+
 void MultiPhase::equilibrate(const std::string& XY, const std::string& solver,
                              double rtol, int max_steps, int max_iter,
                              int estimate_equil, int log_level)
@@ -826,10 +911,34 @@ void MultiPhase::uploadMoleFractionsFromPhases()
 
 void MultiPhase::updatePhases() const
 {
+    bool fullPush = (m_lastPhaseX.size() != m_moleFractions.size()
+                     || m_lastPhaseStateNum.size() != nPhases());
+    if (fullPush) {
+        m_lastPhaseX.assign(m_moleFractions.size(), -1.0);
+        m_lastPhaseStateNum.assign(nPhases(), -1);
+    }
     size_t loc = 0;
     for (size_t p = 0; p < nPhases(); p++) {
-        m_phase[p]->setState_TPX(m_temp, m_press, &m_moleFractions[loc]);
-        loc += m_phase[p]->nSpecies();
+        size_t nsp = m_phase[p]->nSpecies();
+        // push state into a phase only when its mapped mole-fraction
+        // segment or the shared (T, P) differ from what it holds, so a
+        // change in one phase does not invalidate the others; the phase's
+        // composition number detects external modifications of the phase
+        bool changed = fullPush
+            || m_phase[p]->stateMFNumber() != m_lastPhaseStateNum[p]
+            || !std::equal(m_moleFractions.begin() + loc,
+                           m_moleFractions.begin() + loc + nsp,
+                           m_lastPhaseX.begin() + loc)
+            || m_phase[p]->temperature() != m_temp
+            || m_phase[p]->pressure() != m_press;
+        if (changed) {
+            m_phase[p]->setState_TPX(m_temp, m_press, &m_moleFractions[loc]);
+            std::copy(m_moleFractions.begin() + loc,
+                      m_moleFractions.begin() + loc + nsp,
+                      m_lastPhaseX.begin() + loc);
+            m_lastPhaseStateNum[p] = m_phase[p]->stateMFNumber();
+        }
+        loc += nsp;
         m_temp_OK[p] = true;
         if (m_temp < m_phase[p]->minTemp() || m_temp > m_phase[p]->maxTemp()) {
             m_temp_OK[p] = false;
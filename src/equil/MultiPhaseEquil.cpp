@@ -131,6 +131,21 @@ MultiPhaseEquil::MultiPhaseEquil(MultiPhase* mix, bool start, int loglevel) : m_
     if (start) {
         setInitialMoles(loglevel-1);
     }
+
+    // Reuse the component basis converged by a previous solve on this
+    // mixture, if the included species and elements are unchanged;
+    // computeN() still verifies that the cached components dominate their
+    // elements and re-runs the elimination otherwise.
+    MultiPhase::EquilBasisCache& cache = mix->equilBasisCache();
+    if (cache.valid && cache.species == m_species
+        && cache.elements == m_element)
+    {
+        m_order = cache.order;
+        m_N = cache.N;
+        m_A = cache.A;
+        m_solnrxn = cache.solnrxn;
+        m_force = false;
+    }
     computeN();
 
     // Take a very small step in composition space, so that no
@@ -175,6 +190,17 @@ doublereal MultiPhaseEquil::equilibrate(int XY, doublereal err,
                            maxsteps, error());
     }
     finish();
+
+    // retain the converged basis for reuse by subsequent solves on this
+    // mixture
+    MultiPhase::EquilBasisCache& cache = m_mix->equilBasisCache();
+    cache.species = m_species;
+    cache.elements = m_element;
+    cache.order = m_order;
+    cache.N = m_N;
+    cache.A = m_A;
+    cache.solnrxn = m_solnrxn;
+    cache.valid = true;
     return error();
 }
 
@@ -446,13 +446,19 @@ void vcs_VolPhase::setState_TP(const double temp, const double pres)
     }
     TP_ptr->setElectricPotential(m_phi);
     TP_ptr->setState_TP(temp, pres);
+    bool tempChanged = (Temp_ != temp);
     Temp_ = temp;
     Pres_ = pres;
     m_UpToDate_AC = false;
     m_UpToDate_VolStar = false;
     m_UpToDate_VolPM = false;
     m_UpToDate_GStar = false;
-    m_UpToDate_G0 = false;
+    if (tempChanged) {
+        // the reference-state Gibbs energies depend on temperature only;
+        // pressure-only updates (as in VCS total-volume iterations) keep
+        // them cached
+        m_UpToDate_G0 = false;
+    }
 }
 
 void vcs_VolPhase::setState_T(const double temp)
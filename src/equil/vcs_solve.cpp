@@ -63,7 +63,9 @@ VCS_SOLVE::VCS_SOLVE(MultiPhase* mphase, int printLvl) :
     m_totalVol(mphase->volume()),
     m_Faraday_dim(Faraday / (m_temperature * GasConstant)),
     m_VCount(0),
+#if CT_VCS_DEBUG
     m_debug_print_lvl(0),
+#endif
     m_timing_print_lvl(1)
 {
     m_speciesThermoList.resize(m_nsp);
@@ -1162,11 +1164,16 @@ double VCS_SOLVE::vcs_phaseStabilityTest(const size_t iph)
     // We will do a full Newton calculation later, but for now, ...
     bool doSuccessiveSubstitution = true;
     double funcPhaseStability;
-    vector_fp X_est(nsp, 0.0);
-    vector_fp delFrac(nsp, 0.0);
-    vector_fp E_phi(nsp, 0.0);
-    vector_fp fracDelta_old(nsp, 0.0);
-    vector_fp fracDelta_raw(nsp, 0.0);
+    vector_fp& X_est = m_wsStab1;
+    vector_fp& delFrac = m_wsStab2;
+    vector_fp& E_phi = m_wsStab3;
+    vector_fp& fracDelta_old = m_wsStab4;
+    vector_fp& fracDelta_raw = m_wsStab5;
+    X_est.assign(nsp, 0.0);
+    delFrac.assign(nsp, 0.0);
+    E_phi.assign(nsp, 0.0);
+    fracDelta_old.assign(nsp, 0.0);
+    fracDelta_raw.assign(nsp, 0.0);
     vector<size_t> creationGlobalRxnNumbers(nsp, npos);
     m_deltaGRxn_Deficient = m_deltaGRxn_old;
     vector_fp feSpecies_Deficient = m_feSpecies_old;
@@ -1488,7 +1495,14 @@ double VCS_SOLVE::vcs_VolTotal(const double tkelvin, const double pres,
 int VCS_SOLVE::vcs_prep(int printLvl)
 {
     int retn = VCS_SUCCESS;
+#if CT_VCS_DEBUG
     m_debug_print_lvl = printLvl;
+#else
+    if (printLvl > 0) {
+        warn_user("VCS_SOLVE::vcs_setDebugPrinting",
+            "VCS diagnostics were compiled out (CT_VCS_DEBUG=0).");
+    }
+#endif
 
     // Calculate the Single Species status of phases
     // Also calculate the number of species per phase
@@ -28,7 +28,8 @@ namespace Cantera
 void VCS_SOLVE::checkDelta1(double* const dsLocal,
                             double* const delTPhMoles, size_t kspec)
 {
-    vector_fp dchange(m_numPhases, 0.0);
+    vector_fp& dchange = m_wsPhaseChange;
+    dchange.assign(m_numPhases, 0.0);
     for (size_t k = 0; k < kspec; k++) {
         if (m_speciesUnknownType[k] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
             size_t iph = m_phaseID[k];
@@ -58,7 +59,9 @@ int VCS_SOLVE::vcs_solve_TP(int print_lvl, int printDetails, int maxit)
 
     char ANOTE[128];
     // Set the debug print lvl to the same as the print lvl.
+#if CT_VCS_DEBUG
     m_debug_print_lvl = printDetails;
+#endif
     if (printDetails > 0 && print_lvl == 0) {
         print_lvl = 1;
     }
@@ -2012,7 +2015,7 @@ int VCS_SOLVE::vcs_basopt(const bool doJustComponents, double aw[], double sa[],
     size_t k;
     size_t juse = npos;
     size_t jlose = npos;
-    DenseMatrix C;
+    DenseMatrix& C = m_wsBasisMatrix;
     clockWC tickTock;
     if (m_debug_print_lvl >= 2) {
         plogf("   ");
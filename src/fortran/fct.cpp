@@ -74,6 +74,18 @@ std::string f2string(const char* s, ftnlen n)
 /**
  * Exported functions.
  */
+namespace {
+
+//! Persistent caller-owned state buffers registered per phase handle
+//! @see phase_registerstatebuffer_()
+std::map<int, double*>& stateBuffers()
+{
+    static std::map<int, double*> buffers;
+    return buffers;
+}
+
+} // anonymous namespace
+
 extern "C" {
 
     status_t cantera_error_(const char* proc, const char* msg,
@@ -294,6 +306,51 @@ extern "C" {
         return 0;
     }
 
+    status_t phase_registerstatebuffer_(const integer* n, double* y)
+    {
+        // Register a persistent caller-owned mass-fraction buffer for the
+        // phase handle. Subsequent phase_pushstate_/phase_pullstate_ calls
+        // transfer the complete (T, rho, Y) state through this buffer in a
+        // single crossing of the language boundary, without per-call buffer
+        // arguments or normalization. The buffer must stay valid (and hold
+        // nSpecies values) until re-registered or the handle is deleted.
+        try {
+            _fph(n); // validate the handle
+            stateBuffers()[*n] = y;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+        return 0;
+    }
+
+    status_t phase_pushstate_(const integer* n, const double* t,
+                              const double* rho)
+    {
+        try {
+            ThermoPhase* p = _fph(n);
+            double* y = stateBuffers().at(*n);
+            p->setMassFractions_NoNorm(y);
+            p->setTemperature(*t);
+            p->setDensity(*rho);
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+        return 0;
+    }
+
+    status_t phase_pullstate_(const integer* n, double* t, double* rho)
+    {
+        try {
+            ThermoPhase* p = _fph(n);
+            p->getMassFractions(stateBuffers().at(*n));
+            *t = p->temperature();
+            *rho = p->density();
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+        return 0;
+    }
+
     status_t phase_getatomicweights_(const integer* n, double* atw)
     {
         try {
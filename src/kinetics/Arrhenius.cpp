@@ -4,11 +4,20 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/kinetics/Arrhenius.h"
+#include "cantera/base/global.h"
 #include "cantera/thermo/ThermoPhase.h"
 
 namespace Cantera
 {
 
+unique_ptr<MultiRateBase> ArrheniusRate::newMultiRate() const
+{
+    if (batched_rate_evaluators_used()) {
+        return unique_ptr<MultiRateBase>(new ArrheniusMultiRate);
+    }
+    return unique_ptr<MultiRateBase>(new MultiRate<ArrheniusRate, ArrheniusData>);
+}
+
 ArrheniusBase::ArrheniusBase(double A, double b, double Ea)
     : m_A(A)
     , m_b(b)
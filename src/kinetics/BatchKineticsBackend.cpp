@@ -0,0 +1,91 @@
+//! @file BatchKineticsBackend.cpp Batched chemistry evaluation backends
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/BatchKineticsBackend.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#include <atomic>
+#include <thread>
+
+namespace Cantera
+{
+
+//! Host-side reference implementation of BatchKineticsBackend.
+/*!
+ * Partitions the batch across worker threads, each owning a clone of the
+ * phase and kinetics objects (sharing the immutable mechanism tables), and
+ * evaluates the states through the batched GasKinetics ensemble path. This
+ * is the fallback used when no accelerator backend is available, and the
+ * semantic reference an accelerator implementation must match.
+ */
+class HostBatchKineticsBackend : public BatchKineticsBackend
+{
+public:
+    explicit HostBatchKineticsBackend(size_t nThreads)
+        : m_threads(nThreads)
+    {
+    }
+
+    virtual void initialize(GasKinetics& kin) override {
+        m_thermo.clear();
+        m_kin.clear();
+        size_t nt = std::max<size_t>(1, m_threads);
+        for (size_t w = 0; w < nt; w++) {
+            auto th = kin.thermo().clone();
+            m_kin.push_back(
+                std::dynamic_pointer_cast<GasKinetics>(kin.clone({th})));
+            m_thermo.push_back(th);
+        }
+    }
+
+    virtual void evaluate(size_t nStates, const double* T, const double* rho,
+                          const double* Y, double* wdot) override {
+        if (m_kin.empty()) {
+            throw CanteraError("HostBatchKineticsBackend::evaluate",
+                               "Backend is not initialized.");
+        }
+        size_t kk = m_thermo[0]->nSpecies();
+        size_t nt = std::min(m_kin.size(), std::max<size_t>(nStates, 1));
+        size_t chunk = (nStates + nt - 1) / nt;
+        std::vector<std::thread> workers;
+        workers.reserve(nt);
+        for (size_t w = 0; w < nt; w++) {
+            size_t lo = w * chunk;
+            size_t hi = std::min(nStates, lo + chunk);
+            if (lo >= hi) {
+                break;
+            }
+            workers.emplace_back([this, w, lo, hi, kk, T, rho, Y, wdot]() {
+                m_kin[w]->getNetProductionRates(hi - lo, T + lo, rho + lo,
+                                                Y + lo * kk, wdot + lo * kk);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    virtual std::string backendType() const override {
+        return "host-threaded";
+    }
+
+protected:
+    size_t m_threads; //!< Number of worker threads
+    std::vector<shared_ptr<ThermoPhase>> m_thermo; //!< Per-worker phases
+    std::vector<shared_ptr<GasKinetics>> m_kin; //!< Per-worker kinetics
+};
+
+shared_ptr<BatchKineticsBackend> newBatchKineticsBackend(size_t nThreads)
+{
+#ifdef CT_ENABLE_CUDA
+    // An accelerator implementation registers itself here when the library
+    // is built with device support; see BatchKineticsBackend.h. None is
+    // bundled with this build.
+#endif
+    return make_shared<HostBatchKineticsBackend>(nThreads);
+}
+
+}
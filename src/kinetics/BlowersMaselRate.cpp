@@ -4,6 +4,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/kinetics/BlowersMaselRate.h"
+#include "cantera/base/global.h"
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/thermo/ThermoPhase.h"
@@ -11,6 +12,15 @@
 namespace Cantera
 {
 
+unique_ptr<MultiRateBase> BlowersMaselRate::newMultiRate() const
+{
+    if (batched_rate_evaluators_used()) {
+        return unique_ptr<MultiRateBase>(new BlowersMaselMultiRate);
+    }
+    return unique_ptr<MultiRateBase>(
+        new MultiRate<BlowersMaselRate, BlowersMaselData>);
+}
+
 BlowersMaselData::BlowersMaselData()
     : ready(false)
     , density(NAN)
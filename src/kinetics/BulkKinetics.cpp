@@ -58,6 +58,27 @@ void BulkKinetics::getDeltaEntropy(doublereal* deltaS)
     getReactionDelta(m_grt.data(), deltaS);
 }
 
+void BulkKinetics::getDeltaAll(double* deltaH, double* deltaS, double* deltaG)
+{
+    // one fused fetch of the species partial molar properties serves all
+    // requested contractions; the chemical potentials come from the same
+    // pass as mu = h - T*s
+    vector_fp& h = m_grt;
+    m_sbuf_h.resize(nTotalSpecies());
+    m_sbuf_s.resize(nTotalSpecies());
+    thermo().getPartialMolarAll(m_sbuf_h.data(), m_sbuf_s.data(), nullptr,
+                                h.data());
+    if (deltaG) {
+        getReactionDelta(h.data(), deltaG);
+    }
+    if (deltaH) {
+        getReactionDelta(m_sbuf_h.data(), deltaH);
+    }
+    if (deltaS) {
+        getReactionDelta(m_sbuf_s.data(), deltaS);
+    }
+}
+
 void BulkKinetics::getDeltaSSGibbs(doublereal* deltaG)
 {
     // Get the standard state chemical potentials of the species. This is the
@@ -224,7 +245,20 @@ void BulkKinetics::resizeSpecies()
 }
 
 void BulkKinetics::setMultiplier(size_t i, double f) {
+    bool wasZero = (multiplier(i) == 0.);
+    bool wasIdentity = (multiplier(i) == 1.);
+    if (wasIdentity && f != 1.) {
+        m_nPerturbed++;
+    } else if (!wasIdentity && f == 1.) {
+        m_nPerturbed--;
+    }
     Kinetics::setMultiplier(i, f);
+    if (wasZero != (f == 0.)) {
+        // dormant reactions are skipped by their rate evaluator entirely
+        for (auto& rates : m_bulk_rates) {
+            rates->setActive(i, f != 0.);
+        }
+    }
     m_ROP_ok = false;
 }
 
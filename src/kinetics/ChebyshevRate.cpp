@@ -9,6 +9,14 @@
 namespace Cantera
 {
 
+unique_ptr<MultiRateBase> ChebyshevRate::newMultiRate() const
+{
+    if (batched_rate_evaluators_used()) {
+        return unique_ptr<MultiRateBase>(new ChebyshevMultiRate);
+    }
+    return unique_ptr<MultiRateBase>(new MultiRate<ChebyshevRate, ChebyshevData>);
+}
+
 void ChebyshevData::update(double T)
 {
     throw CanteraError("ChebyshevData::update",
@@ -17,6 +17,10 @@ CustomFunc1Rate::CustomFunc1Rate()
 void CustomFunc1Rate::setRateFunction(shared_ptr<Func1> f)
 {
     m_ratefunc = f;
+    // flatten the expression tree; evaluation then runs a linear tape with
+    // the most recent result memoized, so reactions sharing one function
+    // object evaluate it once per state
+    m_tape.compile(*f);
     m_valid = true;
 }
 
@@ -31,7 +35,7 @@ void CustomFunc1Rate::validate(const std::string& equation, const Kinetics& kin)
 double CustomFunc1Rate::evalFromStruct(const ArrheniusData& shared_data) const
 {
     if (m_ratefunc) {
-        return m_ratefunc->eval(shared_data.temperature);
+        return m_tape.eval(shared_data.temperature);
     }
     return NAN;
 }
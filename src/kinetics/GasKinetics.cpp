@@ -6,8 +6,12 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/base/global.h"
+#include "cantera/base/profiling.h"
 #include "cantera/thermo/ThermoPhase.h"
 
+#include <numeric>
+
 using namespace std;
 
 namespace Cantera
@@ -15,7 +19,8 @@ namespace Cantera
 GasKinetics::GasKinetics(ThermoPhase* thermo) :
     BulkKinetics(thermo),
     m_logStandConc(0.0),
-    m_pres(0.0)
+    m_pres(0.0),
+    m_kc_ok(false)
 {
     setDerivativeSettings(AnyMap()); // use default settings
 }
@@ -28,23 +33,122 @@ void GasKinetics::resizeReactions()
     m_sbuf0.resize(nTotalSpecies());
     m_state.resize(thermo().stateSize());
 
+    // Optionally evaluate the linear stoichiometry operations in updateROP()
+    // as CSR matrix-vector products with sequential memory access
+    bool spmv = batched_rate_evaluators_used();
+    m_reactantStoich.setSpmvMode(spmv);
+    m_productStoich.setSpmvMode(spmv);
+    m_revProductStoich.setSpmvMode(spmv);
+
+    // geometry changed; cached rates of progress and state epochs are stale
+    m_ROP_ok = false;
+    m_kc_ok = false;
+    m_stateNumC = -1;
+
     BulkKinetics::resizeReactions();
 }
 
+void GasKinetics::getNetProductionRates(size_t nStates, const double* T,
+                                        const double* density, const double* Y,
+                                        double* wdot)
+{
+    ThermoPhase& phase = thermo();
+    size_t kk = phase.nSpecies();
+
+    // process states in ascending temperature order; states with matching
+    // temperatures then hit the cached temperature-dependent updates in
+    // update_rates_T()
+    vector<size_t> order(nStates);
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(),
+         [T](size_t i, size_t j) { return T[i] < T[j]; });
+
+    for (size_t n : order) {
+        phase.setMassFractions_NoNorm(Y + n * kk);
+        phase.setTemperature(T[n]);
+        phase.setDensity(density[n]);
+        Kinetics::getNetProductionRates(wdot + n * kk);
+    }
+}
+
 void GasKinetics::getThirdBodyConcentrations(double* concm)
 {
     updateROP();
     std::copy(m_concm.begin(), m_concm.end(), concm);
 }
 
+void GasKinetics::enableRateTables(double Tmin, double Tmax, size_t nPoints)
+{
+    if (nPoints < 2 || Tmin <= 0 || Tmax <= Tmin) {
+        throw CanteraError("GasKinetics::enableRateTables",
+            "Need Tmax > Tmin > 0 and at least two nodes.");
+    }
+    // build log(k) tables at the current pressure and composition, with
+    // nodes uniform in 1/T so linear interpolation matches the Arrhenius
+    // form exactly for simple rates
+    vector_fp state;
+    thermo().saveState(state);
+    size_t nr = nReactions();
+    m_rateTabX.resize(nPoints);
+    m_rateTabLogK.assign(nPoints * nr, 0.0);
+    double x0 = 1.0 / Tmax;
+    double x1 = 1.0 / Tmin;
+    for (size_t n = 0; n < nPoints; n++) {
+        m_rateTabX[n] = x0 + (x1 - x0) * n / (nPoints - 1);
+        thermo().setTemperature(1.0 / m_rateTabX[n]);
+        m_rateTabOn = false; // evaluate exactly while building
+        update_rates_T();
+        double* row = &m_rateTabLogK[n * nr];
+        for (size_t i = 0; i < nr; i++) {
+            row[i] = std::log(std::max(m_rfn[i], SmallNumber * SmallNumber));
+        }
+    }
+    thermo().restoreState(state);
+    m_rateTabTmin = Tmin;
+    m_rateTabTmax = Tmax;
+    m_rateTabPres = thermo().pressure();
+    m_rateTabOn = true;
+    // force re-evaluation at the restored state
+    m_temp = -1.0;
+}
+
 void GasKinetics::update_rates_T()
 {
     double T = thermo().temperature();
     double P = thermo().pressure();
     m_logStandConc = log(thermo().standardConcentration());
 
+    if (m_rateTabOn && T >= m_rateTabTmin && T <= m_rateTabTmax
+        && P == m_rateTabPres)
+    {
+        if (T != m_temp) {
+            // vectorized interpolation of the log(k) tables in 1/T
+            size_t nr = nReactions();
+            double x = 1.0 / T;
+            size_t cell = std::upper_bound(m_rateTabX.begin(),
+                                           m_rateTabX.end(), x)
+                          - m_rateTabX.begin();
+            cell = std::min(std::max<size_t>(cell, 1),
+                            m_rateTabX.size() - 1);
+            double frac = (x - m_rateTabX[cell-1])
+                          / (m_rateTabX[cell] - m_rateTabX[cell-1]);
+            const double* lo = &m_rateTabLogK[(cell - 1) * nr];
+            const double* hi = &m_rateTabLogK[cell * nr];
+            for (size_t i = 0; i < nr; i++) {
+                m_rfn[i] = std::exp(lo[i] + frac * (hi[i] - lo[i]));
+            }
+            m_kc_ok = false;
+            m_ROP_ok = false;
+        }
+        m_pres = P;
+        m_temp = T;
+        return;
+    }
+
     if (T != m_temp) {
-        updateKc();
+        // defer the update of the equilibrium constants to the first
+        // consumer of reverse-rate information
+        m_kc_ok = false;
         m_ROP_ok = false;
     }
 
@@ -62,6 +166,19 @@ void GasKinetics::update_rates_T()
 
 void GasKinetics::update_rates_C()
 {
+    // skip the concentration updates entirely when the thermodynamic state
+    // is unchanged since the last call, so repeated rate queries by
+    // several coupled modules at one state do no O(K) work
+    int stateNum = thermo().stateMFNumber();
+    double T = thermo().temperature();
+    double rho = thermo().density();
+    if (stateNum == m_stateNumC && T == m_tempC && rho == m_rhoC) {
+        return;
+    }
+    m_stateNumC = stateNum;
+    m_tempC = T;
+    m_rhoC = rho;
+
     thermo().getActivityConcentrations(m_act_conc.data());
     thermo().getConcentrations(m_phys_conc.data());
     doublereal ctot = thermo().molarDensity();
@@ -71,6 +188,14 @@ void GasKinetics::update_rates_C()
     m_ROP_ok = false;
 }
 
+void GasKinetics::checkKc()
+{
+    if (!m_kc_ok) {
+        updateKc();
+        m_kc_ok = true;
+    }
+}
+
 void GasKinetics::updateKc()
 {
     thermo().getStandardChemPotentials(m_grt.data());
@@ -100,9 +225,13 @@ void GasKinetics::processFwdRateCoefficients(double* ropf)
     // copy rate coefficients into ropf
     copy(m_rfn.begin(), m_rfn.end(), ropf);
 
-    // Scale the forward rate coefficient by the perturbation factor
-    for (size_t i = 0; i < nReactions(); ++i) {
-        ropf[i] *= m_perturb[i];
+    // Scale the forward rate coefficients by the perturbation factors;
+    // in normal operation every multiplier is one, and the pass is
+    // skipped entirely
+    if (m_nPerturbed) {
+        for (size_t i = 0; i < nReactions(); ++i) {
+            ropf[i] *= m_perturb[i];
+        }
     }
 }
 
@@ -116,6 +245,7 @@ void GasKinetics::processThirdBodies(double* rop)
 
 void GasKinetics::processEquilibriumConstants(double* rop)
 {
+    checkKc();
     // For reverse rates computed from thermochemistry, multiply the forward
     // rate coefficients by the reciprocals of the equilibrium constants
     for (size_t i = 0; i < nReactions(); ++i) {
@@ -127,6 +257,15 @@ void GasKinetics::getEquilibriumConstants(doublereal* kc)
 {
     update_rates_T(); // this step ensures that m_grt is updated
 
+    // reuse the constants computed at this state; diagnostics commonly
+    // request them repeatedly alongside rate evaluations
+    if (m_kcEq.size() == nReactions() && m_kcEqTemp == thermo().temperature()
+        && m_kcEqLogC == m_logStandConc)
+    {
+        copy(m_kcEq.begin(), m_kcEq.end(), kc);
+        return;
+    }
+
     vector_fp& delta_gibbs0 = m_rbuf0;
     fill(delta_gibbs0.begin(), delta_gibbs0.end(), 0.0);
 
@@ -134,23 +273,50 @@ void GasKinetics::getEquilibriumConstants(doublereal* kc)
     getReactionDelta(m_grt.data(), delta_gibbs0.data());
 
     double rrt = 1.0 / thermo().RT();
+    m_kcEq.resize(nReactions());
     for (size_t i = 0; i < nReactions(); i++) {
         kc[i] = exp(-delta_gibbs0[i] * rrt + m_dn[i] * m_logStandConc);
+        m_kcEq[i] = kc[i];
+    }
+    m_kcEqTemp = thermo().temperature();
+    m_kcEqLogC = m_logStandConc;
+}
+
+void GasKinetics::getEquilibriumConstants(size_t nTemps, const double* T,
+                                          double* kc)
+{
+    // multi-temperature sweep for table generation: one thermodynamic
+    // update per temperature serves all reactions. The thermodynamic
+    // state of the phase is modified.
+    for (size_t n = 0; n < nTemps; n++) {
+        thermo().setTemperature(T[n]);
+        getEquilibriumConstants(kc + n * nReactions());
     }
 }
 
 void GasKinetics::updateROP()
 {
+    CT_PROFILE_SCOPE("GasKinetics::updateROP");
     processFwdRateCoefficients(m_ropf.data());
     processThirdBodies(m_ropf.data());
-    copy(m_ropf.begin(), m_ropf.end(), m_ropr.begin());
+
+    // for reversible reactions, initialize ropr from the forward coefficients
+    // and the reciprocal equilibrium constants, and multiply by concentration
+    // products; entries of irreversible reactions remain zero
+    if (m_revindex.empty()) {
+        fill(m_ropr.begin(), m_ropr.end(), 0.0);
+    } else {
+        checkKc();
+        fill(m_ropr.begin(), m_ropr.end(), 0.0);
+        for (size_t i = 0; i < m_revindex.size(); i++) {
+            size_t irxn = m_revindex[i];
+            m_ropr[irxn] = m_ropf[irxn] * m_rkcn[irxn];
+        }
+        m_revProductStoich.multiply(m_act_conc.data(), m_ropr.data());
+    }
 
     // multiply ropf by concentration products
     m_reactantStoich.multiply(m_act_conc.data(), m_ropf.data());
-
-    // for reversible reactions, multiply ropr by concentration products
-    processEquilibriumConstants(m_ropr.data());
-    m_revProductStoich.multiply(m_act_conc.data(), m_ropr.data());
     for (size_t j = 0; j != nReactions(); ++j) {
         m_ropnet[j] = m_ropf[j] - m_ropr[j];
     }
@@ -166,6 +332,15 @@ void GasKinetics::updateROP()
     m_ROP_ok = true;
 }
 
+void GasKinetics::getRevRateConstants(double* krev, bool doIrreversible)
+{
+    // ensure temperature-dependent data (and deferred equilibrium
+    // constants) are up to date before the base implementation reads m_rkcn
+    update_rates_T();
+    checkKc();
+    BulkKinetics::getRevRateConstants(krev, doIrreversible);
+}
+
 void GasKinetics::getFwdRateConstants(double* kfwd)
 {
     processFwdRateCoefficients(m_ropf.data());
@@ -209,6 +384,7 @@ void GasKinetics::assertDerivativesValid(const std::string& name)
 
 void GasKinetics::processEquilibriumConstants_ddT(double* drkcn)
 {
+    checkKc(); // scaling below uses m_delta_gibbs0 evaluated by updateKc()
     double T = thermo().temperature();
     double P = thermo().pressure();
     double rrt = 1. / thermo().RT();
@@ -400,14 +576,15 @@ void GasKinetics::getNetRatesOfProgress_ddC(double* drop)
 }
 
 Eigen::SparseMatrix<double> GasKinetics::process_ddX(
-    StoichManagerN& stoich, const vector_fp& in)
+    StoichManagerN& stoich, const vector_fp& in, bool ddX)
 {
     Eigen::SparseMatrix<double> out;
     vector_fp& scaled = m_rbuf1;
     vector_fp& outV = m_rbuf2;
 
-    // convert from concentration to mole fraction output
-    double ctot = thermo().molarDensity();
+    // convert from concentration to mole fraction output; for derivatives
+    // with respect to species concentrations, no conversion is needed
+    double ctot = ddX ? thermo().molarDensity() : 1.;
     for (size_t i = 0; i < nReactions(); ++i) {
         scaled[i] = ctot * in[i];
     }
@@ -474,6 +651,41 @@ Eigen::SparseMatrix<double> GasKinetics::netRatesOfProgress_ddX()
     return jac - process_ddX(m_revProductStoich, rop_rates);
 }
 
+Eigen::SparseMatrix<double> GasKinetics::fwdRatesOfProgress_ddCi()
+{
+    assertDerivativesValid("GasKinetics::fwdRatesOfProgress_ddCi");
+
+    // forward reaction rate coefficients
+    vector_fp& rop_rates = m_rbuf0;
+    processFwdRateCoefficients(rop_rates.data());
+    return process_ddX(m_reactantStoich, rop_rates, false);
+}
+
+Eigen::SparseMatrix<double> GasKinetics::revRatesOfProgress_ddCi()
+{
+    assertDerivativesValid("GasKinetics::revRatesOfProgress_ddCi");
+
+    // reverse reaction rate coefficients
+    vector_fp& rop_rates = m_rbuf0;
+    processFwdRateCoefficients(rop_rates.data());
+    processEquilibriumConstants(rop_rates.data());
+    return process_ddX(m_revProductStoich, rop_rates, false);
+}
+
+Eigen::SparseMatrix<double> GasKinetics::netRatesOfProgress_ddCi()
+{
+    assertDerivativesValid("GasKinetics::netRatesOfProgress_ddCi");
+
+    // forward reaction rate coefficients
+    vector_fp& rop_rates = m_rbuf0;
+    processFwdRateCoefficients(rop_rates.data());
+    Eigen::SparseMatrix<double> jac = process_ddX(m_reactantStoich, rop_rates, false);
+
+    // reverse reaction rate coefficients
+    processEquilibriumConstants(rop_rates.data());
+    return jac - process_ddX(m_revProductStoich, rop_rates, false);
+}
+
 bool GasKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
 {
     // operations common to all reaction types
@@ -497,6 +709,9 @@ void GasKinetics::invalidateCache()
 {
     BulkKinetics::invalidateCache();
     m_pres += 0.13579;
+    m_kc_ok = false;
+    m_stateNumC = -1;
+    m_kcEqTemp = -1.0;
 }
 
 }
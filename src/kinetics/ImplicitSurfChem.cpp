@@ -12,6 +12,10 @@
 #include "cantera/kinetics/solveSP.h"
 #include "cantera/thermo/SurfPhase.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 using namespace std;
 
 namespace Cantera
@@ -309,4 +313,54 @@ void ImplicitSurfChem::setCommonState_TP(doublereal TKelvin, doublereal PresPa)
     }
 }
 
+
+void advanceSurfChemBatch(std::vector<shared_ptr<ImplicitSurfChem>>& solvers,
+                          double t0, double t1, size_t nThreads,
+                          bool warmStart)
+{
+    size_t n = solvers.size();
+    auto runOne = [t0, t1, warmStart](ImplicitSurfChem& solver) {
+        if (warmStart) {
+            solver.solvePseudoSteadyStateProblem();
+        }
+        solver.integrate(t0, t1);
+    };
+    size_t nt = std::min(nThreads, n);
+    if (nt < 2) {
+        for (auto& solver : solvers) {
+            runOne(*solver);
+        }
+        return;
+    }
+    std::atomic<size_t> next(0);
+    std::mutex errMutex;
+    std::string firstError;
+    std::vector<std::thread> workers;
+    workers.reserve(nt);
+    for (size_t w = 0; w < nt; w++) {
+        workers.emplace_back([&]() {
+            while (true) {
+                size_t i = next.fetch_add(1);
+                if (i >= n) {
+                    return;
+                }
+                try {
+                    runOne(*solvers[i]);
+                } catch (std::exception& err) {
+                    std::unique_lock<std::mutex> lock(errMutex);
+                    if (firstError.empty()) {
+                        firstError = err.what();
+                    }
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    if (!firstError.empty()) {
+        throw CanteraError("advanceSurfChemBatch", firstError);
+    }
+}
+
 }
@@ -104,6 +104,33 @@ void InterfaceKinetics::_update_rates_phi()
 
 void InterfaceKinetics::_update_rates_C()
 {
+    // Skip the per-phase concentration pulls (and the rate-of-progress
+    // invalidation) when no phase's composition state changed. Iterating
+    // on the electrode potential at frozen composition - the usual
+    // electrochemical operating-point sweep - then re-evaluates only the
+    // potential-dependent rate terms via _update_rates_phi()/
+    // _update_rates_T().
+    bool changed = (m_lastStateNumC.size() != nPhases());
+    m_lastStateNumC.resize(nPhases());
+    m_lastTempC.resize(nPhases());
+    m_lastDensC.resize(nPhases());
+    for (size_t n = 0; n < nPhases(); n++) {
+        int stateNum = m_thermo[n]->stateMFNumber();
+        double T = m_thermo[n]->temperature();
+        double rho = m_thermo[n]->density();
+        if (!changed && (stateNum != m_lastStateNumC[n]
+                         || T != m_lastTempC[n] || rho != m_lastDensC[n]))
+        {
+            changed = true;
+        }
+        m_lastStateNumC[n] = stateNum;
+        m_lastTempC[n] = T;
+        m_lastDensC[n] = rho;
+    }
+    if (!changed) {
+        return;
+    }
+
     for (size_t n = 0; n < nPhases(); n++) {
         const ThermoPhase* tp = m_thermo[n];
         /*
@@ -508,6 +535,8 @@ void InterfaceKinetics::init()
 
 void InterfaceKinetics::resizeSpecies()
 {
+    m_lastStateNumC.clear(); // force a full concentration refresh
+
     size_t kOld = m_kk;
     Kinetics::resizeSpecies();
     if (m_kk != kOld && nReactions()) {
@@ -206,7 +206,7 @@ void InterfaceRateBase::setSpecies(const std::vector<std::string>& species)
     for (size_t k = 0; k < m_cov.size(); k++) {
         auto it = find(species.begin(), species.end(), m_cov[k]);
         if (it != species.end()) {
-            m_indices.emplace(k, it - species.begin());
+            m_indices.emplace_back(k, it - species.begin());
         } else {
             throw CanteraError("InterfaceRateBase:setSpeciesIndices",
                 "Species list does not contain '{}'.", m_cov[k]);
@@ -229,9 +229,10 @@ void InterfaceRateBase::updateFromStruct(const InterfaceData& shared_data) {
     m_acov = 0.0;
     m_ecov = 0.0;
     m_mcov = 0.0;
-    for (auto& item : m_indices) {
-        m_acov += m_ac[item.first] * shared_data.coverages[item.second];
-        m_ecov += m_ec[item.first] * shared_data.coverages[item.second];
+    for (const auto& item : m_indices) {
+        double cov = shared_data.coverages[item.second];
+        m_acov += m_ac[item.first] * cov;
+        m_ecov += m_ec[item.first] * cov;
         m_mcov += m_mc[item.first] * shared_data.logCoverages[item.second];
     }
 
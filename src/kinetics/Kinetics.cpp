@@ -45,6 +45,68 @@ void Kinetics::checkReactionIndex(size_t i) const
     }
 }
 
+shared_ptr<Kinetics> Kinetics::clone(
+    const std::vector<shared_ptr<ThermoPhase>>& phases) const
+{
+    if (phases.size() != nPhases()) {
+        throw CanteraError("Kinetics::clone",
+            "Number of phases ({}) does not match this Kinetics object ({}).",
+            phases.size(), nPhases());
+    }
+    shared_ptr<Kinetics> kin(KineticsFactory::factory()->newKinetics(kineticsType()));
+    for (size_t n = 0; n < phases.size(); n++) {
+        if (phases[n]->name() != m_thermo[n]->name()) {
+            throw CanteraError("Kinetics::clone",
+                "Phase '{}' does not match phase '{}' of this Kinetics object.",
+                phases[n]->name(), m_thermo[n]->name());
+        }
+        kin->addPhase(*phases[n]);
+    }
+    kin->init();
+    kin->resizeSpecies();
+    for (const auto& R : m_reactions) {
+        // Reaction objects are immutable in practice and shared with the clone
+        kin->addReaction(R, false);
+    }
+    kin->resizeReactions();
+    return kin;
+}
+
+size_t Kinetics::compactReactionData()
+{
+    // flyweight the third-body descriptions: reactions of one mechanism
+    // very often share identical efficiency maps
+    std::vector<shared_ptr<ThirdBody>> unique;
+    size_t released = 0;
+    for (auto& rxn : m_reactions) {
+        auto tbody = rxn->thirdBody();
+        if (!tbody) {
+            continue;
+        }
+        bool found = false;
+        for (const auto& candidate : unique) {
+            if (candidate == tbody) {
+                found = true;
+                break;
+            }
+            if (candidate->name() == tbody->name()
+                && candidate->default_efficiency == tbody->default_efficiency
+                && candidate->mass_action == tbody->mass_action
+                && candidate->efficiencies == tbody->efficiencies)
+            {
+                rxn->setThirdBody(candidate);
+                released++;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            unique.push_back(tbody);
+        }
+    }
+    return released;
+}
+
 void Kinetics::resizeReactions()
 {
     size_t nRxn = nReactions();
@@ -120,12 +182,15 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
         std::map<int, double>& net = net_stoich.back();
         for (const auto& sp : R.reactants) {
             int k = static_cast<int>(kineticsSpeciesIndex(sp.first));
-            key += k*(k+1);
+            // commutative mixed hash of the participant multiset; a better
+            // spread than the quadratic form keeps the buckets small on
+            // large mechanisms
+            key += (k + 1) * 2654435761UL;
             net[-1 -k] -= sp.second;
         }
         for (const auto& sp : R.products) {
             int k = static_cast<int>(kineticsSpeciesIndex(sp.first));
-            key += k*(k+1);
+            key += (k + 1) * 2654435761UL;
             net[1+k] += sp.second;
         }
 
@@ -151,16 +216,46 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
             } else if (c < 0.0 && !R.reversible && !other.reversible) {
                 continue; // irreversible reactions in opposite directions
             } else if (R.usesThirdBody() && other.usesThirdBody()) {
+                // Overlap exists when some species has a nonzero efficiency
+                // in both reactions. Only the explicitly listed species and
+                // the default-default case need checking, instead of a scan
+                // over every species of the mechanism.
                 ThirdBody& tb1 = *(R.thirdBody());
                 ThirdBody& tb2 = *(other.thirdBody());
                 bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
+                if (tb1.default_efficiency != 0.0
+                    && tb2.default_efficiency != 0.0)
+                {
+                    // a species listed in neither map uses both (nonzero)
+                    // defaults; count the union of the explicit lists
+                    size_t common = 0;
+                    for (const auto& eff : tb1.efficiencies) {
+                        common += tb2.efficiencies.count(eff.first);
+                    }
+                    if (tb1.efficiencies.size() + tb2.efficiencies.size()
+                        - common < nTotalSpecies())
+                    {
                         thirdBodyOk = false;
-                        break;
+                    }
+                }
+                if (thirdBodyOk) {
+                    for (const auto& eff : tb1.efficiencies) {
+                        if (eff.second != 0.0
+                            && tb2.efficiency(eff.first) != 0.0)
+                        {
+                            thirdBodyOk = false;
+                            break;
+                        }
+                    }
+                }
+                if (thirdBodyOk) {
+                    for (const auto& eff : tb2.efficiencies) {
+                        if (eff.second != 0.0
+                            && tb1.efficiency(eff.first) != 0.0)
+                        {
+                            thirdBodyOk = false;
+                            break;
+                        }
                     }
                 }
                 if (thirdBodyOk) {
@@ -422,6 +517,13 @@ void Kinetics::getDestructionRates(doublereal* ddot)
     m_reactantStoich.incrementSpecies(m_ropf.data(), ddot);
 }
 
+const vector_fp& Kinetics::netProductionRates()
+{
+    m_wdotNet.resize(m_kk);
+    getNetProductionRates(m_wdotNet.data());
+    return m_wdotNet;
+}
+
 void Kinetics::getNetProductionRates(doublereal* net)
 {
     updateROP();
@@ -554,6 +656,11 @@ Eigen::SparseMatrix<double> Kinetics::netProductionRates_ddX()
     return m_stoichMatrix * netRatesOfProgress_ddX();
 }
 
+Eigen::SparseMatrix<double> Kinetics::netProductionRates_ddCi()
+{
+    return m_stoichMatrix * netRatesOfProgress_ddCi();
+}
+
 void Kinetics::addPhase(ThermoPhase& thermo)
 {
     // the phase with lowest dimensionality is assumed to be the
@@ -677,7 +784,7 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r, bool resize)
     m_perturb.push_back(1.0);
     m_dH.push_back(0.0);
 
-    if (resize) {
+    if (resize && !m_deferResize) {
         resizeReactions();
     } else {
         m_ready = false;
@@ -78,6 +78,27 @@ unique_ptr<Kinetics> newKinetics(const std::vector<ThermoPhase*>& phases,
     return newKinetics(phases, phaseNode, root);
 }
 
+namespace {
+
+//! Construct and install the reactions of one section
+void buildSectionReactions(Kinetics& kin, const std::vector<AnyMap>& nodes,
+                           fmt::memory_buffer& add_rxn_err)
+{
+    for (const auto& R : nodes) {
+        #ifdef NDEBUG
+            try {
+                kin.addReaction(newReaction(R, kin), false);
+            } catch (CanteraError& err) {
+                fmt_append(add_rxn_err, "{}", err.what());
+            }
+        #else
+            kin.addReaction(newReaction(R, kin), false);
+        #endif
+    }
+}
+
+} // anonymous namespace
+
 void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode)
 {
     kin.skipUndeclaredThirdBodies(
@@ -155,30 +176,12 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
             AnyMap reactions = AnyMap::fromYamlFile(fileName,
                 rootNode.getString("__file__", ""));
             loadExtensions(reactions);
-            for (const auto& R : reactions[node].asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
-            }
+            buildSectionReactions(kin, reactions[node].asVector<AnyMap>(),
+                                  add_rxn_err);
         } else {
             // specified section is in the current file
-            for (const auto& R : rootNode.at(sections[i]).asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
-            }
+            buildSectionReactions(kin, rootNode.at(sections[i]).asVector<AnyMap>(),
+                                  add_rxn_err);
         }
     }
 
@@ -0,0 +1,175 @@
+//! @file MechanismReduction.cpp Skeletal mechanism reduction by DRG
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/MechanismReduction.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+
+#include <deque>
+#include <set>
+
+namespace Cantera
+{
+
+std::vector<bool> drgActiveSpecies(Kinetics& kin,
+                                   const std::vector<std::string>& targets,
+                                   double threshold)
+{
+    size_t kk = kin.nTotalSpecies();
+    size_t nr = kin.nReactions();
+    vector_fp rop(nr);
+    kin.getNetRatesOfProgress(rop.data());
+
+    // per-reaction participant lists with net stoichiometric coefficients
+    std::vector<std::vector<std::pair<size_t, double>>> participants(nr);
+    for (size_t i = 0; i < nr; i++) {
+        auto rxn = kin.reaction(i);
+        std::map<size_t, double> nu;
+        for (const auto& item : rxn->reactants) {
+            nu[kin.kineticsSpeciesIndex(item.first)] -= item.second;
+        }
+        for (const auto& item : rxn->products) {
+            nu[kin.kineticsSpeciesIndex(item.first)] += item.second;
+        }
+        for (const auto& item : nu) {
+            participants[i].emplace_back(item.first, item.second);
+        }
+    }
+
+    // numerator contributions of each (A, B) pair and the denominators
+    std::vector<std::map<size_t, double>> num(kk);
+    vector_fp den(kk, 0.0);
+    for (size_t i = 0; i < nr; i++) {
+        double R = std::abs(rop[i]);
+        if (R == 0.0) {
+            continue;
+        }
+        for (const auto& a : participants[i]) {
+            double contrib = std::abs(a.second) * R;
+            den[a.first] += contrib;
+            for (const auto& b : participants[i]) {
+                if (b.first != a.first) {
+                    num[a.first][b.first] += contrib;
+                }
+            }
+        }
+    }
+
+    // breadth-first traversal from the targets along strong edges
+    std::vector<bool> active(kk, false);
+    std::deque<size_t> queue;
+    for (const auto& name : targets) {
+        size_t k = kin.kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("drgActiveSpecies",
+                "Unknown target species '{}'.", name);
+        }
+        active[k] = true;
+        queue.push_back(k);
+    }
+    while (!queue.empty()) {
+        size_t a = queue.front();
+        queue.pop_front();
+        if (den[a] == 0.0) {
+            continue;
+        }
+        for (const auto& edge : num[a]) {
+            if (!active[edge.first] && edge.second / den[a] >= threshold) {
+                active[edge.first] = true;
+                queue.push_back(edge.first);
+            }
+        }
+    }
+    return active;
+}
+
+std::vector<size_t> cacheOptimizedSpeciesOrder(Kinetics& kin)
+{
+    size_t kk = kin.nTotalSpecies();
+
+    // species adjacency from shared reactions
+    std::vector<std::set<size_t>> adj(kk);
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        auto rxn = kin.reaction(i);
+        std::vector<size_t> members;
+        for (const auto& item : rxn->reactants) {
+            members.push_back(kin.kineticsSpeciesIndex(item.first));
+        }
+        for (const auto& item : rxn->products) {
+            members.push_back(kin.kineticsSpeciesIndex(item.first));
+        }
+        for (size_t a : members) {
+            for (size_t b : members) {
+                if (a != b) {
+                    adj[a].insert(b);
+                }
+            }
+        }
+    }
+
+    // Cuthill-McKee: breadth-first from minimum-degree seeds, neighbors
+    // visited in order of increasing degree; the result is reversed
+    std::vector<size_t> order;
+    order.reserve(kk);
+    std::vector<bool> visited(kk, false);
+    while (order.size() < kk) {
+        size_t seed = npos;
+        for (size_t k = 0; k < kk; k++) {
+            if (!visited[k]
+                && (seed == npos || adj[k].size() < adj[seed].size()))
+            {
+                seed = k;
+            }
+        }
+        std::deque<size_t> queue{seed};
+        visited[seed] = true;
+        while (!queue.empty()) {
+            size_t a = queue.front();
+            queue.pop_front();
+            order.push_back(a);
+            std::vector<size_t> next(adj[a].begin(), adj[a].end());
+            std::sort(next.begin(), next.end(),
+                      [&adj](size_t x, size_t y) {
+                          return adj[x].size() < adj[y].size();
+                      });
+            for (size_t b : next) {
+                if (!visited[b]) {
+                    visited[b] = true;
+                    queue.push_back(b);
+                }
+            }
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+size_t applySkeletalReduction(Kinetics& kin,
+                              const std::vector<bool>& activeSpecies)
+{
+    if (activeSpecies.size() != kin.nTotalSpecies()) {
+        throw CanteraError("applySkeletalReduction",
+            "Active species flags ({}) do not match the number of species "
+            "({}).", activeSpecies.size(), kin.nTotalSpecies());
+    }
+    size_t nActive = 0;
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        auto rxn = kin.reaction(i);
+        bool keep = true;
+        for (const auto& item : rxn->reactants) {
+            keep = keep && activeSpecies[kin.kineticsSpeciesIndex(item.first)];
+        }
+        for (const auto& item : rxn->products) {
+            keep = keep && activeSpecies[kin.kineticsSpeciesIndex(item.first)];
+        }
+        kin.setMultiplier(i, keep ? 1.0 : 0.0);
+        if (keep) {
+            nActive++;
+        }
+    }
+    return nActive;
+}
+
+}
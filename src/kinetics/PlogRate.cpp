@@ -126,6 +126,17 @@ void PlogRate::setRates(const std::multimap<double, ArrheniusRate>& rates)
     // Duplicate the first and last groups to handle P < P_0 and P > P_N
     pressures_.insert({-1000.0, pressures_.begin()->second});
     pressures_.insert({1000.0, pressures_.rbegin()->second});
+
+    // Mirror the interpolation intervals in contiguous arrays for the
+    // hot interval search in updateFromStruct()
+    logPressures_.clear();
+    rateRanges_.clear();
+    logPressures_.reserve(pressures_.size());
+    rateRanges_.reserve(pressures_.size());
+    for (const auto& pres : pressures_) {
+        logPressures_.push_back(pres.first);
+        rateRanges_.push_back(pres.second);
+    }
 }
 
 void PlogRate::validate(const std::string& equation, const Kinetics& kin)
@@ -7,6 +7,8 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/kinetics/ReactionPath.h"
+
+#include <sstream>
 #include "cantera/thermo/ThermoPhase.h"
 
 #include <boost/algorithm/string.hpp>
@@ -701,6 +703,9 @@ int ReactionPathBuilder::build(Kinetics& s, const string& element,
     if (m == npos) {
         return -1;
     }
+    // the edge topology recorded below is reused by update()
+    std::vector<FluxEdge>& edges = m_edgeCache[element];
+    edges.clear();
 
     s.getFwdRatesOfProgress(m_ropf.data());
     s.getRevRatesOfProgress(m_ropr.data());
@@ -786,6 +791,10 @@ int ReactionPathBuilder::build(Kinetics& s, const string& element,
                             f = m_atoms(kkp,m) * m_atoms(kkr,m) / m_elatoms(m, i);
                         }
 
+                        if (f != 0.0) {
+                            edges.push_back(FluxEdge{i, kkr, kkp, f,
+                                                     fwdlabel, revlabel});
+                        }
                         double fwd = ropf*f;
                         double rev = ropr*f;
                         bool force_incl = ((status[kkr] == 1) || (status[kkp] == 1));
@@ -816,4 +825,41 @@ int ReactionPathBuilder::build(Kinetics& s, const string& element,
     return 1;
 }
 
+int ReactionPathBuilder::update(Kinetics& s, const string& element,
+                                ReactionPathDiagram& r)
+{
+    auto iter = m_edgeCache.find(element);
+    if (iter == m_edgeCache.end()) {
+        // no cached topology yet; run a full build
+        std::ostringstream log;
+        return build(s, element, log, r, true);
+    }
+    r.element = element;
+    s.getFwdRatesOfProgress(m_ropf.data());
+    s.getRevRatesOfProgress(m_ropr.data());
+
+    // one pass over the cached edges; only the fluxes are recomputed
+    for (const FluxEdge& edge : iter->second) {
+        double fwd = m_ropf[edge.rxn] * edge.f;
+        double rev = m_ropr[edge.rxn] * edge.f;
+        if (fwd > 0.0 || rev > 0.0) {
+            if (!r.hasNode(edge.kkr)) {
+                r.addNode(edge.kkr, s.kineticsSpeciesName(edge.kkr),
+                          m_x[edge.kkr]);
+            }
+            if (!r.hasNode(edge.kkp)) {
+                r.addNode(edge.kkp, s.kineticsSpeciesName(edge.kkp),
+                          m_x[edge.kkp]);
+            }
+        }
+        if (fwd > 0.0) {
+            r.linkNodes(edge.kkr, edge.kkp, int(edge.rxn), fwd, edge.fwdlabel);
+        }
+        if (rev > 0.0) {
+            r.linkNodes(edge.kkp, edge.kkr, -int(edge.rxn), rev, edge.revlabel);
+        }
+    }
+    return 1;
+}
+
 }
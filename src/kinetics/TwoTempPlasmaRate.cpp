@@ -4,12 +4,22 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/kinetics/TwoTempPlasmaRate.h"
+#include "cantera/base/global.h"
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/thermo/ThermoPhase.h"
 
 namespace Cantera
 {
 
+unique_ptr<MultiRateBase> TwoTempPlasmaRate::newMultiRate() const
+{
+    if (batched_rate_evaluators_used()) {
+        return unique_ptr<MultiRateBase>(new TwoTempPlasmaMultiRate);
+    }
+    return unique_ptr<MultiRateBase>(
+        new MultiRate<TwoTempPlasmaRate, TwoTempPlasmaData>);
+}
+
 bool TwoTempPlasmaData::update(const ThermoPhase& phase, const Kinetics& kin)
 {
     double T = phase.temperature();
@@ -127,6 +127,7 @@ int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
     doublereal damp=1.0;
     doublereal inv_t = 0.0;
     doublereal t_real = 0.0, update_norm = 1.0E6;
+    doublereal lastUpdateNorm = 1.0E6;
     bool do_time = false, not_converged = true;
     m_ioflag = std::min(m_ioflag, 1);
 
@@ -173,42 +174,60 @@ int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
             evalSurfLarge(m_CSolnSP.data());
         }
 
-        // Calculate the value of the time step
-        // - heuristics to stop large oscillations in deltaT
-        if (do_time) {
-            // don't hurry increase in time step at the same time as damping
-            if (damp < 1.0) {
-                label_factor = 1.0;
-            }
-            double tmp = calc_t(m_netProductionRatesSave.data(),
-                         m_XMolKinSpecies.data(),
-                         &label_t, &label_t_old, &label_factor, m_ioflag);
-            if (iter < 10) {
-                inv_t = tmp;
-            } else if (tmp > 2.0*inv_t) {
-                inv_t = 2.0*inv_t;
-            } else {
-                inv_t = tmp;
-            }
+        // Decide whether the factored Jacobian of a previous iteration can
+        // be reused: only while full steps are taken and the update norm is
+        // contracting, and never beyond the configured age. The time step
+        // is frozen while the Jacobian is reused, since the transient term
+        // enters the matrix.
+        bool rebuildJac = (iter == 1) || m_jacAge >= m_maxJacAge
+                          || damp < 1.0 || update_norm > 0.5 * lastUpdateNorm;
+        lastUpdateNorm = update_norm;
+        if (!rebuildJac) {
+            fun_eval(m_resid.data(), m_CSolnSP.data(), m_CSolnSPOld.data(),
+                     do_time, deltaT);
+            m_jacAge++;
+        } else {
+            // Calculate the value of the time step
+            // - heuristics to stop large oscillations in deltaT
+            if (do_time) {
+                // don't hurry increase in time step at the same time as damping
+                if (damp < 1.0) {
+                    label_factor = 1.0;
+                }
+                double tmp = calc_t(m_netProductionRatesSave.data(),
+                                    m_XMolKinSpecies.data(),
+                                    &label_t, &label_t_old, &label_factor,
+                                    m_ioflag);
+                if (iter < 10) {
+                    inv_t = tmp;
+                } else if (tmp > 2.0*inv_t) {
+                    inv_t = 2.0*inv_t;
+                } else {
+                    inv_t = tmp;
+                }
 
-            // Check end condition
-            if (ifunc == SFLUX_TRANSIENT) {
-                tmp = t_real + 1.0/inv_t;
-                if (tmp > time_scale) {
-                    inv_t = 1.0/(time_scale - t_real);
+                // Check end condition
+                if (ifunc == SFLUX_TRANSIENT) {
+                    tmp = t_real + 1.0/inv_t;
+                    if (tmp > time_scale) {
+                        inv_t = 1.0/(time_scale - t_real);
+                    }
                 }
+            } else {
+                // make steady state calc a step of 1 million seconds to prevent
+                // singular Jacobians for some pathological cases
+                inv_t = 1.0e-6;
             }
-        } else {
-            // make steady state calc a step of 1 million seconds to prevent
-            // singular Jacobians for some pathological cases
-            inv_t = 1.0e-6;
-        }
-        deltaT = 1.0/inv_t;
+            deltaT = 1.0/inv_t;
 
-        // Call the routine to numerically evaluation the Jacobian and residual
-        // for the current iteration.
-        resjac_eval(m_Jac, m_resid.data(), m_CSolnSP.data(),
-                    m_CSolnSPOld.data(), do_time, deltaT);
+            // Call the routine to numerically evaluation the Jacobian and residual
+            // for the current iteration.
+            resjac_eval(m_Jac, m_resid.data(), m_CSolnSP.data(),
+                        m_CSolnSPOld.data(), do_time, deltaT);
+            m_JacLU.compute(Eigen::Map<Eigen::MatrixXd>(
+                m_Jac.ptrColumn(0), m_neq, m_neq));
+            m_jacAge = 0;
+        }
 
         // Calculate the weights. Make sure the calculation is carried out on
         // the first iteration.
@@ -220,8 +239,12 @@ int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
         // Find the weighted norm of the residual
         double resid_norm = calcWeightedNorm(m_wtResid.data(), m_resid.data(), m_neq);
 
-        // Solve Linear system.  The solution is in m_resid
-        solve(m_Jac, m_resid.data());
+        // Solve Linear system using the retained factorization. The
+        // solution is in m_resid
+        {
+            Eigen::Map<Eigen::VectorXd> r(m_resid.data(), m_neq);
+            r = m_JacLU.solve(r);
+        }
 
         // Calculate the Damping factor needed to keep all unknowns between 0
         // and 1, and not allow too large a change (factor of 2) in any unknown.
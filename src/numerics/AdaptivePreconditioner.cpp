@@ -6,6 +6,9 @@
 #include "cantera/base/global.h"
 #include "cantera/numerics/AdaptivePreconditioner.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace Cantera
 {
 
@@ -49,6 +52,8 @@ void AdaptivePreconditioner::initialize(size_t networkSize)
     if (m_drop_tol == 0) {
         setIlutFillFactor(static_cast<int>(m_dim) / 4);
     }
+    m_nsetups = 0;
+    m_nsolves = 0;
     // update initialized status
     m_init = true;
 }
@@ -60,6 +65,11 @@ void AdaptivePreconditioner::setup()
     updatePreconditioner();
     // compressing sparse matrix structure
     m_precon_matrix.makeCompressed();
+    m_nsetups++;
+    if (m_factorization == "ILU0") {
+        factorizeILU0();
+        return;
+    }
     // analyze and factorize
     m_solver.compute(m_precon_matrix);
     // check for errors
@@ -69,6 +79,87 @@ void AdaptivePreconditioner::setup()
     }
 }
 
+void AdaptivePreconditioner::factorizeILU0()
+{
+    // zero fill-in incomplete LU on the fixed sparsity pattern; the values
+    // are factored in place in a row-major copy, and the symbolic data
+    // (diagonal positions) are reused while the pattern is unchanged
+    m_ilu0_matrix = m_precon_matrix;
+    int n = m_ilu0_matrix.rows();
+    const int* outer = m_ilu0_matrix.outerIndexPtr();
+    const int* inner = m_ilu0_matrix.innerIndexPtr();
+    double* vals = m_ilu0_matrix.valuePtr();
+    int nnz = static_cast<int>(m_ilu0_matrix.nonZeros());
+
+    std::vector<int> pattern(outer, outer + n + 1);
+    pattern.insert(pattern.end(), inner, inner + nnz);
+    if (!m_ilu0_pattern || pattern != *m_ilu0_pattern) {
+        // look for (or publish to) the shared symbolic registry first
+        static std::mutex patternMutex;
+        static std::unordered_map<std::string,
+            std::pair<shared_ptr<const std::vector<int>>,
+                      shared_ptr<const std::vector<int>>>> registry;
+        if (!m_patternKey.empty()) {
+            std::unique_lock<std::mutex> lock(patternMutex);
+            auto iter = registry.find(m_patternKey);
+            if (iter != registry.end() && *iter->second.first == pattern) {
+                m_ilu0_pattern = iter->second.first;
+                m_ilu0_diag = iter->second.second;
+            }
+        }
+        if (!m_ilu0_pattern || pattern != *m_ilu0_pattern) {
+            // locate the diagonal position of each row once per pattern
+            auto diag = std::make_shared<std::vector<int>>(n, -1);
+            for (int i = 0; i < n; i++) {
+                for (int p = outer[i]; p < outer[i+1]; p++) {
+                    if (inner[p] == i) {
+                        (*diag)[i] = p;
+                        break;
+                    }
+                }
+                if ((*diag)[i] < 0) {
+                    throw CanteraError("AdaptivePreconditioner::factorizeILU0",
+                        "Structurally zero diagonal in row {}", i);
+                }
+            }
+            m_ilu0_pattern =
+                std::make_shared<const std::vector<int>>(std::move(pattern));
+            m_ilu0_diag = diag;
+            if (!m_patternKey.empty()) {
+                std::unique_lock<std::mutex> lock(patternMutex);
+                registry[m_patternKey] = {m_ilu0_pattern, m_ilu0_diag};
+            }
+        }
+    }
+
+    // IKJ-ordered ILU(0)
+    std::vector<int> pos(n, -1);
+    for (int i = 0; i < n; i++) {
+        for (int p = outer[i]; p < outer[i+1]; p++) {
+            pos[inner[p]] = p;
+        }
+        for (int p = outer[i]; p < outer[i+1] && inner[p] < i; p++) {
+            int k = inner[p];
+            double pivot = vals[(*m_ilu0_diag)[k]];
+            if (pivot == 0.0) {
+                throw CanteraError("AdaptivePreconditioner::factorizeILU0",
+                    "Zero pivot in row {}", k);
+            }
+            double lik = vals[p] / pivot;
+            vals[p] = lik;
+            for (int q = (*m_ilu0_diag)[k] + 1; q < outer[k+1]; q++) {
+                int j = inner[q];
+                if (pos[j] >= 0) {
+                    vals[pos[j]] -= lik * vals[q];
+                }
+            }
+        }
+        for (int p = outer[i]; p < outer[i+1]; p++) {
+            pos[inner[p]] = -1;
+        }
+    }
+}
+
 void AdaptivePreconditioner::updatePreconditioner()
 {
     // set precon to jacobian
@@ -99,6 +190,31 @@ void AdaptivePreconditioner::solve(const size_t stateSize, double* rhs_vector, d
     // creating vectors in the form of Ax=b
     Eigen::Map<Eigen::VectorXd> bVector(rhs_vector, stateSize);
     Eigen::Map<Eigen::VectorXd> xVector(output, stateSize);
+    m_nsolves++;
+    if (m_factorization == "ILU0") {
+        // forward substitution with the unit lower factor, then backward
+        // substitution with the upper factor, both stored in m_ilu0_matrix
+        int n = m_ilu0_matrix.rows();
+        const int* outer = m_ilu0_matrix.outerIndexPtr();
+        const int* inner = m_ilu0_matrix.innerIndexPtr();
+        const double* vals = m_ilu0_matrix.valuePtr();
+        for (int i = 0; i < n; i++) {
+            double sum = bVector(i);
+            int p = outer[i];
+            for (; p < outer[i+1] && inner[p] < i; p++) {
+                sum -= vals[p] * xVector(inner[p]);
+            }
+            xVector(i) = sum;
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            double sum = xVector(i);
+            for (int p = (*m_ilu0_diag)[i] + 1; p < outer[i+1]; p++) {
+                sum -= vals[p] * xVector(inner[p]);
+            }
+            xVector(i) = sum / vals[(*m_ilu0_diag)[i]];
+        }
+        return;
+    }
     // solve for xVector
     xVector = m_solver.solve(bVector);
     if (m_solver.info() != Eigen::Success) {
@@ -120,8 +120,16 @@ void BandMatrix::resize(size_t n, size_t kl, size_t ku, doublereal v)
     m_n = n;
     m_kl = kl;
     m_ku = ku;
-    data.resize(n*(2*kl + ku + 1));
-    ludata.resize(n*(2*kl + ku + 1));
+    size_t needed = n*(2*kl + ku + 1);
+    if (needed > data.capacity()) {
+        // grow geometrically, so the repeated slightly-larger resizes of
+        // grid refinement stop reallocating every time
+        size_t newCap = std::max(needed, 2 * data.capacity());
+        data.reserve(newCap);
+        ludata.reserve(newCap);
+    }
+    data.resize(needed);
+    ludata.resize(needed);
     m_ipiv->data.resize(m_n);
     fill(data.begin(), data.end(), v);
     m_colPtrs.resize(m_n);
@@ -236,7 +244,19 @@ void BandMatrix::leftMult(const doublereal* const b, doublereal* const prod) con
 
 int BandMatrix::factor()
 {
-    ludata = data;
+    if (m_retain_unfactored) {
+        ludata = data;
+    } else {
+        // the caller does not need the unfactored matrix again; factor the
+        // assembled data directly, skipping the O(n*bandwidth) copy. After
+        // the swap, the matrix contents read through value() are stale.
+        data.swap(ludata);
+        size_t ldab = (2 * m_kl + m_ku + 1);
+        for (size_t j = 0; j < m_n; j++) {
+            m_colPtrs[j] = &data[ldab * j];
+            m_lu_col_ptrs[j] = &ludata[ldab * j];
+        }
+    }
 #if CT_USE_LAPACK
     ct_dgbtrf(nRows(), nColumns(), nSubDiagonals(), nSuperDiagonals(),
               ludata.data(), ldim(), m_ipiv->data.data(), m_info);
@@ -0,0 +1,132 @@
+//! @file BlockTridiagSolver.cpp Block cyclic reduction solver
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/BlockTridiagSolver.h"
+
+#include <thread>
+
+namespace Cantera
+{
+
+namespace {
+
+//! Run f(i) for every odd index i < n, distributing the iterations across
+//! nThreads workers when profitable
+template <class Func>
+void forEachOdd(size_t n, size_t nThreads, Func f)
+{
+    size_t nOdd = n / 2;
+    if (nThreads < 2 || nOdd < 2 * nThreads) {
+        for (size_t i = 1; i < n; i += 2) {
+            f(i);
+        }
+        return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(nThreads);
+    size_t chunk = (nOdd + nThreads - 1) / nThreads;
+    for (size_t w = 0; w < nThreads; w++) {
+        size_t lo = 1 + 2 * w * chunk;
+        if (lo >= n) {
+            break;
+        }
+        size_t hi = std::min(n, lo + 2 * chunk);
+        workers.emplace_back([lo, hi, &f]() {
+            for (size_t i = lo; i < hi; i += 2) {
+                f(i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+} // anonymous namespace
+
+int BlockTridiagSolver::solve(
+    std::vector<Eigen::MatrixXd>& A, std::vector<Eigen::MatrixXd>& B,
+    std::vector<Eigen::MatrixXd>& C, std::vector<Eigen::VectorXd>& b,
+    std::vector<Eigen::VectorXd>& x)
+{
+    size_t n = B.size();
+    x.resize(n);
+    if (n == 0) {
+        return 0;
+    }
+    if (n == 1) {
+        x[0] = B[0].partialPivLu().solve(b[0]);
+        return x[0].allFinite() ? 0 : 1;
+    }
+
+    // eliminate the odd-indexed blocks; each elimination is independent
+    std::vector<Eigen::MatrixXd> Ar(n), Cr(n);
+    std::vector<Eigen::VectorXd> br(n);
+    std::vector<char> ok(n, 1);
+    forEachOdd(n, m_threads, [&](size_t i) {
+        Eigen::PartialPivLU<Eigen::MatrixXd> lu(B[i]);
+        Ar[i] = lu.solve(A[i]);
+        Cr[i] = lu.solve(C[i]);
+        br[i] = lu.solve(b[i]);
+        if (!br[i].allFinite() || !Ar[i].allFinite() || !Cr[i].allFinite()) {
+            ok[i] = 0;
+        }
+    });
+    for (size_t i = 1; i < n; i += 2) {
+        if (!ok[i]) {
+            return static_cast<int>(i) + 1;
+        }
+    }
+
+    // assemble the reduced system over the even-indexed blocks
+    size_t ne = (n + 1) / 2;
+    std::vector<Eigen::MatrixXd> Ae(ne), Be(ne), Ce(ne);
+    std::vector<Eigen::VectorXd> be(ne);
+    for (size_t J = 0; J < ne; J++) {
+        size_t j = 2 * J;
+        Be[J] = B[j];
+        be[J] = b[j];
+        if (j > 0) {
+            Be[J] -= A[j] * Cr[j-1];
+            be[J] -= A[j] * br[j-1];
+            Ae[J] = -(A[j] * Ar[j-1]);
+        } else {
+            Ae[J].resize(B[j].rows(), 0);
+        }
+        if (j + 1 < n) {
+            Be[J] -= C[j] * Ar[j+1];
+            be[J] -= C[j] * br[j+1];
+            if (j + 2 < n) {
+                Ce[J] = -(C[j] * Cr[j+1]);
+            } else {
+                Ce[J].resize(B[j].rows(), 0);
+            }
+        } else {
+            Ce[J].resize(B[j].rows(), 0);
+        }
+    }
+
+    std::vector<Eigen::VectorXd> xe;
+    int info = solve(Ae, Be, Ce, be, xe);
+    if (info != 0) {
+        // translate the reduced block index back to the original numbering
+        return 2 * (info - 1) + 1;
+    }
+    for (size_t J = 0; J < ne; J++) {
+        x[2 * J] = xe[J];
+    }
+
+    // back-substitute the odd-indexed blocks
+    forEachOdd(n, m_threads, [&](size_t i) {
+        x[i] = br[i];
+        x[i].noalias() -= Ar[i] * x[i-1];
+        if (i + 1 < n) {
+            x[i].noalias() -= Cr[i] * x[i+1];
+        }
+    });
+    return 0;
+}
+
+}
@@ -4,6 +4,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/numerics/CVodesIntegrator.h"
+#include "cantera/base/profiling.h"
 #include "cantera/base/stringUtils.h"
 
 #include <iostream>
@@ -73,6 +74,65 @@ extern "C" {
         integrator->m_error_message += "\n";
     }
 
+#if CT_SUNDIALS_VERSION >= 40
+    //! Function called by CVodes to evaluate the analytic Jacobian when the
+    //! function evaluator provides one
+    static int cvodes_jac(realtype t, N_Vector y, N_Vector ydot, SUNMatrix J,
+                          void* f_data, N_Vector tmp1, N_Vector tmp2,
+                          N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->jacobian_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot),
+                                   SM_DATA_D(J));
+    }
+#endif
+
+    //! Function called by CVodes to evaluate the event (root) functions
+    static int cvodes_rootfn(realtype t, N_Vector y, realtype* gout,
+                             void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        f->evalEvents(t, NV_DATA_S(y), gout);
+        return 0;
+    }
+
+#ifdef CT_SUNDIALS_USE_KLU
+    //! Function called by CVodes to evaluate the analytic Jacobian in
+    //! compressed sparse column form
+    static int cvodes_jac_sparse(realtype t, N_Vector y, N_Vector ydot,
+                                 SUNMatrix J, void* f_data, N_Vector tmp1,
+                                 N_Vector tmp2, N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        SparseTriplets trips;
+        int flag = f->jacobianSparse_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot),
+                                             trips);
+        if (flag != 0) {
+            return flag;
+        }
+        sunindextype n = SM_COLUMNS_S(J);
+        Eigen::SparseMatrix<double> jac(n, n);
+        jac.setFromTriplets(trips.begin(), trips.end());
+        jac.makeCompressed();
+        if (SM_NNZ_S(J) < jac.nonZeros()
+            && SUNSparseMatrix_Reallocate(J, jac.nonZeros()) != 0)
+        {
+            return -1;
+        }
+        sunindextype* colptrs = SM_INDEXPTRS_S(J);
+        sunindextype* rowvals = SM_INDEXVALS_S(J);
+        double* data = SM_DATA_S(J);
+        for (sunindextype col = 0; col <= n; col++) {
+            colptrs[col] = jac.outerIndexPtr()[col];
+        }
+        for (sunindextype i = 0; i < jac.nonZeros(); i++) {
+            rowvals[i] = jac.innerIndexPtr()[i];
+            data[i] = jac.valuePtr()[i];
+        }
+        return 0;
+    }
+#endif
+
     static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector ydot, booleantype jok,
                                  booleantype *jcurPtr, realtype gamma, void *f_data)
     {
@@ -278,8 +338,14 @@ void CVodesIntegrator::sensInit(double t0, FuncEval& func)
     }
     N_VDestroy_Serial(y);
 
+    int ism = CV_STAGGERED;
+    if (m_sens_method == "simultaneous") {
+        ism = CV_SIMULTANEOUS;
+    } else if (m_sens_method == "staggered-1") {
+        ism = CV_STAGGERED1;
+    }
     int flag = CVodeSensInit(m_cvode_mem, static_cast<sd_size_t>(m_np),
-                             CV_STAGGERED, CVSensRhsFn(0), m_yS);
+                             ism, CVSensRhsFn(0), m_yS);
 
     if (flag != CV_SUCCESS) {
         throw CanteraError("CVodesIntegrator::sensInit", "Error in CVodeSensInit");
@@ -295,6 +361,12 @@ void CVodesIntegrator::sensInit(double t0, FuncEval& func)
 
 void CVodesIntegrator::initialize(double t0, FuncEval& func)
 {
+    // solver memory is recreated below; the linear solver must be rebuilt
+    m_applied_type.clear();
+    m_applied_neq = 0;
+    // events recorded for a previous problem do not carry over
+    m_rootTimes.clear();
+    m_rootInfo.clear();
     m_neq = func.neq();
     m_t0 = t0;
     m_time = t0;
@@ -402,6 +474,8 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
     if (m_prec_side != PreconditionerSide::NO_PRECONDITION) {
         m_preconditioner->initialize(m_neq);
     }
+    m_rootTimes.clear();
+    m_rootInfo.clear();
     int result = CVodeReInit(m_cvode_mem, m_t0, m_y);
     if (result != CV_SUCCESS) {
         throw CanteraError("CVodesIntegrator::reinitialize",
@@ -412,8 +486,16 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
 
 void CVodesIntegrator::applyOptions()
 {
+    bool sameStructure = (m_applied_type == m_type && m_applied_neq == m_neq
+                          && m_applied_mupper == m_mupper
+                          && m_applied_mlower == m_mlower);
     if (m_type == "DENSE") {
         sd_size_t N = static_cast<sd_size_t>(m_neq);
+        int flag;
+        // when the attached solver memory already matches the problem
+        // structure, it survives CVodeReInit and the teardown/rebuild is
+        // skipped
+        if (!(sameStructure && m_linsol)) {
         SUNLinSolFree((SUNLinearSolver) m_linsol);
         SUNMatDestroy((SUNMatrix) m_linsol_matrix);
         #if CT_SUNDIALS_VERSION >= 60
@@ -425,7 +507,6 @@ void CVodesIntegrator::applyOptions()
             throw CanteraError("CVodesIntegrator::applyOptions",
                 "Unable to create SUNDenseMatrix of size {0} x {0}", N);
         }
-        int flag;
         #if CT_SUNDIALS_VERSION >= 60
             #if CT_SUNDIALS_USE_LAPACK
                 m_linsol = SUNLinSol_LapackDense(m_y, (SUNMatrix) m_linsol_matrix,
@@ -453,12 +534,62 @@ void CVodesIntegrator::applyOptions()
                 "Error connecting linear solver to CVODES. "
                 "Sundials error code: {}", flag);
         }
+        }
 
         // throw preconditioner error for DENSE + NOJAC
         if (m_prec_side != PreconditionerSide::NO_PRECONDITION) {
             throw CanteraError("CVodesIntegrator::applyOptions",
                 "Preconditioning is not available with the specified problem type.");
         }
+
+        #if CT_SUNDIALS_VERSION >= 40
+            // use the analytic Jacobian when the function evaluator provides
+            // one, avoiding the N+1 difference-quotient RHS evaluations of
+            // the internal approximation
+            if (m_func && m_func->hasJacobian()) {
+                flag = CVodeSetJacFn(m_cvode_mem, cvodes_jac);
+                if (flag != CV_SUCCESS) {
+                    throw CanteraError("CVodesIntegrator::applyOptions",
+                        "Error registering analytic Jacobian. "
+                        "Sundials error code: {}", flag);
+                }
+            }
+        #endif
+    } else if (m_type == "SPARSE") {
+#ifdef CT_SUNDIALS_USE_KLU
+        if (!(sameStructure && m_linsol)) {
+            sd_size_t N = static_cast<sd_size_t>(m_neq);
+            SUNLinSolFree((SUNLinearSolver) m_linsol);
+            SUNMatDestroy((SUNMatrix) m_linsol_matrix);
+            // the Jacobian callback reallocates storage as the actual
+            // pattern is discovered
+            #if CT_SUNDIALS_VERSION >= 60
+                m_linsol_matrix = SUNSparseMatrix(N, N, 8 * N, CSC_MAT,
+                                                  m_sundials_ctx.get());
+                m_linsol = SUNLinSol_KLU(m_y, (SUNMatrix) m_linsol_matrix,
+                                         m_sundials_ctx.get());
+            #else
+                m_linsol_matrix = SUNSparseMatrix(N, N, 8 * N, CSC_MAT);
+                m_linsol = SUNLinSol_KLU(m_y, (SUNMatrix) m_linsol_matrix);
+            #endif
+            if (m_linsol == nullptr) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Error creating KLU sparse linear solver object");
+            }
+            CVodeSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol,
+                                 (SUNMatrix) m_linsol_matrix);
+        }
+        int flag = CVodeSetJacFn(m_cvode_mem, cvodes_jac_sparse);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::applyOptions",
+                "Error registering sparse Jacobian. "
+                "Sundials error code: {}", flag);
+        }
+#else
+        throw CanteraError("CVodesIntegrator::applyOptions",
+            "Sparse-direct solves require Sundials built with KLU support "
+            "and compilation with -DCT_SUNDIALS_USE_KLU.");
+#endif
     } else if (m_type == "DIAG") {
         CVDiag(m_cvode_mem);
         // throw preconditioner error for DIAG
@@ -467,6 +598,7 @@ void CVodesIntegrator::applyOptions()
                 "Preconditioning is not available with the specified problem type.");
         }
     } else if (m_type == "GMRES") {
+        if (!(sameStructure && m_linsol)) {
         #if CT_SUNDIALS_VERSION >= 60
             m_linsol = SUNLinSol_SPGMR(m_y, PREC_NONE, 0, m_sundials_ctx.get());
             CVodeSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol, nullptr);
@@ -477,6 +609,7 @@ void CVodesIntegrator::applyOptions()
             m_linsol = SUNSPGMR(m_y, PREC_NONE, 0);
             CVSpilsSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol);
         #endif
+        }
         // set preconditioner if used
         #if CT_SUNDIALS_VERSION >= 40
             if (m_prec_side != PreconditionerSide::NO_PRECONDITION) {
@@ -497,6 +630,7 @@ void CVodesIntegrator::applyOptions()
         sd_size_t N = static_cast<sd_size_t>(m_neq);
         long int nu = m_mupper;
         long int nl = m_mlower;
+        if (!(sameStructure && m_linsol)) {
         SUNLinSolFree((SUNLinearSolver) m_linsol);
         SUNMatDestroy((SUNMatrix) m_linsol_matrix);
         #if CT_SUNDIALS_VERSION >= 60
@@ -530,14 +664,33 @@ void CVodesIntegrator::applyOptions()
             CVDlsSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol,
                                 (SUNMatrix) m_linsol_matrix);
         #endif
+        }
     } else {
         throw CanteraError("CVodesIntegrator::applyOptions",
                            "unsupported option");
     }
 
+    if (m_func && m_func->nEvents()) {
+        int flag = CVodeRootInit(m_cvode_mem,
+                                 static_cast<int>(m_func->nEvents()),
+                                 cvodes_rootfn);
+        if (flag != CV_SUCCESS) {
+            throw CanteraError("CVodesIntegrator::applyOptions",
+                "CVodeRootInit failed. Sundials error code: {}", flag);
+        }
+    }
+
+    m_applied_type = m_type;
+    m_applied_neq = m_neq;
+    m_applied_mupper = m_mupper;
+    m_applied_mlower = m_mlower;
+
     if (m_maxord > 0) {
         CVodeSetMaxOrd(m_cvode_mem, m_maxord);
     }
+    if (m_h0 > 0) {
+        CVodeSetInitStep(m_cvode_mem, m_h0);
+    }
     if (m_maxsteps > 0) {
         CVodeSetMaxNumSteps(m_cvode_mem, m_maxsteps);
     }
@@ -554,10 +707,19 @@ void CVodesIntegrator::applyOptions()
 
 void CVodesIntegrator::integrate(double tout)
 {
+    CT_PROFILE_SCOPE("CVodesIntegrator::integrate");
     if (tout == m_time) {
         return;
     }
     int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
+    while (flag == CV_ROOT_RETURN) {
+        // record the event and continue the same forward integration
+        std::vector<int> found(m_func->nEvents());
+        CVodeGetRootInfo(m_cvode_mem, found.data());
+        m_rootTimes.push_back(m_time);
+        m_rootInfo.insert(m_rootInfo.end(), found.begin(), found.end());
+        flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
+    }
     if (flag != CV_SUCCESS) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
@@ -607,6 +769,13 @@ double* CVodesIntegrator::derivative(double tout, int n)
     return NV_DATA_S(m_dky);
 }
 
+double CVodesIntegrator::lastStepSize() const
+{
+    double hlast = 0.0;
+    CVodeGetLastStep(m_cvode_mem, &hlast);
+    return hlast;
+}
+
 int CVodesIntegrator::lastOrder() const
 {
     int ord;
@@ -661,6 +830,7 @@ AnyMap CVodesIntegrator::solverStats() const
     #endif
 
     stats["steps"] = steps;
+    stats["last_step"] = lastStepSize();
     stats["rhs_evals"] = rhsEvals;
     stats["nonlinear_iters"] = nonlinIters;
     stats["nonlinear_conv_fails"] = nonlinConvFails;
@@ -91,6 +91,17 @@ const doublereal* const* DenseMatrix::const_colPts() const
 
 void DenseMatrix::mult(const double* b, double* prod) const
 {
+    if (nRows() <= 16 && nColumns() <= 16) {
+        // for the small systems common in surface and multicomponent
+        // transport solves, the f77 call overhead exceeds the math; use a
+        // zero-copy mapped product instead
+        MappedMatrix mat(const_cast<double*>(m_data.data()), nRows(),
+                         nColumns());
+        MappedVector bm(const_cast<double*>(b), nColumns());
+        MappedVector pm(prod, nRows());
+        pm.noalias() = mat * bm;
+        return;
+    }
 #if CT_USE_LAPACK
     ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose,
              static_cast<int>(nRows()),
@@ -153,6 +164,30 @@ int solve(DenseMatrix& A, double* b, size_t nrhs, size_t ldb)
     if (ldb == 0) {
         ldb = A.nColumns();
     }
+
+    if (A.nColumns() <= 16) {
+        // small systems: factor via a zero-copy map, avoiding the f77
+        // wrapper overhead; the matrix contents are consumed either way
+        size_t n = A.nColumns();
+        MappedMatrix Am(&A(0,0), n, n);
+        Eigen::PartialPivLU<Eigen::MatrixXd> lu(Am);
+        bool ok = true;
+        Eigen::MatrixXd x(n, nrhs);
+        for (size_t i = 0; i < nrhs; i++) {
+            MappedVector bm(b + ldb * i, n);
+            x.col(i) = lu.solve(bm);
+            ok = ok && x.col(i).allFinite();
+        }
+        if (ok) {
+            for (size_t i = 0; i < nrhs; i++) {
+                MappedVector bm(b + ldb * i, n);
+                bm = x.col(i);
+            }
+            return 0;
+        }
+        // singular matrix: fall through to the LAPACK/Eigen path below for
+        // its pivot diagnostics (neither A nor b was modified above)
+    }
     #if CT_USE_LAPACK
         ct_dgetrf(A.nRows(), A.nColumns(), A.ptrColumn(0),
                   A.nRows(), &A.ipiv()[0], info);
@@ -221,6 +256,14 @@ void multiply(const DenseMatrix& A, const double* const b, double* const prod)
 
 void increment(const DenseMatrix& A, const double* b, double* prod)
 {
+    if (A.nRows() <= 16 && A.nColumns() <= 16) {
+        MappedMatrix Am(&const_cast<DenseMatrix&>(A)(0,0), A.nRows(),
+                        A.nColumns());
+        MappedVector bm(const_cast<double*>(b), A.nColumns());
+        MappedVector pm(prod, A.nRows());
+        pm.noalias() += Am * bm;
+        return;
+    }
     #if CT_USE_LAPACK
         ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose,
                  static_cast<int>(A.nRows()), static_cast<int>(A.nColumns()), 1.0,
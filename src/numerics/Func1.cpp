@@ -11,6 +11,103 @@ using namespace std;
 namespace Cantera
 {
 
+void Func1Tape::compile(Func1& func)
+{
+    m_ops.clear();
+    emit(func);
+    m_stack.resize(m_ops.size());
+    m_lastT = std::numeric_limits<double>::quiet_NaN();
+}
+
+void Func1Tape::emit(Func1& func)
+{
+    switch (func.ID()) {
+    case ConstFuncType:
+        m_ops.push_back({Op::Const, func.c(), nullptr});
+        break;
+    case SumFuncType:
+        emit(func.func1());
+        emit(func.func2());
+        m_ops.push_back({Op::Add, 0.0, nullptr});
+        break;
+    case DiffFuncType:
+        emit(func.func1());
+        emit(func.func2());
+        m_ops.push_back({Op::Sub, 0.0, nullptr});
+        break;
+    case ProdFuncType:
+        emit(func.func1());
+        emit(func.func2());
+        m_ops.push_back({Op::Mul, 0.0, nullptr});
+        break;
+    case RatioFuncType:
+        emit(func.func1());
+        emit(func.func2());
+        m_ops.push_back({Op::Div, 0.0, nullptr});
+        break;
+    case TimesConstantFuncType:
+        emit(func.func1());
+        m_ops.push_back({Op::TimesC, func.c(), nullptr});
+        break;
+    case PlusConstantFuncType:
+        emit(func.func1());
+        m_ops.push_back({Op::PlusC, func.c(), nullptr});
+        break;
+    case CompositeFuncType:
+        // evaluate the inner function, then apply the outer one to the
+        // result through a single virtual call
+        emit(func.func2());
+        m_ops.push_back({Op::Compose, 0.0, &func.func1()});
+        break;
+    default:
+        // leaf or specialized node: one virtual call evaluates it whole
+        m_ops.push_back({Op::Call, 0.0, &func});
+        break;
+    }
+}
+
+double Func1Tape::evalTape(double t) const
+{
+    size_t sp = 0;
+    double* stack = m_stack.data();
+    for (const auto& op : m_ops) {
+        switch (op.op) {
+        case Op::Const:
+            stack[sp++] = op.c;
+            break;
+        case Op::Call:
+            stack[sp++] = op.f->eval(t);
+            break;
+        case Op::Add:
+            sp--;
+            stack[sp-1] += stack[sp];
+            break;
+        case Op::Sub:
+            sp--;
+            stack[sp-1] -= stack[sp];
+            break;
+        case Op::Mul:
+            sp--;
+            stack[sp-1] *= stack[sp];
+            break;
+        case Op::Div:
+            sp--;
+            stack[sp-1] /= stack[sp];
+            break;
+        case Op::Compose:
+            stack[sp-1] = op.f->eval(stack[sp-1]);
+            break;
+        case Op::TimesC:
+            stack[sp-1] *= op.c;
+            break;
+        case Op::PlusC:
+            stack[sp-1] += op.c;
+            break;
+        }
+    }
+    return stack[0];
+}
+
 Func1::Func1() :
     m_c(0.0),
     m_f1(0),
@@ -247,10 +344,19 @@ double Tabulated1::eval(double t) const {
     } else if (t >= m_tvec[siz-1]) {
         return m_fvec[siz-1];
     } else {
-        size_t ix = 0;
+        // start from the segment of the previous query; integrator queries
+        // are near-monotonic, so this nearly always hits immediately and a
+        // scan from the table start is avoided
+        size_t ix = std::min(m_lastSegment, siz - 2);
+        if (t < m_tvec[ix]) {
+            ix = std::upper_bound(m_tvec.begin(), m_tvec.begin() + ix, t)
+                 - m_tvec.begin();
+            ix = (ix == 0) ? 0 : ix - 1;
+        }
         while (t > m_tvec[ix+1]) {
             ix++;
         }
+        m_lastSegment = ix;
         if (m_isLinear) {
             double df = m_fvec[ix+1] - m_fvec[ix];
             df /= m_tvec[ix+1] - m_tvec[ix];
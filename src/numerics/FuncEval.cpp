@@ -42,6 +42,56 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
     return 0; // successful evaluation
 }
 
+int FuncEval::jacobian_nothrow(double t, double* y, double* ydot, double* j)
+{
+    try {
+        evalJacobian(t, y, ydot, m_sens_params.data(), j);
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::jacobian_nothrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::jacobianSparse_nothrow(double t, double* y, double* ydot,
+                                     SparseTriplets& jac)
+{
+    try {
+        jac.clear();
+        evalJacobianSparse(t, y, ydot, m_sens_params.data(), jac);
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::jacobianSparse_nothrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
 std::string FuncEval::getErrors() const {
     std::stringstream errs;
     for (const auto& err : m_errors) {
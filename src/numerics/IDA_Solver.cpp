@@ -4,6 +4,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/numerics/IDA_Solver.h"
+#include "cantera/base/AnyMap.h"
 #include "cantera/base/stringUtils.h"
 
 #include "sundials/sundials_types.h"
@@ -325,28 +326,35 @@ void IDA_Solver::init(doublereal t0)
     m_told = t0;
     m_told_old = t0;
     m_tcurrent = t0;
-    if (m_y) {
-        N_VDestroy_Serial(m_y);
-    }
-    if (m_ydot) {
-        N_VDestroy_Serial(m_ydot);
-    }
-    if (m_id) {
-        N_VDestroy_Serial(m_id);
-    }
-    if (m_constraints) {
-        N_VDestroy_Serial(m_constraints);
-    }
 
-    #if CT_SUNDIALS_VERSION >= 60
-        m_y = N_VNew_Serial(m_neq, m_sundials_ctx.get());
-        m_ydot = N_VNew_Serial(m_neq, m_sundials_ctx.get());
-        m_constraints = N_VNew_Serial(m_neq, m_sundials_ctx.get());
-    #else
-        m_y = N_VNew_Serial(m_neq);
-        m_ydot = N_VNew_Serial(m_neq);
-        m_constraints = N_VNew_Serial(m_neq);
-    #endif
+    // reuse the allocated vectors when the problem size is unchanged;
+    // operator-splitting loops reinitialize every step
+    bool reuse = (m_y && m_ydot && m_constraints
+                  && NV_LENGTH_S(m_y) == static_cast<sd_size_t>(m_neq));
+    if (!reuse) {
+        if (m_y) {
+            N_VDestroy_Serial(m_y);
+        }
+        if (m_ydot) {
+            N_VDestroy_Serial(m_ydot);
+        }
+        if (m_id) {
+            N_VDestroy_Serial(m_id);
+        }
+        if (m_constraints) {
+            N_VDestroy_Serial(m_constraints);
+        }
+
+        #if CT_SUNDIALS_VERSION >= 60
+            m_y = N_VNew_Serial(m_neq, m_sundials_ctx.get());
+            m_ydot = N_VNew_Serial(m_neq, m_sundials_ctx.get());
+            m_constraints = N_VNew_Serial(m_neq, m_sundials_ctx.get());
+        #else
+            m_y = N_VNew_Serial(m_neq);
+            m_ydot = N_VNew_Serial(m_neq);
+            m_constraints = N_VNew_Serial(m_neq);
+        #endif
+    }
 
     for (int i=0; i<m_neq; i++) {
         NV_Ith_S(m_y, i) = 0.0;
@@ -685,4 +693,37 @@ doublereal IDA_Solver::getOutputParameter(int flag) const
     return 0.0;
 }
 
+
+AnyMap IDA_Solver::solverStats() const
+{
+    AnyMap stats;
+    long int steps = 0, residEvals = 0, jacEvals = 0, errTestFails = 0,
+             nonlinIters = 0, nonlinConvFails = 0;
+    int lastOrder = 0;
+    double lastStep = 0.0;
+    if (m_ida_mem) {
+        IDAGetNumSteps(m_ida_mem, &steps);
+        IDAGetNumResEvals(m_ida_mem, &residEvals);
+        IDAGetNumErrTestFails(m_ida_mem, &errTestFails);
+        IDAGetLastOrder(m_ida_mem, &lastOrder);
+        IDAGetLastStep(m_ida_mem, &lastStep);
+        IDAGetNumNonlinSolvIters(m_ida_mem, &nonlinIters);
+        IDAGetNumNonlinSolvConvFails(m_ida_mem, &nonlinConvFails);
+        #if CT_SUNDIALS_VERSION >= 40
+            IDAGetNumJacEvals(m_ida_mem, &jacEvals);
+        #else
+            IDADlsGetNumJacEvals(m_ida_mem, &jacEvals);
+        #endif
+    }
+    stats["steps"] = steps;
+    stats["resid_evals"] = residEvals;
+    stats["jac_evals"] = jacEvals;
+    stats["err_test_fails"] = errTestFails;
+    stats["last_order"] = lastOrder;
+    stats["last_step"] = lastStep;
+    stats["nonlinear_iters"] = nonlinIters;
+    stats["nonlinear_conv_fails"] = nonlinConvFails;
+    return stats;
+}
+
 }
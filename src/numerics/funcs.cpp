@@ -112,6 +112,98 @@ double simpson(const Eigen::ArrayXd& f, const Eigen::ArrayXd& x)
     }
 }
 
+Interp1D::Interp1D(const vector_fp& x, const vector_fp& f, Method method)
+    : m_x(x)
+    , m_f(f)
+    , m_method(method)
+{
+    if (x.size() < 2 || x.size() != f.size()) {
+        throw CanteraError("Interp1D::Interp1D",
+            "Need at least two nodes and matching value array; got {} and "
+            "{}.", x.size(), f.size());
+    }
+    for (size_t i = 1; i < x.size(); i++) {
+        if (x[i] <= x[i-1]) {
+            throw CanteraError("Interp1D::Interp1D",
+                "Node positions must be strictly increasing.");
+        }
+    }
+    if (m_method == Method::MonotoneHermite) {
+        // Fritsch-Carlson slopes: start from secant averages and limit them
+        // so the interpolant preserves monotonicity
+        size_t n = x.size();
+        vector_fp d(n - 1);
+        for (size_t i = 0; i < n - 1; i++) {
+            d[i] = (f[i+1] - f[i]) / (x[i+1] - x[i]);
+        }
+        m_slope.resize(n);
+        m_slope[0] = d[0];
+        m_slope[n-1] = d[n-2];
+        for (size_t i = 1; i < n - 1; i++) {
+            if (d[i-1] * d[i] <= 0.0) {
+                m_slope[i] = 0.0;
+            } else {
+                m_slope[i] = 2.0 * d[i-1] * d[i] / (d[i-1] + d[i]);
+            }
+        }
+        for (size_t i = 0; i < n - 1; i++) {
+            if (d[i] == 0.0) {
+                m_slope[i] = 0.0;
+                m_slope[i+1] = 0.0;
+            } else {
+                double a = m_slope[i] / d[i];
+                double b = m_slope[i+1] / d[i];
+                double norm = a * a + b * b;
+                if (norm > 9.0) {
+                    double tau = 3.0 / std::sqrt(norm);
+                    m_slope[i] = tau * a * d[i];
+                    m_slope[i+1] = tau * b * d[i];
+                }
+            }
+        }
+    }
+}
+
+size_t Interp1D::findCell(double x) const
+{
+    size_t i = std::min(m_lastCell, m_x.size() - 2);
+    if (m_x[i] <= x && x <= m_x[i+1]) {
+        return i;
+    }
+    i = std::upper_bound(m_x.begin(), m_x.end(), x) - m_x.begin();
+    i = (i == 0) ? 0 : std::min(i - 1, m_x.size() - 2);
+    m_lastCell = i;
+    return i;
+}
+
+double Interp1D::eval(double x) const
+{
+    if (x <= m_x.front()) {
+        return m_f.front();
+    }
+    if (x >= m_x.back()) {
+        return m_f.back();
+    }
+    size_t i = findCell(x);
+    double h = m_x[i+1] - m_x[i];
+    double t = (x - m_x[i]) / h;
+    if (m_method == Method::Linear) {
+        return m_f[i] + t * (m_f[i+1] - m_f[i]);
+    }
+    // cubic Hermite basis
+    double t2 = t * t;
+    double t3 = t2 * t;
+    return m_f[i] * (2*t3 - 3*t2 + 1) + m_f[i+1] * (-2*t3 + 3*t2)
+           + h * (m_slope[i] * (t3 - 2*t2 + t) + m_slope[i+1] * (t3 - t2));
+}
+
+void Interp1D::eval(size_t n, const double* x, double* f) const
+{
+    for (size_t i = 0; i < n; i++) {
+        f[i] = eval(x[i]);
+    }
+}
+
 double numericalQuadrature(const std::string& method,
                            const Eigen::ArrayXd& f,
                            const Eigen::ArrayXd& x)
@@ -53,4 +53,33 @@ double polyfit(size_t n, size_t deg, const double* xp, const double* yp,
     return (A*p - y).eval().norm() / sqrt(n);
 }
 
+PolyFitter::PolyFitter(size_t n, size_t deg, const double* xp)
+    : m_n(n)
+    , m_deg(deg)
+{
+    if (deg >= n) {
+        throw CanteraError("PolyFitter::PolyFitter",
+            "Polynomial degree ({}) must be less than number of input data "
+            "points ({})", deg, n);
+    }
+    ConstMappedVector x(xp, n);
+    m_A.resize(n, deg+1);
+    m_A.col(0).setConstant(1.0);
+    if (deg > 0) {
+        m_A.col(1) = x;
+    }
+    for (size_t i = 1; i < deg; i++) {
+        m_A.col(i+1) = m_A.col(i).array() * x.array();
+    }
+    m_QR = m_A.colPivHouseholderQr();
+}
+
+double PolyFitter::fit(const double* yp, double* pp) const
+{
+    ConstMappedVector y(yp, m_n);
+    MappedVector p(pp, m_deg+1);
+    p = m_QR.solve(y);
+    return (m_A*p - y).eval().norm() / sqrt(m_n);
+}
+
 }
@@ -111,7 +111,7 @@ void IonFlow::updateDiffFluxes(const double* x, size_t j0, size_t j1)
     if (m_stage == 1) {
         frozenIonMethod(x,j0,j1);
     }
-    if (m_stage == 2) {
+    if (m_stage == 2 || m_stage == 3) {
         electricFieldMethod(x,j0,j1);
     }
 }
@@ -156,8 +156,8 @@ void IonFlow::electricFieldMethod(const double* x, size_t j0, size_t j1)
             m_flux(k,j) *= (X(x,k,j) - X(x,k,j+1))/dz;
         }
 
-        // ambipolar diffusion
-        double E_ambi = E(x,j);
+        // ambipolar diffusion; the segregated mode uses the lagged field
+        double E_ambi = (m_stage == 3) ? m_Efield[j] : E(x,j);
         for (size_t k : m_kCharge) {
             double Yav = 0.5 * (Y(x,k,j) + Y(x,k,j+1));
             double drift = rho * Yav * E_ambi
@@ -183,13 +183,14 @@ void IonFlow::electricFieldMethod(const double* x, size_t j0, size_t j1)
 
 void IonFlow::setSolvingStage(const size_t stage)
 {
-    if (stage == 1 || stage == 2) {
+    if (stage == 1 || stage == 2 || stage == 3) {
         m_stage = stage;
     } else {
         throw CanteraError("IonFlow::setSolvingStage",
                     "solution stage must be set to: "
                     "1) frozenIonMethod, "
-                    "2) electricFieldEqnMethod");
+                    "2) electricFieldEqnMethod, "
+                    "3) segregated electric field (lagged coupling)");
     }
 }
 
@@ -197,6 +198,23 @@ void IonFlow::evalResidual(double* x, double* rsd, int* diag,
                            double rdt, size_t jmin, size_t jmax)
 {
     StFlow::evalResidual(x, rsd, diag, rdt, jmin, jmax);
+    if (m_stage == 3) {
+        // segregated mode: the field is obtained by direct integration of
+        // Gauss's law with the charge density lagged, and the field
+        // component is pinned to it, keeping the electric coupling out of
+        // the Newton Jacobian
+        updateElectricField(x);
+        for (size_t j = jmin; j <= jmax; j++) {
+            if (j == 0) {
+                for (size_t k : m_kCharge) {
+                    rsd[index(c_offset_Y + k, 0)] = Y(x,k,0) - Y(x,k,1);
+                }
+            }
+            rsd[index(c_offset_E, j)] = E(x,j) - m_Efield[j];
+            diag[index(c_offset_E, j)] = 0;
+        }
+        return;
+    }
     if (m_stage != 2) {
         return;
     }
@@ -228,6 +246,19 @@ void IonFlow::evalResidual(double* x, double* rsd, int* diag,
     }
 }
 
+void IonFlow::updateElectricField(double* x)
+{
+    // integrate Gauss's law dE/dz = rho_e/eps_0 from the burner side with
+    // E(0) = 0, using the trapezoid rule on the lagged charge density
+    m_Efield.resize(m_points, 0.0);
+    m_Efield[0] = 0.0;
+    for (size_t j = 1; j < m_points; j++) {
+        double dz = z(j) - z(j-1);
+        m_Efield[j] = m_Efield[j-1]
+            + 0.5 * dz * (rho_e(x, j) + rho_e(x, j-1)) / epsilon_0;
+    }
+}
+
 void IonFlow::solveElectricField(size_t j)
 {
     bool changed = false;
@@ -4,6 +4,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/oneD/MultiJac.h"
+#include "cantera/base/profiling.h"
 #include <ctime>
 
 using namespace std;
@@ -42,6 +43,11 @@ void MultiJac::incrementDiagonal(int j, doublereal d)
 
 void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
 {
+    CT_PROFILE_SCOPE("MultiJac::eval");
+    if (m_colored) {
+        evalColored(x0, resid0, rdt);
+        return;
+    }
     m_nevals++;
     clock_t t0 = clock();
     bfill(0.0);
@@ -88,4 +94,75 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
     m_age = 0;
 }
 
+void MultiJac::evalColored(doublereal* x0, doublereal* resid0, doublereal rdt)
+{
+    m_nevals++;
+    clock_t t0 = clock();
+    bfill(0.0);
+    m_xsaveCol.resize(m_points);
+    m_rdxCol.resize(m_points);
+
+    size_t maxnv = 0;
+    for (size_t j = 0; j < m_points; j++) {
+        maxnv = std::max(maxnv, m_resid->nVars(j));
+    }
+
+    for (size_t color = 0; color < 3; color++) {
+        for (size_t n = 0; n < maxnv; n++) {
+            // perturb component n at all points of this color; points three
+            // apart do not share residual rows of the nearest-neighbor
+            // stencil, so one evaluation yields all their columns
+            bool any = false;
+            for (size_t j = color; j < m_points; j += 3) {
+                if (n >= m_resid->nVars(j)) {
+                    continue;
+                }
+                size_t ipt = m_resid->loc(j) + n;
+                double xsave = x0[ipt];
+                double dx;
+                if (xsave >= 0) {
+                    dx = xsave*m_rtol + m_atol;
+                } else {
+                    dx = xsave*m_rtol - m_atol;
+                }
+                x0[ipt] = xsave + dx;
+                m_xsaveCol[j] = xsave;
+                m_rdxCol[j] = 1.0/(x0[ipt] - xsave);
+                any = true;
+            }
+            if (!any) {
+                continue;
+            }
+
+            // calculate the residual perturbed at all points of the color
+            m_resid->eval(npos, x0, m_r1.data(), rdt, 0);
+
+            for (size_t j = color; j < m_points; j += 3) {
+                if (n >= m_resid->nVars(j)) {
+                    continue;
+                }
+                size_t ipt = m_resid->loc(j) + n;
+                double rdx = m_rdxCol[j];
+                for (size_t i = j - 1; i != j+2; i++) {
+                    if (i != npos && i < m_points) {
+                        size_t mv = m_resid->nVars(i);
+                        size_t iloc = m_resid->loc(i);
+                        for (size_t m = 0; m < mv; m++) {
+                            value(m+iloc,ipt) = (m_r1[m+iloc] - resid0[m+iloc])*rdx;
+                        }
+                    }
+                }
+                x0[ipt] = m_xsaveCol[j];
+            }
+        }
+    }
+
+    for (size_t n = 0; n < m_size; n++) {
+        m_ssdiag[n] = value(n,n);
+    }
+
+    m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
+    m_age = 0;
+}
+
 } // namespace
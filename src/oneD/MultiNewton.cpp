@@ -159,16 +159,144 @@ doublereal MultiNewton::norm2(const doublereal* x,
     return sqrt(sum);
 }
 
+bool MultiNewton::solveBlock(OneDim& r, MultiJac& jac, doublereal* step)
+{
+    size_t np = r.points();
+    std::vector<Eigen::MatrixXd> A(np), B(np), C(np);
+    std::vector<Eigen::VectorXd> b(np);
+    for (size_t j = 0; j < np; j++) {
+        size_t nv = r.nVars(j);
+        if (nv == 0) {
+            // empty blocks cannot be pivoted; use the banded path
+            return false;
+        }
+        size_t loc = r.loc(j);
+        size_t nvm = (j > 0) ? r.nVars(j-1) : 0;
+        size_t nvp = (j + 1 < np) ? r.nVars(j+1) : 0;
+        A[j].resize(nv, nvm);
+        B[j].resize(nv, nv);
+        C[j].resize(nv, nvp);
+        b[j].resize(nv);
+        size_t locm = (j > 0) ? r.loc(j-1) : 0;
+        size_t locp = (j + 1 < np) ? r.loc(j+1) : 0;
+        for (size_t m = 0; m < nv; m++) {
+            b[j](m) = step[loc + m];
+            for (size_t i = 0; i < nvm; i++) {
+                A[j](m, i) = jac.value(loc + m, locm + i);
+            }
+            for (size_t i = 0; i < nv; i++) {
+                B[j](m, i) = jac.value(loc + m, loc + i);
+            }
+            for (size_t i = 0; i < nvp; i++) {
+                C[j](m, i) = jac.value(loc + m, locp + i);
+            }
+        }
+    }
+
+    std::vector<Eigen::VectorXd> x;
+    if (m_blockSolver.solve(A, B, C, b, x) != 0) {
+        return false;
+    }
+    for (size_t j = 0; j < np; j++) {
+        size_t loc = r.loc(j);
+        for (size_t m = 0; m < r.nVars(j); m++) {
+            step[loc + m] = x[j](m);
+        }
+    }
+    return true;
+}
+
+void MultiNewton::applyBroyden(doublereal* v) const
+{
+    for (size_t i = 0; i < m_updZ.size(); i++) {
+        const vector_fp& z = m_updZ[i];
+        const vector_fp& w = m_updV[i];
+        double dot = 0.0;
+        for (size_t n = 0; n < m_n; n++) {
+            dot += w[n] * v[n];
+        }
+        for (size_t n = 0; n < m_n; n++) {
+            v[n] -= z[n] * dot;
+        }
+    }
+}
+
+void MultiNewton::updateBroyden(const doublereal* x, const doublereal* f,
+                                OneDim& r, MultiJac& jac)
+{
+    if (jac.nEvals() != m_jacEvalsB) {
+        // fresh Jacobian: previous updates (and the previous iterate, which
+        // relates to the old Jacobian) are obsolete
+        m_jacEvalsB = jac.nEvals();
+        m_updU.clear();
+        m_updV.clear();
+        m_updZ.clear();
+    } else if (m_havePrevB && m_updZ.size() < m_broydenMax) {
+        vector_fp dx(m_n), df(m_n), w(m_n);
+        double dx2 = 0.0;
+        for (size_t n = 0; n < m_n; n++) {
+            dx[n] = x[n] - m_xPrevB[n];
+            df[n] = f[n] - m_fPrevB[n];
+            dx2 += dx[n] * dx[n];
+        }
+        if (dx2 > 0.0) {
+            // u = (df - J dx) / (dx . dx), with J including prior updates
+            jac.mult(dx.data(), w.data());
+            for (size_t i = 0; i < m_updU.size(); i++) {
+                double dot = 0.0;
+                for (size_t n = 0; n < m_n; n++) {
+                    dot += m_updV[i][n] * dx[n];
+                }
+                for (size_t n = 0; n < m_n; n++) {
+                    w[n] += m_updU[i][n] * dot;
+                }
+            }
+            vector_fp u(m_n);
+            for (size_t n = 0; n < m_n; n++) {
+                u[n] = (df[n] - w[n]) / dx2;
+            }
+
+            // z = A^{-1} u / (1 + v . A^{-1} u), via the existing
+            // factorization and prior corrections
+            vector_fp z(m_n);
+            jac.solve(u.data(), z.data());
+            applyBroyden(z.data());
+            double denom = 1.0;
+            for (size_t n = 0; n < m_n; n++) {
+                denom += dx[n] * z[n];
+            }
+            if (std::abs(denom) > 1e-12) {
+                for (size_t n = 0; n < m_n; n++) {
+                    z[n] /= denom;
+                }
+                m_updU.push_back(std::move(u));
+                m_updV.push_back(dx);
+                m_updZ.push_back(std::move(z));
+            }
+        }
+    }
+    m_xPrevB.assign(x, x + m_n);
+    m_fPrevB.assign(f, f + m_n);
+    m_havePrevB = true;
+}
+
 void MultiNewton::step(doublereal* x, doublereal* step,
                        OneDim& r, MultiJac& jac, int loglevel)
 {
     r.eval(npos, x, step);
+    if (m_broydenMax > 0) {
+        // record a Broyden update from the residual change since the
+        // previous iterate before the residual is negated below
+        updateBroyden(x, step, r, jac);
+    }
     for (size_t n = 0; n < r.size(); n++) {
         step[n] = -step[n];
     }
 
     try {
-        jac.solve(step, step);
+        if (m_blockThreads == 0 || !solveBlock(r, jac, step)) {
+            jac.solve(step, step);
+        }
     } catch (CanteraError&) {
         if (jac.info() > 0) {
             // Positive value for "info" indicates the row where factorization failed
@@ -191,6 +319,10 @@ void MultiNewton::step(doublereal* x, doublereal* step,
         }
         throw;
     }
+
+    if (m_broydenMax > 0) {
+        applyBroyden(step);
+    }
 }
 
 doublereal MultiNewton::boundStep(const doublereal* x0,
@@ -270,6 +402,7 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
             break;
         }
         damp /= DampFactor;
+        m_nBacktracks++;
     }
 
     // If a damping coefficient was found, return 1 if the solution after
@@ -289,6 +422,7 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
 int MultiNewton::solve(doublereal* x0, doublereal* x1,
                        OneDim& r, MultiJac& jac, int loglevel)
 {
+    m_nSolveCalls++;
     clock_t t0 = clock();
     int m = 0;
     bool forceNewJac = false;
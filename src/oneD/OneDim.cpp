@@ -4,6 +4,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/oneD/OneDim.h"
+#include "cantera/base/ThreadPool.h"
 #include "cantera/numerics/Func1.h"
 #include "cantera/oneD/MultiNewton.h"
 #include "cantera/base/AnyMap.h"
@@ -212,8 +213,19 @@ void OneDim::resize()
     m_newt->resize(size());
     m_mask.resize(size());
 
-    // delete the current Jacobian evaluator and create a new one
-    m_jac.reset(new MultiJac(*this));
+    // Reuse the existing Jacobian evaluator if the problem layout is
+    // unchanged; otherwise create a new one, carrying over its
+    // configuration. In either case the Jacobian contents are stale and a
+    // re-evaluation is forced.
+    if (m_jac && m_jac->nRows() == m_size && m_jac->gridPoints() == m_pts
+        && m_jac->nSubDiagonals() == m_bw)
+    {
+        m_jac->setAge(100000);
+    } else {
+        bool colored = m_jac && m_jac->coloredMode();
+        m_jac.reset(new MultiJac(*this));
+        m_jac->setColoredMode(colored);
+    }
     m_jac_ok = false;
 
     for (size_t i = 0; i < nDomains(); i++) {
@@ -269,9 +281,19 @@ void OneDim::eval(size_t j, double* x, double* r, doublereal rdt, int count)
         rdt = m_rdt;
     }
 
-    // iterate over the bulk domains first
-    for (const auto& d : m_bulk) {
-        d->eval(j, x, r, m_mask.data(), rdt);
+    // iterate over the bulk domains first; in the domain-parallel mode
+    // their residuals are evaluated concurrently, which is valid because
+    // each bulk domain writes only its own residual rows and reads the
+    // solution vector, while the connector domains that couple them are
+    // evaluated afterwards
+    if (m_parallel_domains && j == npos && m_bulk.size() > 1) {
+        ThreadPool::instance().parallelFor(m_bulk.size(), [&](size_t n) {
+            m_bulk[n]->eval(j, x, r, m_mask.data(), rdt);
+        });
+    } else {
+        for (const auto& d : m_bulk) {
+            d->eval(j, x, r, m_mask.data(), rdt);
+        }
     }
 
     // then over the connector domains
@@ -356,6 +378,8 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
 
     int n = 0;
     int successiveFailures = 0;
+    int caution = 0; // step-growth damping after a recent failure
+    int lastBacktracks = newton().nBacktracks();
 
     while (n < nsteps) {
         if (loglevel > 0) {
@@ -377,9 +401,29 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
             n += 1;
             debuglog("\n", loglevel);
             copy(r, r + m_size, x);
-            if (m == 100) {
-                dt *= 1.5;
+
+            // Smooth step-size control: grow according to how hard the
+            // Newton solver worked (damping backtracks taken during this
+            // step, and whether a fresh Jacobian was needed), and hold
+            // growth back for a couple of steps after a failure so the
+            // step size stops oscillating between overshoot and refailure.
+            int backtracks = newton().nBacktracks() - lastBacktracks;
+            lastBacktracks = newton().nBacktracks();
+            double grow;
+            if (backtracks == 0 && m == 100) {
+                grow = 2.0; // effortless step without a Jacobian rebuild
+            } else if (backtracks <= 1) {
+                grow = 1.5;
+            } else if (backtracks <= 4) {
+                grow = 1.2;
+            } else {
+                grow = 1.0; // barely converged; hold the step size
+            }
+            if (caution > 0) {
+                grow = std::min(grow, 1.25);
+                caution--;
             }
+            dt *= grow;
             if (m_time_step_callback) {
                 m_time_step_callback->eval(dt);
             }
@@ -391,6 +435,9 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
             }
         } else {
             successiveFailures++;
+            m_nTimeStepFails++;
+            caution = 3;
+            lastBacktracks = newton().nBacktracks();
             // No solution could be found with this time step.
             // Decrease the stepsize and try again.
             debuglog("...failure.\n", loglevel);
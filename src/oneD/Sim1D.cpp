@@ -183,6 +183,179 @@ void Sim1D::restore(const std::string& fname, const std::string& id,
     finalize();
 }
 
+namespace {
+
+//! Format version of Sim1D binary checkpoint files
+const int CheckpointVersion = 1;
+
+void writeString(std::ostream& out, const std::string& str)
+{
+    uint64_t n = str.size();
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(str.data(), n);
+}
+
+std::string readString(std::istream& in)
+{
+    uint64_t n = 0;
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if (!in || n > 4096) {
+        throw CanteraError("Sim1D::restoreBinary", "Corrupt checkpoint file");
+    }
+    std::string str(n, '\0');
+    in.read(&str[0], n);
+    return str;
+}
+
+} // anonymous namespace
+
+void Sim1D::saveBinary(const std::string& fname)
+{
+    std::ofstream out(fname, std::ios::binary);
+    if (!out) {
+        throw CanteraError("Sim1D::saveBinary",
+                           "Unable to open file '{}' for writing.", fname);
+    }
+    out.write("CT1D", 4);
+    out.write(reinterpret_cast<const char*>(&CheckpointVersion),
+              sizeof(CheckpointVersion));
+    uint64_t nd = nDomains();
+    out.write(reinterpret_cast<const char*>(&nd), sizeof(nd));
+    for (auto dom : m_dom) {
+        writeString(out, dom->id());
+        uint64_t comp = dom->nComponents();
+        uint64_t np = dom->nPoints();
+        out.write(reinterpret_cast<const char*>(&comp), sizeof(comp));
+        out.write(reinterpret_cast<const char*>(&np), sizeof(np));
+        out.write(reinterpret_cast<const char*>(dom->grid().data()),
+                  np * sizeof(double));
+    }
+    uint64_t n = m_x.size();
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char*>(m_x.data()), n * sizeof(double));
+}
+
+namespace {
+
+//! Interpolate all components of a domain block from a source grid onto a
+//! target grid in one index-merged sweep. Solution values are stored
+//! point-major with *nc* components per point; constant extrapolation is
+//! used outside the source grid.
+void transferDomainSolution(const vector_fp& zSrc, const double* xSrc,
+                            const vector_fp& zDst, double* xDst, size_t nc)
+{
+    size_t cell = 0;
+    for (size_t n = 0; n < zDst.size(); n++) {
+        double z = zDst[n];
+        // both grids are monotone, so the source interval pointer only
+        // moves forward across the whole sweep
+        while (cell + 2 < zSrc.size() && zSrc[cell + 1] < z) {
+            cell++;
+        }
+        double z0 = zSrc[cell];
+        double z1 = zSrc[cell + 1];
+        double frac = (z - z0) / (z1 - z0);
+        frac = std::max(0.0, std::min(1.0, frac));
+        const double* s0 = xSrc + cell * nc;
+        const double* s1 = s0 + nc;
+        double* d = xDst + n * nc;
+        for (size_t c = 0; c < nc; c++) {
+            d[c] = s0[c] + frac * (s1[c] - s0[c]);
+        }
+    }
+}
+
+} // anonymous namespace
+
+void Sim1D::restoreBinary(const std::string& fname, bool keepGrid)
+{
+    std::ifstream in(fname, std::ios::binary);
+    if (!in) {
+        throw CanteraError("Sim1D::restoreBinary",
+                           "Unable to open file '{}' for reading.", fname);
+    }
+    char magic[4];
+    int version = -1;
+    in.read(magic, 4);
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!in || strncmp(magic, "CT1D", 4) != 0
+        || version != CheckpointVersion)
+    {
+        throw CanteraError("Sim1D::restoreBinary",
+            "File '{}' is not a compatible binary checkpoint.", fname);
+    }
+    uint64_t nd = 0;
+    in.read(reinterpret_cast<char*>(&nd), sizeof(nd));
+    if (nd != nDomains()) {
+        throw CanteraError("Sim1D::restoreBinary",
+            "Checkpoint holds {} domains; simulation has {}.",
+            nd, nDomains());
+    }
+    std::vector<vector_fp> srcGrids;
+    for (auto dom : m_dom) {
+        std::string id = readString(in);
+        uint64_t comp = 0, np = 0;
+        in.read(reinterpret_cast<char*>(&comp), sizeof(comp));
+        in.read(reinterpret_cast<char*>(&np), sizeof(np));
+        if (id != dom->id() || comp != dom->nComponents()) {
+            throw CanteraError("Sim1D::restoreBinary",
+                "Domain '{}' of the checkpoint does not match domain '{}'.",
+                id, dom->id());
+        }
+        vector_fp z(np);
+        in.read(reinterpret_cast<char*>(z.data()), np * sizeof(double));
+        if (keepGrid) {
+            srcGrids.push_back(std::move(z));
+        } else {
+            dom->setupGrid(np, z.data());
+        }
+    }
+    if (!keepGrid) {
+        resize();
+    }
+    m_xlast_ts.clear();
+    uint64_t n = 0;
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    vector_fp xSrc(n);
+    in.read(reinterpret_cast<char*>(xSrc.data()), n * sizeof(double));
+    if (!in) {
+        throw CanteraError("Sim1D::restoreBinary", "Corrupt checkpoint file");
+    }
+    if (keepGrid) {
+        // transfer each domain block onto the current grids with one
+        // merged interpolation sweep
+        size_t srcLoc = 0;
+        for (size_t nd = 0; nd < nDomains(); nd++) {
+            Domain1D& dom = domain(nd);
+            size_t nc = dom.nComponents();
+            if (srcGrids[nd].size() < 2) {
+                // single-point (boundary) domains copy directly
+                std::copy(xSrc.begin() + srcLoc,
+                          xSrc.begin() + srcLoc + nc * srcGrids[nd].size(),
+                          m_x.begin() + dom.loc());
+            } else {
+                transferDomainSolution(srcGrids[nd], xSrc.data() + srcLoc,
+                                       dom.grid(), m_x.data() + dom.loc(),
+                                       nc);
+            }
+            srcLoc += nc * srcGrids[nd].size();
+        }
+        if (srcLoc != n) {
+            throw CanteraError("Sim1D::restoreBinary",
+                "Checkpoint solution size ({}) is inconsistent with its "
+                "grids ({}).", n, srcLoc);
+        }
+    } else {
+        if (n != m_x.size()) {
+            throw CanteraError("Sim1D::restoreBinary",
+                "Checkpoint solution size ({}) does not match simulation "
+                "({}).", n, m_x.size());
+        }
+        std::copy(xSrc.begin(), xSrc.end(), m_x.begin());
+    }
+    finalize();
+}
+
 void Sim1D::setFlatProfile(size_t dom, size_t comp, doublereal v)
 {
     size_t np = domain(dom).nPoints();
@@ -384,9 +557,141 @@ void Sim1D::solve(int loglevel, bool refine_grid)
     }
 }
 
+int Sim1D::coarsenGrid(size_t stride)
+{
+    if (stride < 2) {
+        throw CanteraError("Sim1D::coarsenGrid",
+                           "Coarsening stride must be at least 2.");
+    }
+    vector_fp znew, xnew;
+    std::vector<size_t> dsize;
+    int nRemoved = 0;
+
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t comp = d.nComponents();
+        size_t npnow = d.nPoints();
+        size_t nstart = znew.size();
+        for (size_t m = 0; m < npnow; m++) {
+            // keep the endpoints and every stride-th interior point
+            if (m == 0 || m == npnow - 1 || m % stride == 0) {
+                znew.push_back(d.grid(m));
+                for (size_t i = 0; i < comp; i++) {
+                    xnew.push_back(value(n, i, m));
+                }
+            } else {
+                nRemoved++;
+            }
+        }
+        dsize.push_back(znew.size() - nstart);
+    }
+
+    if (nRemoved == 0) {
+        return 0;
+    }
+
+    size_t gridstart = 0;
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t gridsize = dsize[n];
+        d.setupGrid(gridsize, &znew[gridstart]);
+        gridstart += gridsize;
+    }
+
+    m_x = xnew;
+    resize();
+    finalize();
+    return nRemoved;
+}
+
+std::vector<int> Sim1D::solveSweep(
+    const vector_fp& points,
+    const std::function<void(Sim1D&, double)>& apply, int loglevel,
+    size_t maxBisect)
+{
+    std::vector<int> status(points.size(), 0);
+    vector_fp lastGood;
+    std::vector<vector_fp> lastGrids;
+
+    auto snapshot = [&]() {
+        lastGood = m_x;
+        lastGrids.clear();
+        for (size_t n = 0; n < nDomains(); n++) {
+            lastGrids.push_back(domain(n).grid());
+        }
+    };
+    auto rollback = [&]() {
+        if (lastGood.empty()) {
+            return;
+        }
+        for (size_t n = 0; n < nDomains(); n++) {
+            domain(n).setupGrid(lastGrids[n].size(), lastGrids[n].data());
+        }
+        resize();
+        m_x = lastGood;
+        finalize();
+    };
+
+    double prev = points.empty() ? 0.0 : points[0];
+    for (size_t ip = 0; ip < points.size(); ip++) {
+        double target = points[ip];
+        double from = prev;
+        double value = target;
+        size_t nBisect = 0;
+        while (true) {
+            try {
+                apply(*this, value);
+                solve(loglevel, true);
+            } catch (CanteraError&) {
+                rollback();
+                if (nBisect++ >= maxBisect) {
+                    status[ip] = -1;
+                    break;
+                }
+                // retreat halfway toward the last converged parameter
+                value = 0.5 * (from + value);
+                continue;
+            }
+            snapshot();
+            if (value == target) {
+                status[ip] = 1;
+                prev = target;
+                break;
+            }
+            // intermediate point converged; push on toward the target
+            from = value;
+            value = target;
+        }
+    }
+    return status;
+}
+
+AnyMap Sim1D::solverStats()
+{
+    AnyMap stats;
+    std::vector<long int> tmp;
+    auto toAny = [&tmp](const vector_int& values) {
+        tmp.assign(values.begin(), values.end());
+        return tmp;
+    };
+    std::vector<long int> grids(gridSizeStats().begin(), gridSizeStats().end());
+    stats["grid_points"] = grids;
+    stats["jac_evals"] = toAny(jacobianCountStats());
+    stats["jac_time"] = jacobianTimeStats();
+    stats["eval_counts"] = toAny(evalCountStats());
+    stats["eval_time"] = evalTimeStats();
+    stats["time_steps"] = toAny(timeStepStats());
+    stats["time_step_fails"] = nTimeStepFails();
+    stats["newton_solves"] = newton().nSolveCalls();
+    stats["newton_backtracks"] = newton().nBacktracks();
+    stats["regrids"] = m_nRegrids;
+    return stats;
+}
+
 int Sim1D::refine(int loglevel)
 {
     int ianalyze, np = 0;
+    size_t nRemoved = 0;
     vector_fp znew, xnew;
     std::vector<size_t> dsize;
 
@@ -443,6 +748,7 @@ int Sim1D::refine(int loglevel)
                     }
                 }
             } else {
+                nRemoved++;
                 if (loglevel > 0) {
                     writelog("refine: discarding point at {}\n", d.grid(m));
                 }
@@ -451,6 +757,12 @@ int Sim1D::refine(int loglevel)
         dsize.push_back(znew.size() - nstart);
     }
 
+    if (np == 0 && nRemoved == 0) {
+        // the grid is unchanged; keep the domains, the solution vector and
+        // the Jacobian state instead of rebuilding them
+        return 0;
+    }
+
     // At this point, the new grid znew and the new solution vector xnew have
     // been constructed, but the domains themselves have not yet been modified.
     // Now update each domain with the new grid.
@@ -467,6 +779,7 @@ int Sim1D::refine(int loglevel)
     m_x = xnew;
     resize();
     finalize();
+    m_nRegrids++;
     return np;
 }
 
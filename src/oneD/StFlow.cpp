@@ -10,6 +10,7 @@
 #include "cantera/base/global.h"
 
 #include <set>
+#include <thread>
 
 using namespace std;
 
@@ -73,6 +74,8 @@ StFlow::StFlow(ThermoPhase* ph, size_t nsp, size_t points) :
     m_multidiff.resize(m_nsp*m_nsp*m_points);
     m_flux.resize(m_nsp,m_points);
     m_wdot.resize(m_nsp,m_points, 0.0);
+    m_hk_RT.resize(m_nsp, m_points, 0.0);
+    m_cpk_R.resize(m_nsp, m_points, 0.0);
     m_ybar.resize(m_nsp);
     m_qdotRadiation.resize(m_points, 0.0);
 
@@ -101,9 +104,12 @@ StFlow::StFlow(ThermoPhase* ph, size_t nsp, size_t points) :
     setupGrid(m_points, gr.data());
 
     // Find indices for radiating species
-    m_kRadiating.resize(2, npos);
-    m_kRadiating[0] = m_thermo->speciesIndex("CO2");
-    m_kRadiating[1] = m_thermo->speciesIndex("H2O");
+    // default radiating species with the RADCAL-based Planck-mean fits
+    // (polynomials in 1000 K / T, see the radiation term in evalResidual)
+    addRadiatingSpecies("CO2", {18.741, -121.310, 273.500, -194.050,
+                                56.310, -5.8169});
+    addRadiatingSpecies("H2O", {-0.23093, -1.12390, 9.41530, -2.99880,
+                                0.51382, -1.86840e-5});
 }
 
 StFlow::StFlow(std::shared_ptr<Solution> sol, size_t nsp, size_t points) :
@@ -144,6 +150,8 @@ void StFlow::resize(size_t ncomponents, size_t points)
     }
     m_flux.resize(m_nsp,m_points);
     m_wdot.resize(m_nsp,m_points, 0.0);
+    m_hk_RT.resize(m_nsp, m_points, 0.0);
+    m_cpk_R.resize(m_nsp, m_points, 0.0);
     m_do_energy.resize(m_points,false);
     m_qdotRadiation.resize(m_points, 0.0);
     m_fixedtemp.resize(m_points);
@@ -320,10 +328,22 @@ void StFlow::updateProperties(size_t jg, double* x, size_t jmin, size_t jmax)
     size_t j1 = std::min(jmax+1,m_points-1);
 
     updateThermo(x, j0, j1);
+    if (m_chem_threads > 1) {
+        updateChemistry(x, j0, j1);
+    } else {
+        m_wdot_ok = false;
+    }
     if (jg == npos || m_force_full_update) {
         // update transport properties only if a Jacobian is not being
-        // evaluated, or if specifically requested
-        updateTransport(x, j0, j1);
+        // evaluated, or if specifically requested; in the frozen-transport
+        // mode, also skip the update while the solution has not moved
+        // beyond the staleness tolerance
+        if (m_frozen_trans_rtol <= 0.0 || !transportCurrent(x)) {
+            updateTransport(x, j0, j1);
+            if (m_frozen_trans_rtol > 0.0) {
+                m_xlast_trans.assign(x, x + m_nv * m_points);
+            }
+        }
     }
     if (jg == npos) {
         double* Yleft = x + index(c_offset_Y, jmin);
@@ -337,6 +357,93 @@ void StFlow::updateProperties(size_t jg, double* x, size_t jmin, size_t jmax)
     updateDiffFluxes(x, j0, j1);
 }
 
+bool StFlow::transportCurrent(const double* x) const
+{
+    if (m_xlast_trans.size() != m_nv * m_points) {
+        return false;
+    }
+    for (size_t j = 0; j < m_points; j++) {
+        double Tlast = m_xlast_trans[index(c_offset_T, j)];
+        if (fabs(T(x, j) - Tlast) > m_frozen_trans_rtol * fabs(Tlast)) {
+            return false;
+        }
+        const double* y = x + index(c_offset_Y, j);
+        const double* ylast = m_xlast_trans.data() + index(c_offset_Y, j);
+        for (size_t k = 0; k < m_nsp; k++) {
+            if (fabs(y[k] - ylast[k]) > m_frozen_trans_rtol) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void StFlow::addRadiatingSpecies(const std::string& name,
+                                 const vector_fp& coeffs)
+{
+    size_t k = m_thermo->speciesIndex(name);
+    if (k == npos) {
+        // species not present in this mechanism; ignore, matching the
+        // previous behavior for missing CO2/H2O
+        return;
+    }
+    if (coeffs.empty()) {
+        throw CanteraError("StFlow::addRadiatingSpecies",
+                           "Coefficient array must not be empty.");
+    }
+    for (auto& rad : m_radCoeffs) {
+        if (rad.first == k) {
+            rad.second = coeffs;
+            return;
+        }
+    }
+    m_radCoeffs.emplace_back(k, coeffs);
+}
+
+void StFlow::updateChemistry(const double* x, size_t j0, size_t j1)
+{
+    size_t jlo = std::max<size_t>(j0, 1);
+    size_t jhi = std::min(j1, m_points - 2);
+    if (jhi < jlo) {
+        m_wdot_ok = false;
+        return;
+    }
+    size_t nt = std::min(m_chem_threads, jhi - jlo + 1);
+    if (m_chemKin.size() < nt) {
+        // each worker gets its own clone sharing the immutable mechanism
+        while (m_chemKin.size() < nt) {
+            auto th = m_thermo->clone();
+            m_chemKin.push_back(m_kin->clone({th}));
+            m_chemThermo.push_back(th);
+        }
+    }
+    size_t chunk = (jhi - jlo + 1 + nt - 1) / nt;
+    std::vector<std::thread> workers;
+    workers.reserve(nt);
+    for (size_t w = 0; w < nt; w++) {
+        size_t lo = jlo + w * chunk;
+        size_t hi = std::min(jhi, lo + chunk - 1);
+        if (lo > jhi) {
+            break;
+        }
+        workers.emplace_back([this, x, lo, hi, w]() {
+            ThermoPhase& gas = *m_chemThermo[w];
+            Kinetics& kin = *m_chemKin[w];
+            for (size_t j = lo; j <= hi; j++) {
+                gas.setTemperature(T(x, j));
+                gas.setMassFractions_NoNorm(x + m_nv * j + c_offset_Y);
+                gas.setPressure(m_press);
+                // columns of m_wdot are independent between workers
+                kin.getNetProductionRates(&m_wdot(0, j));
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    m_wdot_ok = true;
+}
+
 void StFlow::evalResidual(double* x, double* rsd, int* diag,
                           double rdt, size_t jmin, size_t jmax)
 {
@@ -365,44 +472,29 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
         // radiation calculation:
         doublereal k_P_ref = 1.0*OneAtm;
 
-        // polynomial coefficients:
-        const doublereal c_H2O[6] = {-0.23093, -1.12390, 9.41530, -2.99880,
-                                     0.51382, -1.86840e-5};
-        const doublereal c_CO2[6] = {18.741, -121.310, 273.500, -194.050,
-                                     56.310, -5.8169};
-
         // calculation of the two boundary values
         double boundary_Rad_left = m_epsilon_left * StefanBoltz * pow(T(x, 0), 4);
         double boundary_Rad_right = m_epsilon_right * StefanBoltz * pow(T(x, m_points - 1), 4);
 
         // loop over all grid points
         for (size_t j = jmin; j < jmax; j++) {
-            // helping variable for the calculation
-            double radiative_heat_loss = 0;
-
-            // calculation of the mean Planck absorption coefficient
+            // mean Planck absorption coefficient, summed over the radiating
+            // species; each fit is a polynomial in 1000/T evaluated by
+            // Horner's scheme (the previous per-term pow() calls dominated
+            // this loop)
+            double u = 1000 / T(x, j);
             double k_P = 0;
-            // absorption coefficient for H2O
-            if (m_kRadiating[1] != npos) {
-                double k_P_H2O = 0;
-                for (size_t n = 0; n <= 5; n++) {
-                    k_P_H2O += c_H2O[n] * pow(1000 / T(x, j), (double) n);
-                }
-                k_P_H2O /= k_P_ref;
-                k_P += m_press * X(x, m_kRadiating[1], j) * k_P_H2O;
-            }
-            // absorption coefficient for CO2
-            if (m_kRadiating[0] != npos) {
-                double k_P_CO2 = 0;
-                for (size_t n = 0; n <= 5; n++) {
-                    k_P_CO2 += c_CO2[n] * pow(1000 / T(x, j), (double) n);
+            for (const auto& rad : m_radCoeffs) {
+                const vector_fp& c = rad.second;
+                double kp = c.back();
+                for (size_t n = c.size() - 1; n-- > 0; ) {
+                    kp = kp * u + c[n];
                 }
-                k_P_CO2 /= k_P_ref;
-                k_P += m_press * X(x, m_kRadiating[0], j) * k_P_CO2;
+                k_P += m_press * X(x, rad.first, j) * kp / k_P_ref;
             }
 
             // calculation of the radiative heat loss term
-            radiative_heat_loss = 2 * k_P *(2 * StefanBoltz * pow(T(x, j), 4)
+            double radiative_heat_loss = 2 * k_P *(2 * StefanBoltz * pow(T(x, j), 4)
             - boundary_Rad_left - boundary_Rad_right);
 
             // set the radiative heat loss vector
@@ -476,7 +568,9 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
             //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
             //   = M_k\omega_k
             //-------------------------------------------------
-            getWdot(x,j);
+            if (!m_wdot_ok) {
+                getWdot(x,j);
+            }
             for (size_t k = 0; k < m_nsp; k++) {
                 double convec = rho_u(x,j)*dYdz(x,k,j);
                 double diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
@@ -497,17 +591,14 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
             //      - sum_k(J_k c_p_k / M_k) dT/dz
             //-----------------------------------------------
             if (m_do_energy[j]) {
-                setGas(x,j);
-
-                // heat release term
-                const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
-                const vector_fp& cp_R = m_thermo->cp_R_ref();
+                // heat release term, using the reference property arrays
+                // cached by updateThermo() for this point
                 double sum = 0.0;
                 double sum2 = 0.0;
                 for (size_t k = 0; k < m_nsp; k++) {
                     double flxk = 0.5*(m_flux(k,j-1) + m_flux(k,j));
-                    sum += wdot(k,j)*h_RT[k];
-                    sum2 += flxk*cp_R[k]/m_wt[k];
+                    sum += wdot(k,j)*m_hk_RT(k,j);
+                    sum2 += flxk*m_cpk_R(k,j)/m_wt[k];
                 }
                 sum *= GasConstant * T(x,j);
                 double dtdzj = dTdz(x,j);
@@ -55,9 +55,10 @@ int Refiner::analyze(size_t n, const doublereal* z,
         return 0;
     }
 
-    m_loc.clear();
+    m_loc.assign(n, 0);
+    m_nloc = 0;
     m_c.clear();
-    m_keep.clear();
+    m_keep.assign(n, 0);
 
     m_keep[0] = 1;
     m_keep[n-1] = 1;
@@ -70,9 +71,12 @@ int Refiner::analyze(size_t n, const doublereal* z,
     }
 
     // find locations where cell size ratio is too large.
-    vector_fp v(n), s(n-1);
-
-    vector_fp dz(n-1);
+    m_v.resize(n);
+    m_s.resize(n-1);
+    m_dz.resize(n-1);
+    vector_fp& v = m_v;
+    vector_fp& s = m_s;
+    vector_fp& dz = m_dz;
     for (size_t j = 0; j < n-1; j++) {
         dz[j] = z[j+1] - z[j];
     }
@@ -85,9 +89,10 @@ int Refiner::analyze(size_t n, const doublereal* z,
                 v[j] = value(x, i, j);
             }
 
-            // slope of component i
+            // slope of component i; one contiguous sweep over the values
+            // gathered above
             for (size_t j = 0; j < n-1; j++) {
-                s[j] = (value(x, i, j+1) - value(x, i, j))/(z[j+1] - z[j]);
+                s[j] = (v[j+1] - v[j]) / dz[j];
             }
 
             // find the range of values and slopes
@@ -199,7 +204,13 @@ int Refiner::analyze(size_t n, const doublereal* z,
         }
     }
 
-    return int(m_loc.size());
+    m_nloc = 0;
+    for (size_t j = 0; j < m_loc.size(); j++) {
+        if (m_loc[j]) {
+            m_nloc++;
+        }
+    }
+    return int(m_nloc);
 }
 
 double Refiner::value(const double* x, size_t i, size_t j)
@@ -209,13 +220,15 @@ double Refiner::value(const double* x, size_t i, size_t j)
 
 void Refiner::show()
 {
-    if (!m_loc.empty()) {
+    if (m_nloc) {
         writeline('#', 78);
         writelog(string("Refining grid in ") +
                  m_domain->id()+".\n"
                  +"    New points inserted after grid points ");
-        for (const auto& loc : m_loc) {
-            writelog("{} ", loc.first);
+        for (size_t j = 0; j < m_loc.size(); j++) {
+            if (m_loc[j]) {
+                writelog("{} ", j);
+            }
         }
         writelog("\n");
         writelog("    to resolve ");
@@ -232,12 +245,12 @@ void Refiner::show()
 int Refiner::getNewGrid(int n, const doublereal* z,
                         int nn, doublereal* zn)
 {
-    int nnew = static_cast<int>(m_loc.size());
+    int nnew = static_cast<int>(m_nloc);
     if (nnew + n > nn) {
         throw CanteraError("Refine::getNewGrid", "array size too small.");
     }
 
-    if (m_loc.empty()) {
+    if (m_nloc == 0) {
         copy(z, z + n, zn);
         return 0;
     }
@@ -246,7 +259,7 @@ int Refiner::getNewGrid(int n, const doublereal* z,
     for (int j = 0; j < n - 1; j++) {
         zn[jn] = z[j];
         jn++;
-        if (m_loc.count(j)) {
+        if (j < m_loc.size() && m_loc[j]) {
             zn[jn] = 0.5*(z[j] + z[j+1]);
             jn++;
         }
@@ -40,8 +40,10 @@ void BinarySolutionTabulatedThermo::_updateThermo() const
     bool x_changed = (m_xlast != xnow);
 
     if (x_changed) {
-        m_h0_tab = interpolate(xnow, m_enthalpy_tab);
-        m_s0_tab = interpolate(xnow, m_entropy_tab);
+        // one interval search serves both property tables
+        size_t cell = findInterval(xnow);
+        m_h0_tab = interpolateAt(xnow, cell, m_enthalpy_tab);
+        m_s0_tab = interpolateAt(xnow, cell, m_entropy_tab);
         if (xnow == 0) {
             m_s0_tab = -BigNumber;
         } else if (xnow == 1) {
@@ -165,24 +167,38 @@ void BinarySolutionTabulatedThermo::getParameters(AnyMap& phaseNode) const
     phaseNode["tabulated-thermo"] = std::move(tabThermo);
 }
 
-double BinarySolutionTabulatedThermo::interpolate(const double x,
-                                                  const vector_fp& inputData) const
+size_t BinarySolutionTabulatedThermo::findInterval(const double x) const
+{
+    // start from the interval of the previous query; state-of-charge
+    // sweeps move smoothly, so this nearly always hits without a search
+    size_t i = std::min(m_lastInterval, m_molefrac_tab.size() - 1);
+    if (i >= 1 && m_molefrac_tab[i-1] <= x && x <= m_molefrac_tab[i]) {
+        return i;
+    }
+    i = std::distance(m_molefrac_tab.begin(),
+            std::lower_bound(m_molefrac_tab.begin(), m_molefrac_tab.end(), x));
+    m_lastInterval = i;
+    return i;
+}
+
+double BinarySolutionTabulatedThermo::interpolateAt(
+    const double x, size_t i, const vector_fp& inputData) const
 {
-    double c;
     // Check if x is out of bound
     if (x > m_molefrac_tab.back()) {
-        c = inputData.back();
-        return c;
+        return inputData.back();
     }
     if (x < m_molefrac_tab.front()) {
-        c = inputData.front();
-        return c;
+        return inputData.front();
     }
-    size_t i = std::distance(m_molefrac_tab.begin(),
-            std::lower_bound(m_molefrac_tab.begin(), m_molefrac_tab.end(), x));
-    c = inputData[i-1] + (inputData[i] - inputData[i-1])
+    return inputData[i-1] + (inputData[i] - inputData[i-1])
             * (x - m_molefrac_tab[i-1]) / (m_molefrac_tab[i] - m_molefrac_tab[i-1]);
-    return c;
+}
+
+double BinarySolutionTabulatedThermo::interpolate(const double x,
+                                                  const vector_fp& inputData) const
+{
+    return interpolateAt(x, findInterval(x), inputData);
 }
 
 void BinarySolutionTabulatedThermo::diff(const vector_fp& inputData,
@@ -562,9 +562,19 @@ double DebyeHuckel::A_Debye_TP(double tempArg, double presArg) const
         A = m_A_Debye;
         break;
     case A_DEBYE_WATER:
-        A = m_waterProps->ADebye(T, P, 0);
+    {
+        // the water-based coefficient depends only on (T, P); cache it
+        // against them so molality-only updates skip the water equation
+        // of state
+        static const int cacheId = m_cache.getId();
+        CachedScalar cached = m_cache.getScalar(cacheId);
+        if (!cached.validate(T, P)) {
+            cached.value = m_waterProps->ADebye(T, P, 0);
+        }
+        A = cached.value;
         m_A_Debye = A;
         break;
+    }
     default:
         throw CanteraError("DebyeHuckel::A_Debye_TP", "shouldn't be here");
     }
@@ -749,6 +759,15 @@ double DebyeHuckel::_lnactivityWaterHelgesonFixedForm() const
 
 void DebyeHuckel::s_update_lnMolalityActCoeff() const
 {
+    // skip the full recomputation when the thermodynamic state is
+    // unchanged: coupled transport codes query activity data many times
+    // per cell update at one state
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
+
     double z_k, zs_k1, zs_k2;
 
     // Update the internally stored vector of molalities
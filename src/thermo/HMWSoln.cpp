@@ -1587,6 +1587,16 @@ void HMWSoln::calcMCCutoffParams_()
 
 void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 {
+    // The interaction coefficients depend on temperature only; skip the
+    // O(N^2) table update when neither the temperature nor the requested
+    // derivative level changed (for example, when only molalities vary
+    // between states of a composition sweep).
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), doDerivs)) {
+        return;
+    }
+
     double T = temperature();
     const double twoT = 2.0 * T;
     const double invT = 1.0 / T;
@@ -73,6 +73,37 @@ void IdealGasPhase::getChemPotentials(doublereal* mu) const
     }
 }
 
+void IdealGasPhase::getPartialMolarAll(double* hbar, double* sbar, double* cpbar,
+                                       double* mu) const
+{
+    // one updateThermo() behind the _ref accessors serves all properties;
+    // shared terms are evaluated once per state rather than per property
+    const vector_fp& _h = enthalpy_RT_ref();
+    const vector_fp& _s = entropy_R_ref();
+    double rt = RT();
+    double logp = log(pressure() / refPressure());
+    if (hbar) {
+        scale(_h.begin(), _h.end(), hbar, rt);
+    }
+    if (sbar || mu) {
+        for (size_t k = 0; k < m_kk; k++) {
+            double logxx = log(std::max(SmallNumber, moleFraction(k)));
+            double s_k = GasConstant * (_s[k] - logp - logxx);
+            if (sbar) {
+                sbar[k] = s_k;
+            }
+            if (mu) {
+                // mu_k = h_k - T * s_k
+                mu[k] = rt * _h[k] - temperature() * s_k;
+            }
+        }
+    }
+    if (cpbar) {
+        const vector_fp& _cp = cp_R_ref();
+        scale(_cp.begin(), _cp.end(), cpbar, GasConstant);
+    }
+}
+
 void IdealGasPhase::getPartialMolarEnthalpies(doublereal* hbar) const
 {
     const vector_fp& _h = enthalpy_RT_ref();
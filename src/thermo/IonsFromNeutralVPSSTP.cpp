@@ -254,6 +254,13 @@ void IonsFromNeutralVPSSTP::calcIonMoleFractions(doublereal* const mf) const
 
 void IonsFromNeutralVPSSTP::calcNeutralMoleculeMoleFractions() const
 {
+    // the ion-to-neutral mapping depends only on the ion composition
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(stateMFNumber())) {
+        return;
+    }
+
     size_t icat, jNeut;
     doublereal fmij;
     doublereal sum = 0.0;
@@ -637,6 +644,14 @@ bool IonsFromNeutralVPSSTP::addSpecies(shared_ptr<Species> spec)
 
 void IonsFromNeutralVPSSTP::s_update_lnActCoeff() const
 {
+    // the scaled coefficients depend on (T, P) and the ion composition;
+    // skip the neutral-phase call and the mapping when unchanged
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
+
     size_t icat, jNeut;
     // Get the activity coefficients of the neutral molecules
     neutralMoleculePhase_->getLnActivityCoefficients(lnActCoeff_NeutralMolecule_.data());
@@ -404,16 +404,33 @@ void LatticeSolidPhase::setLatticeStoichiometry(const compositionMap& comp)
 void LatticeSolidPhase::_updateThermo() const
 {
     doublereal tnow = temperature();
-    if (m_tlast != tnow) {
+    int stateNum = stateMFNumber();
+    if (m_tlast != tnow || stateNum != m_stateNumLast) {
         getMoleFractions(m_x.data());
+        bool fullPush = (m_xlast.size() != m_x.size());
         size_t strt = 0;
         for (size_t n = 0; n < m_lattice.size(); n++) {
-            m_lattice[n]->setTemperature(tnow);
-            m_lattice[n]->setMoleFractions(&m_x[strt]);
-            m_lattice[n]->setPressure(m_press);
-            strt += m_lattice[n]->nSpecies();
+            size_t nsp = m_lattice[n]->nSpecies();
+            // push state into a sublattice only when its own slice moved,
+            // so sweeps touching one lattice leave the others' internal
+            // updates cached
+            if (tnow != m_lattice[n]->temperature()) {
+                m_lattice[n]->setTemperature(tnow);
+            }
+            if (fullPush || !std::equal(m_x.begin() + strt,
+                                        m_x.begin() + strt + nsp,
+                                        m_xlast.begin() + strt))
+            {
+                m_lattice[n]->setMoleFractions(&m_x[strt]);
+            }
+            if (m_press != m_lattice[n]->pressure()) {
+                m_lattice[n]->setPressure(m_press);
+            }
+            strt += nsp;
         }
+        m_xlast = m_x;
         m_tlast = tnow;
+        m_stateNumLast = stateNum;
     }
 }
 
@@ -9,6 +9,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/thermo/MultiSpeciesThermo.h"
+#include "cantera/thermo/speciesThermoTypes.h"
 #include "cantera/thermo/SpeciesThermoFactory.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
@@ -19,7 +20,8 @@ namespace Cantera
 MultiSpeciesThermo::MultiSpeciesThermo() :
     m_tlow_max(0.0),
     m_thigh_min(1.0E30),
-    m_p0(OneAtm)
+    m_p0(OneAtm),
+    m_nasa2_ok(false)
 {
 }
 
@@ -44,6 +46,7 @@ void MultiSpeciesThermo::install_STIT(size_t index,
     m_tlow_max = std::max(stit_ptr->minTemp(), m_tlow_max);
     m_thigh_min = std::min(stit_ptr->maxTemp(), m_thigh_min);
     markInstalled(index);
+    m_nasa2_ok = false;
 }
 
 void MultiSpeciesThermo::modifySpecies(size_t index,
@@ -76,6 +79,7 @@ void MultiSpeciesThermo::modifySpecies(size_t index,
     }
 
     m_sp[type][m_speciesLoc[index].second] = {index, spthermo};
+    m_nasa2_ok = false;
 }
 
 void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
@@ -87,12 +91,77 @@ void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
     }
 }
 
+void MultiSpeciesThermo::updateNasa2Cache() const
+{
+    m_nasa2_index.clear();
+    m_nasa2_tmid.clear();
+    m_nasa2_coeffs.clear();
+    auto iter = m_sp.find(NASA2);
+    if (iter != m_sp.end()) {
+        const std::vector<index_STIT>& species = iter->second;
+        m_nasa2_index.reserve(species.size());
+        m_nasa2_tmid.reserve(species.size());
+        m_nasa2_coeffs.reserve(14 * species.size());
+        double coeffs[15];
+        for (const auto& sp : species) {
+            size_t n;
+            int type;
+            double tlow, thigh, pref;
+            sp.second->reportParameters(n, type, tlow, thigh, pref, coeffs);
+            m_nasa2_index.push_back(sp.first);
+            m_nasa2_tmid.push_back(coeffs[0]);
+            // low-temperature coefficients first, then high-temperature
+            m_nasa2_coeffs.insert(m_nasa2_coeffs.end(), coeffs + 8, coeffs + 15);
+            m_nasa2_coeffs.insert(m_nasa2_coeffs.end(), coeffs + 1, coeffs + 8);
+        }
+    }
+    m_nasa2_ok = true;
+}
+
 void MultiSpeciesThermo::update(doublereal t, doublereal* cp_R,
                                   doublereal* h_RT, doublereal* s_R) const
 {
+    if (!m_nasa2_ok) {
+        updateNasa2Cache();
+    }
+
+    // Batched evaluation of NASA two-range parameterizations from the
+    // contiguous coefficient cache, without virtual dispatch per species
+    size_t nn = m_nasa2_index.size();
+    if (nn) {
+        double tt1 = t;
+        double tt2 = t * t;
+        double tt3 = tt2 * t;
+        double tt4 = tt3 * t;
+        double rt = 1.0 / t;
+        double lnt = std::log(t);
+        for (size_t k = 0; k < nn; k++) {
+            // branchless range selection: the comparison becomes an index
+            // offset, so the sweep stays straight-line code even when the
+            // batch temperature straddles midpoint temperatures
+            const double* c = m_nasa2_coeffs.data() + 14 * k
+                              + 7 * static_cast<size_t>(t > m_nasa2_tmid[k]);
+            double ct0 = c[0];
+            double ct1 = c[1] * tt1;
+            double ct2 = c[2] * tt2;
+            double ct3 = c[3] * tt3;
+            double ct4 = c[4] * tt4;
+            size_t i = m_nasa2_index[k];
+            cp_R[i] = ct0 + ct1 + ct2 + ct3 + ct4;
+            h_RT[i] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4
+                + c[5] * rt;
+            s_R[i] = ct0*lnt + ct1 + 0.5*ct2 + 1.0/3.0*ct3
+                + 0.25*ct4 + c[6];
+        }
+    }
+
+    // generic path for all other parameterizations
     auto iter = m_sp.begin();
     auto jter = m_tpoly.begin();
     for (; iter != m_sp.end(); iter++, jter++) {
+        if (iter->first == NASA2) {
+            continue;
+        }
         const std::vector<index_STIT>& species = iter->second;
         double* tpoly = &jter->second[0];
         species[0].second->updateTemperaturePoly(t, tpoly);
@@ -194,6 +263,7 @@ void MultiSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298Ne
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
+        m_nasa2_ok = false;
     }
 }
 
@@ -202,6 +272,7 @@ void MultiSpeciesThermo::resetHf298(const size_t k)
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->resetHf298();
+        m_nasa2_ok = false;
     }
 }
 
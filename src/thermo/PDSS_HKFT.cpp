@@ -573,7 +573,52 @@ doublereal PDSS_HKFT::f(const doublereal temp, const doublereal pres, const int
     }
 }
 
+namespace {
+
+//! Cache of the most recent HKFT g-function evaluations. The g-function
+//! depends only on the water standard state and (T, P), so all PDSS_HKFT
+//! instances of a phase (which share one water standard state) reuse the
+//! values instead of redoing the water density solve per species. The cache
+//! is thread-local so concurrent phases do not interfere.
+struct HKFT_gCache {
+    const void* water = nullptr;
+    double temp = -1.0;
+    double pres = -1.0;
+    double dens = -1.0;
+    bool valid[4] = {false, false, false, false};
+    double value[4] = {0.0, 0.0, 0.0, 0.0};
+};
+thread_local HKFT_gCache s_gCache;
+
+} // anonymous namespace
+
 doublereal PDSS_HKFT::g(const doublereal temp, const doublereal pres, const int ifunc) const
+{
+    if (ifunc >= 0 && ifunc < 4) {
+        if (s_gCache.water == m_waterSS && s_gCache.temp == temp
+            && s_gCache.pres == pres)
+        {
+            if (s_gCache.valid[ifunc]) {
+                m_densWaterSS = s_gCache.dens;
+                return s_gCache.value[ifunc];
+            }
+        } else {
+            s_gCache.water = m_waterSS;
+            s_gCache.temp = temp;
+            s_gCache.pres = pres;
+            std::fill(std::begin(s_gCache.valid), std::end(s_gCache.valid), false);
+        }
+    }
+    double res = gCalc(temp, pres, ifunc);
+    if (ifunc >= 0 && ifunc < 4) {
+        s_gCache.dens = m_densWaterSS;
+        s_gCache.value[ifunc] = res;
+        s_gCache.valid[ifunc] = true;
+    }
+    return res;
+}
+
+doublereal PDSS_HKFT::gCalc(const doublereal temp, const doublereal pres, const int ifunc) const
 {
     doublereal afunc = ag(temp, 0);
     doublereal bfunc = bg(temp, 0);
@@ -23,6 +23,7 @@ PengRobinson::PengRobinson(const std::string& infile, const std::string& id_) :
     m_b(0.0),
     m_a(0.0),
     m_aAlpha_mix(0.0),
+    m_alphaTemp(-1.0),
     m_NSolns(0),
     m_dpdV(0.0),
     m_dpdT(0.0)
@@ -75,6 +76,10 @@ void PengRobinson::setSpeciesCoeffs(const std::string& species, double a, double
         }
     }
     m_b_coeffs[k] = b;
+
+    // force re-evaluation of the cached mixing coefficients
+    m_alphaTemp = -1.0;
+    m_cache.clear();
 }
 
 void PengRobinson::setBinaryCoeffs(const std::string& species_i,
@@ -97,6 +102,10 @@ void PengRobinson::setBinaryCoeffs(const std::string& species_i,
     // Calculate alpha_ij
     double alpha_ij = m_alpha[ki] * m_alpha[kj];
     m_aAlpha_binary(ki, kj) = m_aAlpha_binary(kj, ki) = a0*alpha_ij;
+
+    // force re-evaluation of the cached mixing coefficients
+    m_alphaTemp = -1.0;
+    m_cache.clear();
 }
 
 // ------------Molar Thermodynamic Properties -------------------------
@@ -644,20 +653,32 @@ void PengRobinson::calculatePressureDerivatives() const
 
 void PengRobinson::updateMixingExpressions()
 {
-    double temp = temperature();
-
-    // Update individual alpha
-    for (size_t j = 0; j < m_kk; j++) {
-        double critTemp_j = speciesCritTemperature(m_a_coeffs(j,j), m_b_coeffs[j]);
-        double sqt_alpha = 1 + m_kappa[j] * (1 - sqrt(temp / critTemp_j));
-        m_alpha[j] = sqt_alpha*sqt_alpha;
+    // mixing coefficients depend on temperature (through alpha) and
+    // composition only; skip the O(N^2) update when neither changed, as in a
+    // density solve at fixed state
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), stateMFNumber())) {
+        return;
     }
 
-    // Update aAlpha_i, j
-    for (size_t i = 0; i < m_kk; i++) {
+    double temp = temperature();
+
+    // Update individual alpha; only the alpha values depend on temperature
+    if (temp != m_alphaTemp) {
         for (size_t j = 0; j < m_kk; j++) {
-            m_aAlpha_binary(i, j) = sqrt(m_alpha[i] * m_alpha[j]) * m_a_coeffs(i,j);
+            double critTemp_j = speciesCritTemperature(m_a_coeffs(j,j), m_b_coeffs[j]);
+            double sqt_alpha = 1 + m_kappa[j] * (1 - sqrt(temp / critTemp_j));
+            m_alpha[j] = sqt_alpha*sqt_alpha;
+        }
+
+        // Update aAlpha_i, j
+        for (size_t i = 0; i < m_kk; i++) {
+            for (size_t j = 0; j < m_kk; j++) {
+                m_aAlpha_binary(i, j) = sqrt(m_alpha[i] * m_alpha[j]) * m_a_coeffs(i,j);
+            }
         }
+        m_alphaTemp = temp;
     }
     calculateAB(m_a,m_b,m_aAlpha_mix);
 }
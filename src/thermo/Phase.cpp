@@ -164,6 +164,59 @@ size_t Phase::speciesIndex(const std::string& nameStr) const
     return loc;
 }
 
+Phase::IndexedComposition Phase::compileComposition(
+    const std::string& comp) const
+{
+    return compileComposition(parseCompString(comp));
+}
+
+Phase::IndexedComposition Phase::compileComposition(
+    const compositionMap& comp) const
+{
+    IndexedComposition out;
+    out.indices.reserve(comp.size());
+    out.values.reserve(comp.size());
+    for (const auto& item : comp) {
+        size_t k = speciesIndex(item.first);
+        if (k == npos) {
+            throw CanteraError("Phase::compileComposition",
+                               "Unknown species '{}'", item.first);
+        }
+        out.indices.push_back(k);
+        out.values.push_back(item.second);
+    }
+    return out;
+}
+
+void Phase::setMoleFractions(const IndexedComposition& comp)
+{
+    m_setScratch.assign(m_kk, 0.0);
+    for (size_t i = 0; i < comp.indices.size(); i++) {
+        m_setScratch[comp.indices[i]] = comp.values[i];
+    }
+    setMoleFractions(m_setScratch.data());
+}
+
+void Phase::setMassFractions(const IndexedComposition& comp)
+{
+    m_setScratch.assign(m_kk, 0.0);
+    for (size_t i = 0; i < comp.indices.size(); i++) {
+        m_setScratch[comp.indices[i]] = comp.values[i];
+    }
+    setMassFractions(m_setScratch.data());
+}
+
+std::vector<size_t> Phase::speciesIndices(
+    const std::vector<std::string>& names) const
+{
+    std::vector<size_t> indices;
+    indices.reserve(names.size());
+    for (const auto& name : names) {
+        indices.push_back(speciesIndex(name));
+    }
+    return indices;
+}
+
 string Phase::speciesName(size_t k) const
 {
     checkSpeciesIndex(k);
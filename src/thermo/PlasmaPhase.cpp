@@ -65,18 +65,39 @@ void PlasmaPhase::setIsotropicElectronEnergyDistribution()
 {
     m_electronEnergyDist.resize(m_nPoints);
     double x = m_isotropicShapeFactor;
-    double gamma1 = boost::math::tgamma(3.0 / 2.0 * x);
-    double gamma2 = boost::math::tgamma(5.0 / 2.0 * x);
-    double c1 = x * std::pow(gamma2, 1.5) / std::pow(gamma1, 2.5);
-    double c2 = x * std::pow(gamma2 / gamma1, x);
+    if (x != m_shapeFactorCached) {
+        // the gamma-function coefficients depend only on the shape factor;
+        // cache them against it so per-step EEDF updates skip the special
+        // functions
+        double gamma1 = boost::math::tgamma(3.0 / 2.0 * x);
+        double gamma2 = boost::math::tgamma(5.0 / 2.0 * x);
+        m_isotropicC1 = x * std::pow(gamma2, 1.5) / std::pow(gamma1, 2.5);
+        m_isotropicC2 = x * std::pow(gamma2 / gamma1, x);
+        m_shapeFactorCached = x;
+    }
+    double meanEnergy = meanElectronEnergy();
     m_electronEnergyDist =
-        c1 * m_electronEnergyLevels.sqrt() /
-        std::pow(meanElectronEnergy(), 1.5) *
-        (-c2 * (m_electronEnergyLevels /
-        meanElectronEnergy()).pow(x)).exp();
+        m_isotropicC1 * m_electronEnergyLevels.sqrt() /
+        std::pow(meanEnergy, 1.5) *
+        (-m_isotropicC2 * (m_electronEnergyLevels / meanEnergy).pow(x)).exp();
     checkElectronEnergyDistribution();
 }
 
+void PlasmaPhase::integrateDistribution(size_t n, const double* integrands,
+                                        double* results) const
+{
+    // one sweep per integrand against the shared distribution; the
+    // element-wise product and the quadrature run as vectorized Eigen
+    // array expressions
+    for (size_t i = 0; i < n; i++) {
+        Eigen::Map<const Eigen::ArrayXd> f(integrands + i * m_nPoints,
+                                           m_nPoints);
+        results[i] = numericalQuadrature(
+            m_quadratureMethod, m_electronEnergyDist * f,
+            m_electronEnergyLevels);
+    }
+}
+
 void PlasmaPhase::setElectronTemperature(const double Te) {
     m_electronTemp = Te;
     updateElectronEnergyDistribution();
@@ -103,32 +103,62 @@ double PureFluidPhase::maxTemp(size_t k) const
 
 doublereal PureFluidPhase::enthalpy_mole() const
 {
-    return m_sub->h() * m_mw;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(temperature(), density())) {
+        cached.value = m_sub->h() * m_mw;
+    }
+    return cached.value;
 }
 
 doublereal PureFluidPhase::intEnergy_mole() const
 {
-    return m_sub->u() * m_mw;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(temperature(), density())) {
+        cached.value = m_sub->u() * m_mw;
+    }
+    return cached.value;
 }
 
 doublereal PureFluidPhase::entropy_mole() const
 {
-    return m_sub->s() * m_mw;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(temperature(), density())) {
+        cached.value = m_sub->s() * m_mw;
+    }
+    return cached.value;
 }
 
 doublereal PureFluidPhase::gibbs_mole() const
 {
-    return m_sub->g() * m_mw;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(temperature(), density())) {
+        cached.value = m_sub->g() * m_mw;
+    }
+    return cached.value;
 }
 
 doublereal PureFluidPhase::cp_mole() const
 {
-    return m_sub->cp() * m_mw;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(temperature(), density())) {
+        cached.value = m_sub->cp() * m_mw;
+    }
+    return cached.value;
 }
 
 doublereal PureFluidPhase::cv_mole() const
 {
-    return m_sub->cv() * m_mw;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(temperature(), density())) {
+        cached.value = m_sub->cv() * m_mw;
+    }
+    return cached.value;
 }
 
 doublereal PureFluidPhase::pressure() const
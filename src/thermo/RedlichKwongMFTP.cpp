@@ -74,6 +74,9 @@ void RedlichKwongMFTP::setSpeciesCoeffs(const std::string& species,
     }
     a_coeff_vec.getRow(0, a_vec_Curr_.data());
     b_vec_Curr_[k] = b;
+
+    // force re-evaluation of the cached mixing coefficients
+    m_cache.clear();
 }
 
 void RedlichKwongMFTP::setBinaryCoeffs(const std::string& species_i,
@@ -101,6 +104,9 @@ void RedlichKwongMFTP::setBinaryCoeffs(const std::string& species_i,
     a_coeff_vec(0, counter1) = a_coeff_vec(0, counter2) = a0;
     a_coeff_vec(1, counter1) = a_coeff_vec(1, counter2) = a1;
     a_vec_Curr_[counter1] = a_vec_Curr_[counter2] = a0;
+
+    // force re-evaluation of the cached mixing coefficients
+    m_cache.clear();
 }
 
 // ------------Molar Thermodynamic Properties -------------------------
@@ -724,6 +730,15 @@ void RedlichKwongMFTP::pressureDerivatives() const
 
 void RedlichKwongMFTP::updateMixingExpressions()
 {
+    // mixing coefficients depend on temperature and composition only; skip
+    // the O(N^2) update when neither changed, as in a density solve at a
+    // fixed state
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), stateMFNumber())) {
+        return;
+    }
+
     double temp = temperature();
     if (m_formTempParam == 1) {
         for (size_t i = 0; i < m_kk; i++) {
@@ -188,6 +188,7 @@ bool SurfPhase::addSpecies(shared_ptr<Species> spec)
 {
     bool added = ThermoPhase::addSpecies(spec);
     if (added) {
+        m_invSize.push_back(1.0 / spec->size);
         m_h0.push_back(0.0);
         m_s0.push_back(0.0);
         m_cp0.push_back(0.0);
@@ -218,14 +219,15 @@ void SurfPhase::setCoverages(const doublereal* theta)
 {
     double sum = 0.0;
     for (size_t k = 0; k < m_kk; k++) {
-        sum += theta[k] / size(k);
+        sum += theta[k] * m_invSize[k];
     }
     if (sum <= 0.0) {
         throw CanteraError("SurfPhase::setCoverages",
                            "Sum of Coverage fractions is zero or negative");
     }
+    double rsum = 1.0 / sum;
     for (size_t k = 0; k < m_kk; k++) {
-        m_work[k] = theta[k] / (sum * size(k));
+        m_work[k] = theta[k] * rsum * m_invSize[k];
     }
     setMoleFractions(m_work.data());
 }
@@ -235,15 +237,16 @@ void SurfPhase::setCoveragesNoNorm(const doublereal* theta)
     double sum = 0.0;
     double sum2 = 0.0;
     for (size_t k = 0; k < m_kk; k++) {
-        sum += theta[k] / size(k);
+        sum += theta[k] * m_invSize[k];
         sum2 += theta[k];
     }
     if (sum <= 0.0) {
         throw CanteraError("SurfPhase::setCoverages",
                            "Sum of Coverage fractions is zero or negative");
     }
+    double fac = sum2 / sum;
     for (size_t k = 0; k < m_kk; k++) {
-        m_work[k] = theta[k] * sum2 / (sum * size(k));
+        m_work[k] = theta[k] * fac * m_invSize[k];
     }
     setMoleFractions_NoNorm(m_work.data());
 }
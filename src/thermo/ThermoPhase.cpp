@@ -342,6 +342,11 @@ void ThermoPhase::setState_HPorUV(double Htarget, double p,
     // Make sure we are within the temperature bounds at the start
     // of the iteration
     double Tnew = temperature();
+    if (m_propertyPairSeed != Undef) {
+        // one-shot externally supplied starting guess
+        Tnew = m_propertyPairSeed;
+        m_propertyPairSeed = Undef;
+    }
     double Tinit = Tnew;
     if (Tnew > Tmax) {
         Tnew = Tmax - 1.0;
@@ -542,6 +547,11 @@ void ThermoPhase::setState_SPorSV(double Starget, double p,
     // Make sure we are within the temperature bounds at the start
     // of the iteration
     double Tnew = temperature();
+    if (m_propertyPairSeed != Undef) {
+        // one-shot externally supplied starting guess
+        Tnew = m_propertyPairSeed;
+        m_propertyPairSeed = Undef;
+    }
     double Tinit = Tnew;
     if (Tnew > Tmax) {
         Tnew = Tmax - 1.0;
@@ -1144,6 +1154,67 @@ void ThermoPhase::modifySpecies(size_t k, shared_ptr<Species> spec)
     m_spthermo.modifySpecies(k, spec->thermo);
 }
 
+void ThermoPhase::getPartialMolarAll(double* hbar, double* sbar, double* cpbar,
+                                     double* mu) const
+{
+    if (hbar) {
+        getPartialMolarEnthalpies(hbar);
+    }
+    if (sbar) {
+        getPartialMolarEntropies(sbar);
+    }
+    if (cpbar) {
+        getPartialMolarCp(cpbar);
+    }
+    if (mu) {
+        getChemPotentials(mu);
+    }
+}
+
+void ThermoPhase::evaluateStates(size_t nStates, const double* T,
+                                 const double* P, const double* Y, double* rho,
+                                 double* h, double* s, double* cp)
+{
+    size_t kk = nSpecies();
+    for (size_t n = 0; n < nStates; n++) {
+        setMassFractions_NoNorm(Y + n * kk);
+        setState_TP(T[n], P[n]);
+        if (rho) {
+            rho[n] = density();
+        }
+        if (h) {
+            h[n] = enthalpy_mass();
+        }
+        if (s) {
+            s[n] = entropy_mass();
+        }
+        if (cp) {
+            cp[n] = cp_mass();
+        }
+    }
+}
+
+AnyMap ThermoPhase::getCacheStats() const
+{
+    return m_cache.getStats();
+}
+
+shared_ptr<ThermoPhase> ThermoPhase::clone() const
+{
+    shared_ptr<ThermoPhase> phase(ThermoFactory::factory()->newThermoPhase(type()));
+    phase->setName(name());
+    phase->setParameters(parameters(false));
+    for (size_t k = 0; k < nSpecies(); k++) {
+        // Species objects are immutable and shared with the clone
+        phase->addSpecies(species(k));
+    }
+    phase->initThermo();
+    vector_fp state(stateSize());
+    saveState(state);
+    phase->restoreState(state);
+    return phase;
+}
+
 void ThermoPhase::setParameters(const AnyMap& phaseNode, const AnyMap& rootNode)
 {
     m_input = phaseNode;
@@ -1236,7 +1307,13 @@ void ThermoPhase::equilibrate(const std::string& XY, const std::string& solver,
         saveState(initial_state);
         debuglog("Trying ChemEquil solver\n", log_level);
         try {
-            ChemEquil E;
+            // the solver is reused across calls; its workspaces stay sized
+            // for this phase, making repeated ideal-gas HP/UV equilibrate
+            // calls allocation-free
+            if (!m_chemEquilSolver) {
+                m_chemEquilSolver = make_shared<ChemEquil>();
+            }
+            ChemEquil& E = *m_chemEquilSolver;
             E.options.maxIterations = max_steps;
             E.options.relTolerance = rtol;
             int ret = E.equilibrate(*this, XY.c_str(), log_level-1);
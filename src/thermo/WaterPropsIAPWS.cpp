@@ -90,6 +90,22 @@ doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
         return Rho_c;
     }
     doublereal deltaGuess = 0.0;
+
+    // Converged densities are shared process-wide between the several
+    // WaterPropsIAPWS instances a multiphase setup creates (WaterSSTP,
+    // PDSS_Water, WaterProps, WaterTransport all evaluate the same
+    // equation of state): a density converged by any instance at this
+    // (T, P, phase) seeds the iteration, which then terminates in a
+    // single step. Results remain those of the full solve.
+    static thread_local double s_lastT = -1.0, s_lastP = -1.0,
+        s_lastRho = -1.0;
+    static thread_local int s_lastPhase = -2;
+    if (rhoguess == -1.0 && temperature == s_lastT && pressure == s_lastP
+        && phase == s_lastPhase && s_lastRho > 0.0)
+    {
+        rhoguess = s_lastRho;
+    }
+
     if (rhoguess == -1.0) {
         if (phase != -1) {
             if (temperature > T_c) {
@@ -134,6 +150,12 @@ doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
         // Set the internal state -> this may be a duplication. However, let's
         // just be sure.
         setState_TR(temperature, density_retn);
+
+        // share the converged density with other instances
+        s_lastT = temperature;
+        s_lastP = pressure;
+        s_lastPhase = phase;
+        s_lastRho = density_retn;
     } else {
         density_retn = -1.0;
     }
@@ -362,11 +362,14 @@ WaterPropsIAPWSphi::WaterPropsIAPWSphi() :
     for (int i = 0; i < 16; i++) {
         DELTAp[i] = 1.0;
     }
+    std::fill(std::begin(m_phiR_valid), std::end(m_phiR_valid), false);
 }
 
 void WaterPropsIAPWSphi::tdpolycalc(doublereal tau, doublereal delta)
 {
-    if ((tau != TAUsave) || 1) {
+    bool changed = false;
+    if (tau != TAUsave) {
+        changed = true;
         TAUsave = tau;
         TAUsqrt = sqrt(tau);
         TAUp[0] = 1.0;
@@ -374,13 +377,18 @@ void WaterPropsIAPWSphi::tdpolycalc(doublereal tau, doublereal delta)
             TAUp[i] = TAUp[i-1] * tau;
         }
     }
-    if ((delta != DELTAsave) || 1) {
+    if (delta != DELTAsave) {
+        changed = true;
         DELTAsave = delta;
         DELTAp[0] = 1.0;
         for (int i = 1; i <= 15; i++) {
             DELTAp[i] = DELTAp[i-1] * delta;
         }
     }
+    if (changed) {
+        // residual sums memoized at the previous state are stale
+        std::fill(std::begin(m_phiR_valid), std::end(m_phiR_valid), false);
+    }
 }
 
 doublereal WaterPropsIAPWSphi::phi0() const
@@ -399,6 +407,9 @@ doublereal WaterPropsIAPWSphi::phi0() const
 
 doublereal WaterPropsIAPWSphi::phiR() const
 {
+    if (m_phiR_valid[0]) {
+        return m_phiR_cached[0];
+    }
     doublereal tau = TAUsave;
     doublereal delta = DELTAsave;
     int i, j;
@@ -440,6 +451,8 @@ doublereal WaterPropsIAPWSphi::phiR() const
         val += (ni[i] * triagtmp * delta * phi);
     }
 
+    m_phiR_cached[0] = val;
+    m_phiR_valid[0] = true;
     return val;
 }
 
@@ -453,6 +466,9 @@ doublereal WaterPropsIAPWSphi::phi(doublereal tau, doublereal delta)
 
 doublereal WaterPropsIAPWSphi::phiR_d() const
 {
+    if (m_phiR_valid[1]) {
+        return m_phiR_cached[1];
+    }
     doublereal tau = TAUsave;
     doublereal delta = DELTAsave;
     int i, j;
@@ -506,6 +522,8 @@ doublereal WaterPropsIAPWSphi::phiR_d() const
                                    dtriagtmpddelta * delta * phi);
         val += tmp;
     }
+    m_phiR_cached[1] = val;
+    m_phiR_valid[1] = true;
     return val;
 }
 
@@ -532,6 +550,9 @@ doublereal WaterPropsIAPWSphi::pressureM_rhoRT(doublereal tau, doublereal delta)
 
 doublereal WaterPropsIAPWSphi::phiR_dd() const
 {
+    if (m_phiR_valid[2]) {
+        return m_phiR_cached[2];
+    }
     doublereal tau = TAUsave;
     doublereal delta = DELTAsave;
     int i, j;
@@ -610,6 +631,8 @@ doublereal WaterPropsIAPWSphi::phiR_dd() const
                             d2triagtmpd2delta * delta * phi);
         val += ni[i] * ctmp;
     }
+    m_phiR_cached[2] = val;
+    m_phiR_valid[2] = true;
     return val;
 }
 
@@ -657,6 +680,9 @@ doublereal WaterPropsIAPWSphi::phi0_t() const
 
 doublereal WaterPropsIAPWSphi::phiR_t() const
 {
+    if (m_phiR_valid[3]) {
+        return m_phiR_cached[3];
+    }
     doublereal tau = TAUsave;
     doublereal delta = DELTAsave;
     int i, j;
@@ -702,6 +728,8 @@ doublereal WaterPropsIAPWSphi::phiR_t() const
         doublereal dphidtau = - 2.0 * Di[j] * ttmp * phi;
         val += ni[i] * delta * (dtriagtmpdtau * phi + triagtmp * dphidtau);
     }
+    m_phiR_cached[3] = val;
+    m_phiR_valid[3] = true;
     return val;
 }
 
@@ -728,6 +756,9 @@ doublereal WaterPropsIAPWSphi::phi0_tt() const
 
 doublereal WaterPropsIAPWSphi::phiR_tt() const
 {
+    if (m_phiR_valid[4]) {
+        return m_phiR_cached[4];
+    }
     doublereal tau = TAUsave;
     doublereal delta = DELTAsave;
     int i, j;
@@ -783,6 +814,8 @@ doublereal WaterPropsIAPWSphi::phiR_tt() const
         val += ni[i] * delta * tmp;
     }
 
+    m_phiR_cached[4] = val;
+    m_phiR_valid[4] = true;
     return val;
 }
 
@@ -801,6 +834,9 @@ doublereal WaterPropsIAPWSphi::phi0_dt() const
 
 doublereal WaterPropsIAPWSphi::phiR_dt() const
 {
+    if (m_phiR_valid[5]) {
+        return m_phiR_cached[5];
+    }
     doublereal tau = TAUsave;
     doublereal delta = DELTAsave;
     int i, j;
@@ -864,6 +900,8 @@ doublereal WaterPropsIAPWSphi::phiR_dt() const
                                   d2triagtmpddeltadtau * delta * phi);
         val += tmp;
     }
+    m_phiR_cached[5] = val;
+    m_phiR_valid[5] = true;
     return val;
 }
 
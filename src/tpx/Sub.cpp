@@ -290,6 +290,33 @@ double Substance::x()
     }
 }
 
+void Substance::buildSatTable()
+{
+    // sample the saturation curve from the minimum temperature to just
+    // below the critical point; entries must be strictly increasing in
+    // pressure to allow interval bisection
+    const int np = 100;
+    double Tsave = T;
+    double Tlo = Tmin();
+    double Thi = 0.995 * Tcrit();
+    try {
+        for (int i = 0; i < np; i++) {
+            T = Tlo + (Thi - Tlo) * i / (np - 1);
+            double logp = std::log(Ps());
+            if (m_satLogP.empty() || logp > m_satLogP.back()) {
+                m_satT.push_back(T);
+                m_satLogP.push_back(logp);
+            }
+        }
+    } catch (CanteraError&) {
+        // leave a marker so construction is not retried per call; Tsat()
+        // falls back to the plain iteration
+        m_satT.assign(1, Undef);
+        m_satLogP.assign(1, 0.0);
+    }
+    T = Tsave;
+}
+
 double Substance::Tsat(double p)
 {
     double Tsave = T;
@@ -306,6 +333,26 @@ double Substance::Tsat(double p)
     T = Tsave;
     Tsave = T;
 
+    // start the iteration from the tabulated saturation curve, which
+    // typically converges in one or two Newton steps; results remain those
+    // of the exact equation of state
+    if (m_satT.empty()) {
+        buildSatTable();
+    }
+    if (m_satT.size() > 1) {
+        double logp = std::log(p);
+        if (logp >= m_satLogP.front() && logp <= m_satLogP.back()) {
+            auto iter = std::lower_bound(m_satLogP.begin(), m_satLogP.end(),
+                                         logp);
+            size_t j = iter - m_satLogP.begin();
+            if (j > 0) {
+                double frac = (logp - m_satLogP[j-1])
+                              / (m_satLogP[j] - m_satLogP[j-1]);
+                T = m_satT[j-1] + frac * (m_satT[j] - m_satT[j-1]);
+            }
+        }
+    }
+
     int LoopCount = 0;
     double tol = 1.e-6*p;
     if (T < Tmin() || T > Tcrit()) {
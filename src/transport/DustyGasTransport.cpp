@@ -179,6 +179,13 @@ void DustyGasTransport::updateMultiDiffCoeffs()
 
     // update the mole fractions
     updateTransport_C();
+
+    // reuse the existing inverted H matrix when neither the temperature,
+    // the composition/pressure, nor the pore geometry changed since the
+    // last factorization
+    if (m_multidiff_ok) {
+        return;
+    }
     eval_H_matrix();
 
     // invert H
@@ -187,6 +194,7 @@ void DustyGasTransport::updateMultiDiffCoeffs()
         throw CanteraError("DustyGasTransport::updateMultiDiffCoeffs",
                            "invert returned ierr = {}", ierr);
     }
+    m_multidiff_ok = true;
 }
 
 void DustyGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
@@ -199,6 +207,20 @@ void DustyGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
     }
 }
 
+void DustyGasTransport::getMolarFluxes(size_t nPairs, const double* state1,
+                                       const double* state2,
+                                       const double* delta, double* fluxes)
+{
+    // Each state vector holds [T, rho, Y...]. With the factorization reuse
+    // above, pairs sharing a midpoint state are evaluated against a single
+    // inverted H matrix.
+    size_t ns = 2 + m_nsp;
+    for (size_t n = 0; n < nPairs; n++) {
+        getMolarFluxes(state1 + n * ns, state2 + n * ns, delta[n],
+                       fluxes + n * m_nsp);
+    }
+}
+
 void DustyGasTransport::updateTransport_T()
 {
     if (m_temp == m_thermo->temperature()) {
@@ -207,11 +229,30 @@ void DustyGasTransport::updateTransport_T()
     m_temp = m_thermo->temperature();
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_multidiff_ok = false;
 }
 
 void DustyGasTransport::updateTransport_C()
 {
-    m_thermo->getMoleFractions(m_x.data());
+    // the H matrix depends on composition and pressure; skip invalidation
+    // when the state is unchanged since the last update. The composition
+    // number alone is not sufficient, as re-setting identical mole
+    // fractions also advances it, so the values are compared as well.
+    int stateNum = m_thermo->stateMFNumber();
+    double p = m_thermo->pressure();
+    if (stateNum == m_stateNum && p == m_pres) {
+        return;
+    }
+    m_stateNum = stateNum;
+    m_xLast.resize(m_nsp);
+    m_thermo->getMoleFractions(m_xLast.data());
+    if (p == m_pres && m_xLast == m_xRaw) {
+        return;
+    }
+    m_pres = p;
+    m_xRaw = m_xLast;
+
+    copy(m_xRaw.begin(), m_xRaw.end(), m_x.begin());
 
     // add an offset to avoid a pure species condition
     // (check - this may be unnecessary)
@@ -220,6 +261,7 @@ void DustyGasTransport::updateTransport_C()
     }
     // diffusion coeffs depend on Pressure
     m_bulk_ok = false;
+    m_multidiff_ok = false;
 }
 
 void DustyGasTransport::setPorosity(doublereal porosity)
@@ -227,6 +269,7 @@ void DustyGasTransport::setPorosity(doublereal porosity)
     m_porosity = porosity;
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_multidiff_ok = false;
 }
 
 void DustyGasTransport::setTortuosity(doublereal tort)
@@ -234,22 +277,26 @@ void DustyGasTransport::setTortuosity(doublereal tort)
     m_tortuosity = tort;
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_multidiff_ok = false;
 }
 
 void DustyGasTransport::setMeanPoreRadius(doublereal rbar)
 {
     m_pore_radius = rbar;
     m_knudsen_ok = false;
+    m_multidiff_ok = false;
 }
 
 void DustyGasTransport::setMeanParticleDiameter(doublereal dbar)
 {
     m_diam = dbar;
+    m_multidiff_ok = false;
 }
 
 void DustyGasTransport::setPermeability(doublereal B)
 {
     m_perm = B;
+    m_multidiff_ok = false;
 }
 
 Transport& DustyGasTransport::gasTransport()
@@ -4,6 +4,8 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/transport/GasTransport.h"
+#include "cantera/base/profiling.h"
+#include "cantera/transport/TransportFactory.h"
 #include "MMCollisionInt.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/numerics/polyfit.h"
@@ -13,6 +15,8 @@
 #include "cantera/base/utilities.h"
 #include "cantera/base/global.h"
 
+#include <fstream>
+
 namespace Cantera
 {
 
@@ -47,7 +51,11 @@ void GasTransport::update_T()
         init(m_thermo, m_mode, m_log_level);
     }
 
-    double T = m_thermo->temperature();
+    updateTransportTemperature(m_thermo->temperature());
+}
+
+void GasTransport::updateTransportTemperature(double T)
+{
     if (T == m_temp) {
         return;
     }
@@ -100,20 +108,28 @@ doublereal GasTransport::viscosity()
 
 void GasTransport::updateViscosity_T()
 {
+    CT_PROFILE_SCOPE("GasTransport::updateViscosity_T");
     if (!m_spvisc_ok) {
         updateSpeciesViscosities();
     }
 
+    // reciprocals hoisted out of the O(K^2) combination loop
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_rsqvisc[k] = 1.0 / m_sqvisc[k];
+    }
+
     // see Eq. (9-5.15) of Reid, Prausnitz, and Poling
     for (size_t j = 0; j < m_nsp; j++) {
+        double rsqvisc_j = m_rsqvisc[j];
+        double visc_j = m_visc[j];
+        // the inner loop reads and writes column j contiguously and needs
+        // no square roots; m_wratjk(k,j) holds the square root of
+        // m_wratjk(j,k), and m_rwratkj1 folds in the 1/sqrt(8) constant
         for (size_t k = j; k < m_nsp; k++) {
-            double vratiokj = m_visc[k]/m_visc[j];
-            double wratiojk = m_mw[j]/m_mw[k];
-
-            // Note that m_wratjk(k,j) holds the square root of m_wratjk(j,k)!
-            double factor1 = 1.0 + (m_sqvisc[k]/m_sqvisc[j]) * m_wratjk(k,j);
-            m_phi(k,j) = factor1*factor1 / (sqrt(8.0) * m_wratkj1(j,k));
-            m_phi(j,k) = m_phi(k,j)/(vratiokj * wratiojk);
+            double factor1 = 1.0 + m_sqvisc[k] * rsqvisc_j * m_wratjk(k,j);
+            m_phi(k,j) = factor1 * factor1 * m_rwratkj1(k,j);
+            m_phi(j,k) = m_phi(k,j) * visc_j * m_rsqvisc[k] * m_rsqvisc[k]
+                         / (m_wratjk(j,k) * m_wratjk(j,k));
         }
     }
     m_viscwt_ok = true;
@@ -122,15 +138,19 @@ void GasTransport::updateViscosity_T()
 void GasTransport::updateSpeciesViscosities()
 {
     update_T();
+    if (m_viscPoly.empty() && !m_visccoeffs.empty()) {
+        m_viscPoly.setCoeffs(m_visccoeffs);
+    }
+    m_viscPoly.eval(m_polytempvec.data(), m_sqvisc.data());
     if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
-            m_visc[k] = exp(dot4(m_polytempvec, m_visccoeffs[k]));
+            m_visc[k] = exp(m_sqvisc[k]);
             m_sqvisc[k] = sqrt(m_visc[k]);
         }
     } else {
         for (size_t k = 0; k < m_nsp; k++) {
             // the polynomial fit is done for sqrt(visc/sqrt(T))
-            m_sqvisc[k] = m_t14 * dot5(m_polytempvec, m_visccoeffs[k]);
+            m_sqvisc[k] *= m_t14;
             m_visc[k] = (m_sqvisc[k] * m_sqvisc[k]);
         }
     }
@@ -139,30 +159,51 @@ void GasTransport::updateSpeciesViscosities()
 
 void GasTransport::updateDiff_T()
 {
+    CT_PROFILE_SCOPE("GasTransport::updateDiff_T");
     update_T();
-    // evaluate binary diffusion coefficients at unit pressure
-    size_t ic = 0;
+    size_t nd = m_diffcoeffs.size();
+    if (m_diffPoly.empty() && nd) {
+        // the evaluation runs as vectorized sweeps over the packed upper
+        // triangle of species pairs
+        m_diffPoly.setCoeffs(m_diffcoeffs);
+    }
+    m_bdiff_packed.resize(nd);
+
+    // evaluate binary diffusion coefficients at unit pressure for all pairs
     if (m_mode == CK_Mode) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
-        }
+        m_diffPoly.evalExp(m_polytempvec.data(), m_bdiff_packed.data());
     } else {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
+        m_diffPoly.eval(m_polytempvec.data(), m_bdiff_packed.data());
+        double tfac = m_temp * m_sqrt_t;
+        for (size_t ic = 0; ic < nd; ic++) {
+            m_bdiff_packed[ic] *= tfac;
+        }
+    }
+
+    // scatter the packed triangle into the symmetric dense matrix
+    size_t ic = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            m_bdiff(i,j) = m_bdiff_packed[ic];
+            m_bdiff(j,i) = m_bdiff_packed[ic];
+            ic++;
         }
     }
     m_bindiff_ok = true;
 }
 
+void GasTransport::getBinaryDiffCoeffsPacked(double* const d)
+{
+    update_T();
+    if (!m_bindiff_ok) {
+        updateDiff_T();
+    }
+    double rp = 1.0 / m_thermo->pressure();
+    for (size_t ic = 0; ic < m_bdiff_packed.size(); ic++) {
+        d[ic] = rp * m_bdiff_packed[ic];
+    }
+}
+
 void GasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
 {
     update_T();
@@ -181,6 +222,67 @@ void GasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
     }
 }
 
+void GasTransport::getMixDiffCoeffsAll(double* dMixAvg, double* dMole,
+                                       double* dMass)
+{
+    update_T();
+    update_C();
+    if (!m_bindiff_ok) {
+        updateDiff_T();
+    }
+
+    double mmw = m_thermo->meanMolecularWeight();
+    double p = m_thermo->pressure();
+    if (m_nsp == 1) {
+        double d0 = m_bdiff(0,0) / p;
+        if (dMixAvg) {
+            dMixAvg[0] = d0;
+        }
+        if (dMole) {
+            dMole[0] = d0;
+        }
+        if (dMass) {
+            dMass[0] = d0;
+        }
+        return;
+    }
+
+    // one traversal of the binary-diffusion matrix serves every requested
+    // weighting; the inner loop reads column k contiguously
+    for (size_t k = 0; k < m_nsp; k++) {
+        double sum1 = 0.0;
+        double sumw = 0.0;
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (j != k) {
+                double r = m_molefracs[j] / m_bdiff(j,k);
+                sum1 += r;
+                sumw += r * m_mw[j];
+            }
+        }
+        if (dMixAvg) {
+            if (sum1 <= 0.0) {
+                dMixAvg[k] = m_bdiff(k,k) / p;
+            } else {
+                dMixAvg[k] = (mmw - m_molefracs[k] * m_mw[k])
+                             / (p * mmw * sum1);
+            }
+        }
+        if (dMole) {
+            if (sum1 <= 0.0) {
+                dMole[k] = m_bdiff(k,k) / p;
+            } else {
+                dMole[k] = (1 - m_molefracs[k]) / (p * sum1);
+            }
+        }
+        if (dMass) {
+            double s1 = sum1 * p;
+            double s2 = sumw * p * m_molefracs[k]
+                        / (mmw - m_mw[k] * m_molefracs[k]);
+            dMass[k] = 1.0 / (s1 + s2);
+        }
+    }
+}
+
 void GasTransport::getMixDiffCoeffs(doublereal* const d)
 {
     update_T();
@@ -298,13 +400,18 @@ void GasTransport::init(ThermoPhase* thermo, int mode, int log_level)
 
     m_wratjk.resize(m_nsp, m_nsp, 0.0);
     m_wratkj1.resize(m_nsp, m_nsp, 0.0);
+    m_rwratkj1.resize(m_nsp, m_nsp, 0.0);
     for (size_t j = 0; j < m_nsp; j++) {
         for (size_t k = j; k < m_nsp; k++) {
             m_wratjk(j,k) = sqrt(m_mw[j]/m_mw[k]);
             m_wratjk(k,j) = sqrt(m_wratjk(j,k));
             m_wratkj1(j,k) = sqrt(1.0 + m_mw[k]/m_mw[j]);
+            // reciprocal including the constant of the Wilke combination
+            // rule, so the hot loop in updateViscosity_T() only multiplies
+            m_rwratkj1(k,j) = 1.0 / (sqrt(8.0) * m_wratkj1(j,k));
         }
     }
+    m_rsqvisc.resize(m_nsp);
 }
 
 void GasTransport::setupCollisionParameters()
@@ -368,6 +475,30 @@ void GasTransport::setupCollisionParameters()
     }
 }
 
+shared_ptr<Transport> GasTransport::clone(ThermoPhase* thermo) const
+{
+    ThermoPhase* phase = thermo ? thermo : m_thermo;
+    auto factory = TransportFactory::factory();
+    GasTransport* tr = dynamic_cast<GasTransport*>(
+        factory->create(factory->canonicalize(transportModel())));
+    if (!tr) {
+        throw CanteraError("GasTransport::clone",
+            "Unable to clone transport model '{}'.", transportModel());
+    }
+    shared_ptr<Transport> out(tr);
+    // initialize with this object as fit donor, so the property fits and
+    // collision-integral tables are copied instead of recomputed
+    tr->m_fitDonor = this;
+    try {
+        tr->init(phase, m_mode, m_log_level);
+    } catch (...) {
+        tr->m_fitDonor = nullptr;
+        throw;
+    }
+    tr->m_fitDonor = nullptr;
+    return out;
+}
+
 void GasTransport::setupCollisionIntegral()
 {
     double tstar_min = 1.e8, tstar_max = 0.0;
@@ -386,6 +517,24 @@ void GasTransport::setupCollisionIntegral()
         tstar_max = 99.9;
     }
 
+    if (m_fitDonor) {
+        // adopt the donor's fitted tables instead of re-running the
+        // collision-integral quadratures and property fits
+        m_poly = m_fitDonor->m_poly;
+        m_omega22_poly = m_fitDonor->m_omega22_poly;
+        m_astar_poly = m_fitDonor->m_astar_poly;
+        m_bstar_poly = m_fitDonor->m_bstar_poly;
+        m_cstar_poly = m_fitDonor->m_cstar_poly;
+        m_star_poly_uses_actualT = m_fitDonor->m_star_poly_uses_actualT;
+        m_visccoeffs = m_fitDonor->m_visccoeffs;
+        m_condcoeffs = m_fitDonor->m_condcoeffs;
+        m_diffcoeffs = m_fitDonor->m_diffcoeffs;
+        m_viscPoly.clear();
+        m_condPoly.clear();
+        m_diffPoly.clear();
+        return;
+    }
+
     // initialize the collision integral calculator for the desired T* range
     debuglog("*** collision_integrals ***\n", m_log_level);
     MMCollisionInt integrals;
@@ -394,10 +543,139 @@ void GasTransport::setupCollisionIntegral()
     debuglog("*** end of collision_integrals ***\n", m_log_level);
     // make polynomial fits
     debuglog("*** property fits ***\n", m_log_level);
-    fitProperties(integrals);
+    std::string cacheFile = fitCachePath();
+    if (cacheFile != "" && loadFits(cacheFile)) {
+        debuglog("*** property fits loaded from cache ***\n", m_log_level);
+    } else {
+        fitProperties(integrals);
+        if (cacheFile != "") {
+            saveFits(cacheFile);
+        }
+    }
     debuglog("*** end of property fits ***\n", m_log_level);
 }
 
+namespace {
+
+//! Format version of the transport fit cache files
+const int FitCacheVersion = 1;
+
+//! Deterministic FNV-1a hash accumulation over raw bytes
+void fitCacheHash(size_t& h, const void* data, size_t nBytes)
+{
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < nBytes; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+}
+
+void writeFitArray(std::ostream& out, const std::vector<vector_fp>& coeffs)
+{
+    uint64_t n = coeffs.size();
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    for (const auto& c : coeffs) {
+        uint64_t m = c.size();
+        out.write(reinterpret_cast<const char*>(&m), sizeof(m));
+        out.write(reinterpret_cast<const char*>(c.data()),
+                  m * sizeof(double));
+    }
+}
+
+bool readFitArray(std::istream& in, std::vector<vector_fp>& coeffs)
+{
+    uint64_t n;
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    coeffs.resize(n);
+    for (auto& c : coeffs) {
+        uint64_t m;
+        in.read(reinterpret_cast<char*>(&m), sizeof(m));
+        if (!in || m > 1000) {
+            return false;
+        }
+        c.resize(m);
+        in.read(reinterpret_cast<char*>(c.data()), m * sizeof(double));
+    }
+    return bool(in);
+}
+
+} // anonymous namespace
+
+std::string GasTransport::fitCachePath() const
+{
+    const char* dir = getenv("CANTERA_TRANSPORT_CACHE");
+    if (!dir) {
+        return "";
+    }
+    // Hash everything the property fits depend on: the collision parameters,
+    // the temperature range, the fit mode and the species identities.
+    size_t h = 14695981039346656037ULL;
+    // the fitted arrays differ between transport models (for example,
+    // IonGasTransport extends the diffusion fits), so the model name is
+    // part of the key
+    std::string model = transportModel();
+    fitCacheHash(h, model.data(), model.size());
+    fitCacheHash(h, &m_mode, sizeof(m_mode));
+    double tlims[] = {m_thermo->minTemp(), m_thermo->maxTemp()};
+    fitCacheHash(h, tlims, sizeof(tlims));
+    for (size_t k = 0; k < m_nsp; k++) {
+        const std::string& name = m_thermo->speciesName(k);
+        fitCacheHash(h, name.data(), name.size());
+    }
+    for (const vector_fp* v : {&m_epsilon.data(), &m_diam.data(),
+                               &m_dipole.data(), &m_reducedMass.data(),
+                               &m_crot, &m_zrot, &m_sigma, &m_eps, &m_alpha,
+                               &m_w_ac}) {
+        fitCacheHash(h, v->data(), v->size() * sizeof(double));
+    }
+    return fmt::format("{}/ct{}_{:x}.ctfit", dir, FitCacheVersion, h);
+}
+
+bool GasTransport::loadFits(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    int version;
+    uint64_t nsp;
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&nsp), sizeof(nsp));
+    if (!in || version != FitCacheVersion || nsp != m_nsp) {
+        return false;
+    }
+    std::vector<vector_fp> visc, cond, diff;
+    if (!readFitArray(in, visc) || !readFitArray(in, cond)
+        || !readFitArray(in, diff))
+    {
+        return false;
+    }
+    m_visccoeffs = std::move(visc);
+    m_viscPoly.clear();
+    m_condcoeffs = std::move(cond);
+    m_condPoly.clear();
+    m_diffcoeffs = std::move(diff);
+    m_diffPoly.clear();
+    return true;
+}
+
+void GasTransport::saveFits(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        // an unwritable cache directory is not an error; the fits were
+        // computed and can be used directly
+        return;
+    }
+    out.write(reinterpret_cast<const char*>(&FitCacheVersion),
+              sizeof(FitCacheVersion));
+    uint64_t nsp = m_nsp;
+    out.write(reinterpret_cast<const char*>(&nsp), sizeof(nsp));
+    writeFitArray(out, m_visccoeffs);
+    writeFitArray(out, m_condcoeffs);
+    writeFitArray(out, m_diffcoeffs);
+}
+
 void GasTransport::getTransportData()
 {
     for (size_t k = 0; k < m_thermo->nSpecies(); k++) {
@@ -522,6 +800,8 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
 
     m_visccoeffs.clear();
     m_condcoeffs.clear();
+    m_viscPoly.clear();
+    m_condPoly.clear();
 
     // generate array of log(t) values
     for (size_t n = 0; n < np; n++) {
@@ -531,6 +811,7 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
 
     // vector of polynomial coefficients
     vector_fp c(degree + 1), c2(degree + 1);
+    std::unique_ptr<PolyFitter> ckFitter;
 
     // fit the pure-species viscosity and thermal conductivity for each species
     if (m_log_level && m_log_level < 2) {
@@ -614,8 +895,18 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
                 w2[n] = 1.0/(spcond[n]*spcond[n]);
             }
         }
-        polyfit(np, degree, tlog.data(), spvisc.data(), w.data(), c.data());
-        polyfit(np, degree, tlog.data(), spcond.data(), w2.data(), c2.data());
+        if (m_mode == CK_Mode) {
+            // CK-mode fits are unweighted over shared nodes; the design
+            // matrix factorization is shared across all species and pairs
+            if (!ckFitter) {
+                ckFitter.reset(new PolyFitter(np, degree, tlog.data()));
+            }
+            ckFitter->fit(spvisc.data(), c.data());
+            ckFitter->fit(spcond.data(), c2.data());
+        } else {
+            polyfit(np, degree, tlog.data(), spvisc.data(), w.data(), c.data());
+            polyfit(np, degree, tlog.data(), spcond.data(), w2.data(), c2.data());
+        }
 
         // evaluate max fit errors for viscosity
         for (size_t n = 0; n < np; n++) {
@@ -707,11 +998,13 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
 
     // vector of polynomial coefficients
     vector_fp c(degree + 1), c2(degree + 1);
+    std::unique_ptr<PolyFitter> ckDiffFitter;
     double err, relerr,
                mxerr = 0.0, mxrelerr = 0.0;
 
     vector_fp diff(np + 1);
     m_diffcoeffs.clear();
+    m_diffPoly.clear();
     for (size_t k = 0; k < m_nsp; k++) {
         for (size_t j = k; j < m_nsp; j++) {
             for (size_t n = 0; n < np; n++) {
@@ -736,7 +1029,14 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
                     w[n] = 1.0/(diff[n]*diff[n]);
                 }
             }
-            polyfit(np, degree, tlog.data(), diff.data(), w.data(), c.data());
+            if (m_mode == CK_Mode) {
+                if (!ckDiffFitter) {
+                    ckDiffFitter.reset(new PolyFitter(np, degree, tlog.data()));
+                }
+                ckDiffFitter->fit(diff.data(), c.data());
+            } else {
+                polyfit(np, degree, tlog.data(), diff.data(), w.data(), c.data());
+            }
 
             for (size_t n = 0; n < np; n++) {
                 double val, fit;
@@ -867,6 +1167,7 @@ void GasTransport::setViscosityPolynomial(size_t i, double* coeffs)
     for (int k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
         m_visccoeffs[i][k] = coeffs[k];
     }
+    m_viscPoly.clear();
 
     m_visc_ok = false;
     m_spvisc_ok = false;
@@ -880,6 +1181,7 @@ void GasTransport::setConductivityPolynomial(size_t i, double* coeffs)
     for (int k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
         m_condcoeffs[i][k] = coeffs[k];
     }
+    m_condPoly.clear();
 
     m_visc_ok = false;
     m_spvisc_ok = false;
@@ -902,6 +1204,8 @@ void GasTransport::setBinDiffusivityPolynomial(size_t i, size_t j, double* coeff
         m_diffcoeffs[ic][k] = coeffs[k];
     }
 
+    m_diffPoly.clear();
+
     m_visc_ok = false;
     m_spvisc_ok = false;
     m_viscwt_ok = false;
@@ -391,48 +391,59 @@ doublereal HighPressureGasTransport::viscosity()
 }
 
 // Pure species critical properties - Tc, Pc, Vc, Zc:
-doublereal HighPressureGasTransport::Tcrit_i(size_t i)
+void HighPressureGasTransport::cacheCriticalProperties()
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double tc = m_thermo->critTemperature();
+    // Derive the pure-species critical properties once: the derivation
+    // temporarily installs each pure species' composition, so doing it per
+    // property call both cost time and round-tripped the phase state on
+    // every evaluation. The composition is saved and restored once for the
+    // whole sweep.
+    size_t nsp = m_thermo->nSpecies();
+    if (m_Tcrit.size() == nsp) {
+        return;
+    }
+    m_Tcrit.resize(nsp);
+    m_Pcrit.resize(nsp);
+    m_Vcrit.resize(nsp);
+    m_Zcrit.resize(nsp);
+    vector_fp molefracs(nsp);
+    m_thermo->getMoleFractions(molefracs.data());
+    vector_fp mf_temp(nsp, 0.0);
+    for (size_t i = 0; i < nsp; i++) {
+        mf_temp[i] = 1.0;
+        m_thermo->setMoleFractions(mf_temp.data());
+        m_Tcrit[i] = m_thermo->critTemperature();
+        m_Pcrit[i] = m_thermo->critPressure();
+        m_Vcrit[i] = m_thermo->critVolume();
+        m_Zcrit[i] = m_thermo->critCompressibility();
+        mf_temp[i] = 0.0;
+    }
     // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return tc;
+    m_thermo->setMoleFractions(molefracs.data());
 }
 
-doublereal HighPressureGasTransport::Pcrit_i(size_t i)
+doublereal HighPressureGasTransport::Tcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
+    cacheCriticalProperties();
+    return m_Tcrit[i];
+}
 
-    double pc = m_thermo->critPressure();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return pc;
+doublereal HighPressureGasTransport::Pcrit_i(size_t i)
+{
+    cacheCriticalProperties();
+    return m_Pcrit[i];
 }
 
 doublereal HighPressureGasTransport::Vcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double vc = m_thermo->critVolume();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return vc;
+    cacheCriticalProperties();
+    return m_Vcrit[i];
 }
 
 doublereal HighPressureGasTransport::Zcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double zc = m_thermo->critCompressibility();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return zc;
+    cacheCriticalProperties();
+    return m_Zcrit[i];
 }
 
 vector_fp HighPressureGasTransport::store(size_t i, size_t nsp)
@@ -142,7 +142,7 @@ double IonGasTransport::thermalConductivity()
 
 double IonGasTransport::electricalConductivity()
 {
-    vector_fp mobi(m_nsp);
+    vector_fp& mobi = m_spwork;
     getMobilities(&mobi[0]);
     double p = m_thermo->pressure();
     double sum = 0.0;
@@ -393,21 +393,34 @@ void IonGasTransport::getMobilities(double* const mobi)
         updateDiff_T();
     }
     double p = m_thermo->pressure();
-    for (size_t k = 0; k < m_nsp; k++) {
-        if (k == m_kElectron) {
-            mobi[k] = 0.4;
-        } else {
-            mobi[k] = 0.0;
+    int stateNum = m_thermo->stateMFNumber();
+    if (!m_mobi_ok || m_temp != m_mobiTemp || p != m_mobiPres
+        || stateNum != m_mobiStateNum)
+    {
+        m_mobi.resize(m_nsp);
+        for (size_t k = 0; k < m_nsp; k++) {
+            if (k == m_kElectron) {
+                m_mobi[k] = 0.4;
+            } else {
+                m_mobi[k] = 0.0;
+            }
         }
-    }
-    for (size_t k : m_kIon) {
-        double sum = 0.0;
-        for (size_t j : m_kNeutral) {
-            double bmobi = m_bdiff(k,j) * ElectronCharge / m_kbt;
-            sum += m_molefracs[j] / bmobi;
+        double kbt_qe = m_kbt / ElectronCharge;
+        for (size_t k : m_kIon) {
+            double sum = 0.0;
+            // one contiguous pass over the neutral colliders; the division
+            // by the binary mobility is folded into a single multiplication
+            for (size_t j : m_kNeutral) {
+                sum += m_molefracs[j] * kbt_qe / m_bdiff(k,j);
+            }
+            m_mobi[k] = 1.0 / sum / p;
         }
-        mobi[k] = 1.0 / sum / p;
+        m_mobi_ok = true;
+        m_mobiTemp = m_temp;
+        m_mobiPres = p;
+        m_mobiStateNum = stateNum;
     }
+    copy(m_mobi.begin(), m_mobi.end(), mobi);
 }
 
 }
@@ -8,6 +8,8 @@
 #include "MMCollisionInt.h"
 #include "cantera/base/utilities.h"
 #include "cantera/numerics/polyfit.h"
+
+#include <mutex>
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/global.h"
 
@@ -239,6 +241,26 @@ void MMCollisionInt::init(doublereal tsmin, doublereal tsmax, int log_level)
         writelogf("T*_max = %g\n", tstar[m_nmax + 1]);
     }
     m_logTemp.resize(37);
+    for (int i = 0; i < 37; i++) {
+        m_logTemp[i] = log(tstar[i+1]);
+    }
+
+    // The delta* interpolation fits depend only on the static Monchick and
+    // Mason tables, so they are computed once per process and shared by all
+    // MMCollisionInt instances thereafter.
+    static std::mutex fitMutex;
+    static std::vector<vector_fp> s_o22poly, s_apoly, s_bpoly, s_cpoly;
+    std::unique_lock<std::mutex> lock(fitMutex);
+    if (!s_o22poly.empty()) {
+        m_o22poly = s_o22poly;
+        m_apoly = s_apoly;
+        m_bpoly = s_bpoly;
+        m_cpoly = s_cpoly;
+        debuglog("collision integral fits reused from process-wide cache\n",
+                 m_loglevel > 0);
+        return;
+    }
+
     doublereal e22 = 0.0, ea = 0.0, eb = 0.0, ec = 0.0;
 
     if (m_loglevel > 0) {
@@ -252,7 +274,6 @@ void MMCollisionInt::init(doublereal tsmin, doublereal tsmax, int log_level)
     }
 
     for (int i = 0; i < 37; i++) {
-        m_logTemp[i] = log(tstar[i+1]);
         vector_fp c(DeltaDegree+1);
 
         double rmserr = fitDelta(0, i, DeltaDegree, c.data());
@@ -292,6 +313,11 @@ void MMCollisionInt::init(doublereal tsmin, doublereal tsmax, int log_level)
                       "      C*       =     %12.6g \n", e22, ea, eb, ec);
         }
     }
+
+    s_o22poly = m_o22poly;
+    s_apoly = m_apoly;
+    s_bpoly = m_bpoly;
+    s_cpoly = m_cpoly;
 }
 
 doublereal MMCollisionInt::fitDelta(int table, int ntstar, int degree, doublereal* c)
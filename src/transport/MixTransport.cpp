@@ -103,6 +103,14 @@ void MixTransport::update_T()
     m_spcond_ok = false;
     m_bindiff_ok = false;
     m_condmix_ok = false;
+
+    if (m_fused_updates) {
+        // evaluate the species viscosity and conductivity fits together
+        // while the shared powers of log(T) are hot in cache; callers like
+        // the flame solvers always consume both
+        updateSpeciesViscosities();
+        updateCond_T();
+    }
 }
 
 void MixTransport::update_C()
@@ -121,13 +129,15 @@ void MixTransport::update_C()
 
 void MixTransport::updateCond_T()
 {
+    if (m_condPoly.empty() && !m_condcoeffs.empty()) {
+        m_condPoly.setCoeffs(m_condcoeffs);
+    }
     if (m_mode == CK_Mode) {
-        for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = exp(dot4(m_polytempvec, m_condcoeffs[k]));
-        }
+        m_condPoly.evalExp(m_polytempvec.data(), m_cond.data());
     } else {
+        m_condPoly.eval(m_polytempvec.data(), m_cond.data());
         for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = m_sqrt_t * dot5(m_polytempvec, m_condcoeffs[k]);
+            m_cond[k] *= m_sqrt_t;
         }
     }
     m_spcond_ok = true;
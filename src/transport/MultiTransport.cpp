@@ -36,6 +36,7 @@ doublereal Frot(doublereal tr, doublereal sqtr)
 
 MultiTransport::MultiTransport(ThermoPhase* thermo)
     : GasTransport(thermo)
+    , m_useSparseL(false)
 {
 }
 
@@ -160,8 +161,35 @@ void MultiTransport::solveLMatrixEquation()
 
     // Solve it using GMRES or LU decomposition. The last solution in m_a should
     // provide a good starting guess, so convergence should be fast.
-    m_a = m_b;
-    solve(m_Lmatrix, m_a.data());
+    if (m_useSparseL) {
+        size_t n = 3 * m_nsp;
+        Eigen::Map<const Eigen::MatrixXd> L(m_Lmatrix.ptrColumn(0), n, n);
+        m_Lsparse = L.sparseView();
+
+        // reuse the symbolic factorization while the pattern is unchanged
+        std::vector<int> pattern(m_Lsparse.outerIndexPtr(),
+                                 m_Lsparse.outerIndexPtr() + n + 1);
+        pattern.insert(pattern.end(), m_Lsparse.innerIndexPtr(),
+                       m_Lsparse.innerIndexPtr() + m_Lsparse.nonZeros());
+        if (pattern != m_sparsePattern) {
+            m_sparseLU.analyzePattern(m_Lsparse);
+            m_sparsePattern = std::move(pattern);
+        }
+        m_sparseLU.factorize(m_Lsparse);
+        if (m_sparseLU.info() == Eigen::Success) {
+            Eigen::Map<Eigen::VectorXd> a(m_a.data(), n);
+            Eigen::Map<const Eigen::VectorXd> b(m_b.data(), n);
+            a = m_sparseLU.solve(b);
+        } else {
+            // singular or otherwise failed factorization: fall back to the
+            // dense path, which shares its pivoting diagnostics
+            m_a = m_b;
+            solve(m_Lmatrix, m_a.data());
+        }
+    } else {
+        m_a = m_b;
+        solve(m_Lmatrix, m_a.data());
+    }
     m_lmatrix_soln_ok = true;
     m_molefracs_last = m_molefracs;
     // L matrix is overwritten with LU decomposition
@@ -7,6 +7,7 @@
 #include "cantera/transport/MultiTransport.h"
 #include "cantera/transport/MixTransport.h"
 #include "cantera/transport/UnityLewisTransport.h"
+#include "cantera/transport/TabulatedMixTransport.h"
 #include "cantera/transport/IonGasTransport.h"
 #include "cantera/transport/WaterTransport.h"
 #include "cantera/transport/DustyGasTransport.h"
@@ -38,6 +39,7 @@ TransportFactory::TransportFactory()
     addAlias("mixture-averaged", "Mix");
     reg("mixture-averaged-CK", []() { return new MixTransport(); });
     addAlias("mixture-averaged-CK", "CK_Mix");
+    reg("tabulated-mixture", []() { return new TabulatedMixTransport(); });
     reg("multicomponent", []() { return new MultiTransport(); });
     addAlias("multicomponent", "Multi");
     reg("multicomponent-CK", []() { return new MultiTransport(); });
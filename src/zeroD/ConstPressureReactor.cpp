@@ -78,7 +78,7 @@ void ConstPressureReactor::eval(double time, double* LHS, double* RHS)
     dmdt += mdot_surf;
 
     if (m_chem) {
-        m_kin->getNetProductionRates(&m_wdot[0]); // "omega dot"
+        updateProductionRates();
     }
 
     for (size_t k = 0; k < m_nsp; k++) {
@@ -54,6 +54,9 @@ void FlowDevice::setPressureFunction(Func1* f)
 void FlowDevice::setTimeFunction(Func1* g)
 {
     m_tfunc = g;
+    // flatten the expression tree so the RHS evaluations below run a
+    // linear tape instead of a recursive virtual tree walk
+    m_ttape.compile(*g);
 }
 
 double FlowDevice::outletSpeciesMassFlowRate(size_t k)
@@ -77,7 +77,7 @@ void IdealGasConstPressureMoleReactor::eval(double time, double* LHS, double* RH
     const vector_fp& imw = m_thermo->inverseMolecularWeights();
 
     if (m_chem) {
-        m_kin->getNetProductionRates(&m_wdot[0]); // "omega dot"
+        updateProductionRates();
     }
 
     // evaluate reactor surfaces
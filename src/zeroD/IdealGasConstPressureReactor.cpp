@@ -89,7 +89,7 @@ void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
     m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
 
     if (m_chem) {
-        m_kin->getNetProductionRates(&m_wdot[0]); // "omega dot"
+        updateProductionRates();
     }
 
     // external heat transfer
@@ -108,7 +108,7 @@ void IdealGasMoleReactor::eval(double time, double* LHS, double* RHS)
     const vector_fp& imw = m_thermo->inverseMolecularWeights();
 
     if (m_chem) {
-        m_kin->getNetProductionRates(&m_wdot[0]); // "omega dot"
+        updateProductionRates();
     }
 
     // evaluate surfaces
@@ -84,7 +84,7 @@ void IdealGasReactor::eval(double time, double* LHS, double* RHS)
     const doublereal* Y = m_thermo->massFractions();
 
     if (m_chem) {
-        m_kin->getNetProductionRates(&m_wdot[0]); // "omega dot"
+        updateProductionRates();
     }
 
     evalSurfaces(LHS + m_nsp + 3, RHS + m_nsp + 3, m_sdot.data());
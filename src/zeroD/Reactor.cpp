@@ -4,6 +4,7 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/zeroD/Reactor.h"
+#include "cantera/zeroD/SourceTermCache.h"
 #include "cantera/zeroD/FlowDevice.h"
 #include "cantera/zeroD/Wall.h"
 #include "cantera/thermo/SurfPhase.h"
@@ -223,7 +224,7 @@ void Reactor::eval(double time, double* LHS, double* RHS)
     RHS[1] = m_vdot;
 
     if (m_chem) {
-        m_kin->getNetProductionRates(&m_wdot[0]); // "omega dot"
+        updateProductionRates();
     }
 
     for (size_t k = 0; k < m_nsp; k++) {
@@ -268,6 +269,19 @@ void Reactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+void Reactor::updateProductionRates()
+{
+    if (m_source_cache) {
+        if (m_source_cache->retrieve(*m_thermo, m_wdot.data())) {
+            return;
+        }
+        m_kin->getNetProductionRates(m_wdot.data());
+        m_source_cache->add(*m_thermo, m_wdot.data());
+        return;
+    }
+    m_kin->getNetProductionRates(m_wdot.data()); // "omega dot"
+}
+
 void Reactor::evalWalls(double t)
 {
     m_vdot = 0.0;
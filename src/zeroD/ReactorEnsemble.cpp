@@ -0,0 +1,31 @@
+//! @file ReactorEnsemble.cpp Parallel driver for independent reactor networks
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/base/ThreadPool.h"
+
+namespace Cantera
+{
+
+void ReactorEnsemble::advanceAll(double t)
+{
+    size_t n = m_nets.size();
+    if (m_threads < 2 || n < 2) {
+        for (auto& net : m_nets) {
+            net->advance(t);
+        }
+        return;
+    }
+
+    // networks are dispatched dynamically through the shared worker pool,
+    // so members that finish early immediately take over the remaining
+    // (possibly stiffer) ones, and concurrent parallel features do not
+    // oversubscribe the machine
+    ThreadPool::instance().parallelFor(n, [this, t](size_t i) {
+        m_nets[i]->advance(t);
+    });
+}
+
+}
@@ -4,12 +4,15 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/zeroD/ReactorNet.h"
+#include "cantera/base/ThreadPool.h"
 #include "cantera/zeroD/FlowDevice.h"
 #include "cantera/zeroD/Wall.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/Array.h"
 #include "cantera/numerics/Integrator.h"
 
+#include <fstream>
+
 using namespace std;
 
 namespace Cantera
@@ -136,6 +139,17 @@ void ReactorNet::reinitialize()
     }
 }
 
+void ReactorNet::setSensitivityMethod(const std::string& method)
+{
+    integrator().setSensitivityMethod(method);
+}
+
+void ReactorNet::setBandedLinearSolver(int mupper, int mlower)
+{
+    integrator().setBandwidth(mupper, mlower);
+    setLinearSolverType("BAND");
+}
+
 void ReactorNet::setLinearSolverType(const std::string& linSolverType)
 {
     m_integ->setLinearSolverType(linSolverType);
@@ -168,6 +182,9 @@ void ReactorNet::advance(doublereal time)
     m_integ->integrate(time);
     m_time = time;
     updateState(m_integ->solution());
+    if (m_recording) {
+        recordSample();
+    }
 }
 
 double ReactorNet::advance(double time, bool applylimit)
@@ -234,9 +251,82 @@ double ReactorNet::step()
     }
     m_time = m_integ->step(m_time + 1.0);
     updateState(m_integ->solution());
+    if (m_recording) {
+        recordSample();
+    }
     return m_time;
 }
 
+void ReactorNet::saveState(vector_fp& state)
+{
+    if (!m_init) {
+        initialize();
+    }
+    state.resize(m_nv + 2);
+    state[0] = m_time;
+    state[1] = m_integ->lastStepSize();
+    std::copy(m_integ->solution(), m_integ->solution() + m_nv,
+              state.begin() + 2);
+}
+
+void ReactorNet::loadState(const vector_fp& state)
+{
+    if (!m_init) {
+        initialize();
+    }
+    if (state.size() != m_nv + 2) {
+        throw CanteraError("ReactorNet::loadState",
+            "State blob size ({}) does not match network ({}).",
+            state.size(), m_nv + 2);
+    }
+    m_time = state[0];
+    updateState(const_cast<double*>(state.data()) + 2);
+    m_integ->setInitialStepSize(state[1]);
+    setInitialTime(m_time);
+    reinitialize();
+}
+
+const vector_fp& ReactorNet::eventTimes()
+{
+    return integrator().rootTimes();
+}
+
+const vector_int& ReactorNet::eventInfo()
+{
+    return integrator().rootInfo();
+}
+
+void ReactorNet::writeRecordedData(const std::string& fname) const
+{
+    std::ofstream out(fname, std::ios::binary);
+    if (!out) {
+        throw CanteraError("ReactorNet::writeRecordedData",
+                           "Unable to open file '{}' for writing.", fname);
+    }
+    out.write("CTTS", 4);
+    int32_t version = 1;
+    out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    uint64_t ncomp = m_record_components.size();
+    out.write(reinterpret_cast<const char*>(&ncomp), sizeof(ncomp));
+    for (size_t i : m_record_components) {
+        uint64_t comp = i;
+        out.write(reinterpret_cast<const char*>(&comp), sizeof(comp));
+    }
+    uint64_t nvals = m_recorded.size();
+    out.write(reinterpret_cast<const char*>(&nvals), sizeof(nvals));
+    out.write(reinterpret_cast<const char*>(m_recorded.data()),
+              nvals * sizeof(double));
+}
+
+void ReactorNet::recordSample()
+{
+    m_recorded.push_back(m_time);
+    const double* y = m_integ->solution();
+    for (size_t i : m_record_components) {
+        m_recorded.push_back(y[i]);
+    }
+}
+
 void ReactorNet::getEstimate(double time, int k, double* yest)
 {
     // initialize
@@ -273,6 +363,14 @@ void ReactorNet::eval(doublereal t, doublereal* y,
 {
     m_time = t;
     updateState(y);
+    if (m_parallel_chem && m_reactors.size() > 1) {
+        // evaluate each reactor's chemistry concurrently; every reactor
+        // touches only its own phase and kinetics objects, and the serial
+        // assembly below reuses the cached rates
+        ThreadPool::instance().parallelFor(m_reactors.size(), [this](size_t n) {
+            m_reactors[n]->updateChemistry();
+        });
+    }
     m_LHS.assign(m_nv, 1);
     m_RHS.assign(m_nv, 0);
     for (size_t n = 0; n < m_reactors.size(); n++) {
@@ -429,6 +527,39 @@ AnyMap ReactorNet::solverStats() const
     return m_integ->solverStats();
 }
 
+void ReactorNet::evalJacobian(double t, double* y, double* ydot, double* p,
+                              double* j)
+{
+    updateState(y);
+    std::fill(j, j + m_nv * m_nv, 0.0);
+    for (size_t i = 0; i < m_reactors.size(); i++) {
+        Eigen::SparseMatrix<double> rJac = m_reactors[i]->jacobian();
+        for (int k = 0; k < rJac.outerSize(); ++k) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(rJac, k); it; ++it) {
+                // dense column-major output
+                j[(it.col() + m_start[i]) * m_nv + it.row() + m_start[i]]
+                    = it.value();
+            }
+        }
+    }
+}
+
+void ReactorNet::evalJacobianSparse(double t, double* y, double* ydot,
+                                    double* p, SparseTriplets& jac)
+{
+    updateState(y);
+    for (size_t i = 0; i < m_reactors.size(); i++) {
+        Eigen::SparseMatrix<double> rJac = m_reactors[i]->jacobian();
+        for (int k = 0; k < rJac.outerSize(); ++k) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(rJac, k); it; ++it) {
+                jac.emplace_back(
+                    static_cast<int>(it.row() + m_start[i]),
+                    static_cast<int>(it.col() + m_start[i]), it.value());
+            }
+        }
+    }
+}
+
 std::string ReactorNet::linearSolverType() const
 {
     return m_integ->linearSolverType();
@@ -76,8 +76,20 @@ void ReactorSurface::getCoverages(double* cov) const
 
 void ReactorSurface::syncState()
 {
-    m_thermo->setTemperature(m_reactor->temperature());
+    double T = m_reactor->temperature();
+    // skip the push (and the invalidation cascade it triggers in the
+    // shared phase and its kinetics) when the phase still holds exactly
+    // this surface state
+    if (m_thermo->stateMFNumber() == m_syncStateNum && T == m_syncTemp
+        && m_cov == m_syncCov)
+    {
+        return;
+    }
+    m_thermo->setTemperature(T);
     m_thermo->setCoveragesNoNorm(m_cov.data());
+    m_syncStateNum = m_thermo->stateMFNumber();
+    m_syncTemp = T;
+    m_syncCov = m_cov;
 }
 
 void ReactorSurface::addSensitivityReaction(size_t i)
@@ -0,0 +1,71 @@
+//! @file SourceTermCache.cpp In-situ tabulation cache for source terms
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/SourceTermCache.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#include <cmath>
+
+namespace Cantera
+{
+
+namespace {
+
+//! FNV-1a hash over the raw bytes of the quantized key
+size_t hashKey(const std::vector<long long>& key)
+{
+    size_t h = 14695981039346656037ULL;
+    const unsigned char* p =
+        reinterpret_cast<const unsigned char*>(key.data());
+    for (size_t i = 0; i < key.size() * sizeof(long long); i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+} // anonymous namespace
+
+void SourceTermCache::makeKey(ThermoPhase& phase,
+                              std::vector<long long>& key) const
+{
+    size_t nsp = phase.nSpecies();
+    key.resize(nsp + 2);
+    // relative quantization of temperature and density via logarithms
+    key[0] = std::llround(std::log(phase.temperature()) / m_tol);
+    key[1] = std::llround(std::log(phase.density()) / m_tol);
+    const double* y = phase.massFractions();
+    for (size_t k = 0; k < nsp; k++) {
+        key[k + 2] = std::llround(y[k] / m_tol);
+    }
+}
+
+bool SourceTermCache::retrieve(ThermoPhase& phase, double* wdot)
+{
+    makeKey(phase, m_key);
+    auto iter = m_table.find(hashKey(m_key));
+    if (iter != m_table.end() && iter->second.key == m_key) {
+        std::copy(iter->second.wdot.begin(), iter->second.wdot.end(), wdot);
+        m_hits++;
+        return true;
+    }
+    m_misses++;
+    return false;
+}
+
+void SourceTermCache::add(ThermoPhase& phase, const double* wdot)
+{
+    if (m_table.size() >= m_maxEntries) {
+        // full tables are cleared wholesale; replacement policies are not
+        // worth their bookkeeping at this cache's hit cost
+        m_table.clear();
+    }
+    makeKey(phase, m_key);
+    Record& rec = m_table[hashKey(m_key)];
+    rec.key = m_key;
+    rec.wdot.assign(wdot, wdot + phase.nSpecies());
+}
+
+}
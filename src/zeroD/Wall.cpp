@@ -41,7 +41,7 @@ double Wall::vdot(double t)
     double rate = m_k * m_area * (m_left->pressure() - m_right->pressure());
 
     if (m_vf) {
-        rate += m_area * m_vf->eval(t);
+        rate += m_area * m_vtape.eval(t);
     }
     return rate;
 }
@@ -57,7 +57,7 @@ double Wall::Q(double t)
     }
 
     if (m_qf) {
-        q1 += m_area * m_qf->eval(t);
+        q1 += m_area * m_qtape.eval(t);
     }
     return q1;
 }
@@ -29,7 +29,7 @@ void MassFlowController::updateMassFlowRate(double time)
     }
     double mdot = m_coeff;
     if (m_tfunc) {
-        mdot *= m_tfunc->eval(time);
+        mdot *= m_ttape.eval(time);
     }
     m_mdot = std::max(mdot, 0.0);
 }
@@ -66,7 +66,7 @@ void Valve::updateMassFlowRate(double time)
     }
     double mdot = m_coeff;
     if (m_tfunc) {
-        mdot *= m_tfunc->eval(time);
+        mdot *= m_ttape.eval(time);
     }
     double delta_P = in().pressure() - out().pressure();
     if (m_pfunc) {
@@ -0,0 +1,218 @@
+// Regression tests for the shared numeric and infrastructure additions:
+// Interp1D, ThreadPool, Func1 tape evaluation, binary AnyMap
+// serialization, finite-check screening and the block-tridiagonal solver.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/base/ThreadPool.h"
+#include "cantera/base/global.h"
+#include "cantera/base/utilities.h"
+#include "cantera/numerics/BlockTridiagSolver.h"
+#include "cantera/numerics/Func1.h"
+#include "cantera/numerics/funcs.h"
+
+using namespace Cantera;
+
+TEST(Interp1D, linearMatchesLinearInterp)
+{
+    vector_fp x{0.0, 1.0, 2.5, 4.0, 7.0};
+    vector_fp f{1.0, -2.0, 0.5, 3.0, 3.0};
+    Interp1D interp(x, f, Interp1D::Method::Linear);
+    for (double xq : {0.0, 0.3, 1.0, 2.4, 3.99, 5.5, 7.0}) {
+        EXPECT_NEAR(interp.eval(xq), linearInterp(xq, x, f), 1e-14);
+    }
+    // clamped outside the table, matching linearInterp
+    EXPECT_DOUBLE_EQ(interp.eval(-1.0), f.front());
+    EXPECT_DOUBLE_EQ(interp.eval(10.0), f.back());
+}
+
+TEST(Interp1D, hermiteInterpolatesNodesAndPreservesMonotonicity)
+{
+    vector_fp x{0.0, 1.0, 2.0, 3.0, 4.0};
+    vector_fp f{0.0, 0.1, 2.0, 2.1, 5.0}; // monotone, uneven
+    Interp1D interp(x, f, Interp1D::Method::MonotoneHermite);
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_NEAR(interp.eval(x[i]), f[i], 1e-14);
+    }
+    double prev = interp.eval(0.0);
+    for (double xq = 0.01; xq <= 4.0; xq += 0.01) {
+        double v = interp.eval(xq);
+        EXPECT_GE(v, prev - 1e-12);
+        prev = v;
+    }
+}
+
+TEST(Interp1D, batchedEvalMatchesScalar)
+{
+    vector_fp x{0.0, 0.5, 1.5, 2.0};
+    vector_fp f{1.0, 4.0, -1.0, 0.0};
+    Interp1D interp(x, f, Interp1D::Method::Linear);
+    vector_fp xq{1.9, 0.1, 0.1, 1.2, 2.0, 0.0};
+    vector_fp fq(xq.size());
+    interp.eval(xq.size(), xq.data(), fq.data());
+    for (size_t i = 0; i < xq.size(); i++) {
+        EXPECT_NEAR(fq[i], interp.eval(xq[i]), 1e-14);
+    }
+}
+
+TEST(ThreadPool, parallelForCoversEveryIndexOnce)
+{
+    const size_t n = 10000;
+    std::vector<std::atomic<int>> hits(n);
+    for (auto& h : hits) {
+        h = 0;
+    }
+    ThreadPool::instance().parallelFor(n, [&](size_t i) {
+        hits[i]++;
+    });
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(hits[i].load(), 1);
+    }
+}
+
+TEST(ThreadPool, nestedCallsRunSerially)
+{
+    std::atomic<int> total(0);
+    ThreadPool::instance().parallelFor(8, [&](size_t i) {
+        ThreadPool::instance().parallelFor(4, [&](size_t j) {
+            total++;
+        });
+    });
+    EXPECT_EQ(total.load(), 32);
+}
+
+TEST(ThreadPool, workerExceptionsPropagate)
+{
+    EXPECT_THROW(
+        ThreadPool::instance().parallelFor(100, [](size_t i) {
+            if (i == 57) {
+                throw CanteraError("test", "worker failure");
+            }
+        }),
+        CanteraError);
+}
+
+TEST(Func1Tape, matchesTreeEvaluation)
+{
+    // (sin(2t) + t^2) * exp(-t), exercising sum, product, pow and
+    // standard function nodes
+    Func1* tree = new Product1(
+        *(new Sum1(*(new Sin1(2.0)), *(new Pow1(2.0)))),
+        *(new Exp1(-1.0)));
+    Func1Tape tape;
+    tape.compile(*tree);
+    ASSERT_TRUE(tape.ready());
+    for (double t : {0.0, 0.1, 0.7, 1.5, 3.0}) {
+        EXPECT_NEAR(tape.eval(t), tree->eval(t), 1e-13);
+    }
+    // memoized repeat of the last query
+    double v = tape.eval(1.5);
+    EXPECT_DOUBLE_EQ(tape.eval(1.5), v);
+    delete tree;
+}
+
+TEST(AnyMapBinary, roundTripPreservesContents)
+{
+    AnyMap m;
+    m["name"] = "h2o2";
+    m["count"] = 42;
+    m["tolerance"] = 1e-9;
+    m["enabled"] = true;
+    m["coeffs"] = vector_fp{1.0, -2.5, 3.75};
+    m["labels"] = std::vector<std::string>{"a", "bc"};
+    AnyMap inner;
+    inner["depth"] = 2;
+    m["nested"] = inner;
+
+    std::stringstream buf;
+    m.writeBinary(buf);
+    AnyMap copy = AnyMap::readBinary(buf);
+
+    EXPECT_EQ(copy["name"].asString(), "h2o2");
+    EXPECT_EQ(copy["count"].asInt(), 42);
+    EXPECT_DOUBLE_EQ(copy["tolerance"].asDouble(), 1e-9);
+    EXPECT_TRUE(copy["enabled"].asBool());
+    EXPECT_EQ(copy["coeffs"].asVector<double>(),
+              (vector_fp{1.0, -2.5, 3.75}));
+    EXPECT_EQ(copy["labels"].asVector<std::string>()[1], "bc");
+    EXPECT_EQ(copy["nested"].as<AnyMap>()["depth"].asInt(), 2);
+}
+
+TEST(FiniteCheck, screensNonFiniteValues)
+{
+    vector_fp good{1.0, -2.0, 0.0};
+    EXPECT_NO_THROW(checkFinite("good", good.data(), good.size()));
+
+    vector_fp bad{1.0, std::numeric_limits<double>::quiet_NaN(), 0.0};
+    EXPECT_THROW(checkFinite("bad", bad.data(), bad.size()), CanteraError);
+
+    // level 0 disables the screen entirely; restore the default afterwards
+    setFiniteCheckLevel(0);
+    EXPECT_NO_THROW(checkFinite("bad", bad.data(), bad.size()));
+    setFiniteCheckLevel(2);
+    EXPECT_THROW(checkFinite("bad", bad.data(), bad.size()), CanteraError);
+}
+
+TEST(BlockTridiagSolver, matchesDenseSolve)
+{
+    // assemble a diagonally dominant block-tridiagonal system with
+    // varying block sizes and compare against a dense Eigen solve
+    std::vector<size_t> sizes{3, 2, 4, 3, 2};
+    size_t n = sizes.size();
+    size_t total = 0;
+    for (size_t s : sizes) {
+        total += s;
+    }
+
+    std::srand(42);
+    auto randomBlock = [](size_t rows, size_t cols) {
+        return Eigen::MatrixXd::Random(rows, cols).eval();
+    };
+
+    std::vector<Eigen::MatrixXd> A(n), B(n), C(n);
+    std::vector<Eigen::VectorXd> b(n), x(n);
+    for (size_t i = 0; i < n; i++) {
+        B[i] = randomBlock(sizes[i], sizes[i]);
+        B[i] += 10.0 * Eigen::MatrixXd::Identity(sizes[i], sizes[i]);
+        A[i] = (i > 0) ? randomBlock(sizes[i], sizes[i-1])
+                       : Eigen::MatrixXd(sizes[i], 0);
+        C[i] = (i + 1 < n) ? randomBlock(sizes[i], sizes[i+1])
+                           : Eigen::MatrixXd(sizes[i], 0);
+        b[i] = Eigen::VectorXd::Random(sizes[i]);
+    }
+
+    // dense reference
+    Eigen::MatrixXd M = Eigen::MatrixXd::Zero(total, total);
+    Eigen::VectorXd rhs(total);
+    size_t row = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t col = row;
+        M.block(row, col, sizes[i], sizes[i]) = B[i];
+        if (i > 0) {
+            M.block(row, col - sizes[i-1], sizes[i], sizes[i-1]) = A[i];
+        }
+        if (i + 1 < n) {
+            M.block(row, col + sizes[i], sizes[i], sizes[i+1]) = C[i];
+        }
+        rhs.segment(row, sizes[i]) = b[i];
+        row += sizes[i];
+    }
+    Eigen::VectorXd xRef = M.partialPivLu().solve(rhs);
+
+    BlockTridiagSolver solver;
+    solver.setThreads(2);
+    ASSERT_EQ(solver.solve(A, B, C, b, x), 0);
+
+    row = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t k = 0; k < sizes[i]; k++) {
+            EXPECT_NEAR(x[i][k], xRef[row + k], 1e-9);
+        }
+        row += sizes[i];
+    }
+}
@@ -0,0 +1,385 @@
+// Regression tests for the kinetics performance-path additions: batched
+// rate evaluators, concentration derivatives, deactivated reactions,
+// cloning, equilibrium-constant caching, rate tables and DRG reduction.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/global.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/MechanismReduction.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/ReactionRateDelegator.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+using namespace Cantera;
+
+namespace {
+
+//! Maximum relative difference between two vectors
+double maxRelDiff(const vector_fp& a, const vector_fp& b)
+{
+    EXPECT_EQ(a.size(), b.size());
+    double err = 0.0;
+    for (size_t i = 0; i < a.size(); i++) {
+        double scale = std::max({fabs(a[i]), fabs(b[i]), 1e-300});
+        err = std::max(err, fabs(a[i] - b[i]) / scale);
+    }
+    return err;
+}
+
+//! Forward rate constants of *mech* at a fixed state, built with the given
+//! evaluator configuration
+vector_fp rateConstants(const std::string& mech, const std::string& phase,
+                        bool batched)
+{
+    bool previous = batched_rate_evaluators_used();
+    use_batched_rate_evaluators(batched);
+    auto sol = newSolution(mech, phase, "none");
+    use_batched_rate_evaluators(previous);
+    sol->thermo()->setState_TPX(1300.0, 2 * OneAtm,
+                                "H2:1.5, O2:1, H2O:0.3, AR:4");
+    vector_fp kf(sol->kinetics()->nReactions());
+    sol->kinetics()->getFwdRateConstants(kf.data());
+    return kf;
+}
+
+} // anonymous namespace
+
+TEST(BatchedEvaluators, matchPerReactionEvaluation)
+{
+    // h2o2 covers plain Arrhenius and Troe falloff reactions
+    vector_fp serial = rateConstants("h2o2.yaml", "ohmech", false);
+    vector_fp batched = rateConstants("h2o2.yaml", "ohmech", true);
+    EXPECT_LT(maxRelDiff(serial, batched), 1e-13);
+}
+
+TEST(BatchedEvaluators, matchPerReactionEvaluationGri30)
+{
+    // gri30 adds three-body, Lindemann and Plog-free pressure dependence
+    bool previous = batched_rate_evaluators_used();
+    use_batched_rate_evaluators(false);
+    auto serial = newSolution("gri30.yaml", "gri30", "none");
+    use_batched_rate_evaluators(true);
+    auto batched = newSolution("gri30.yaml", "gri30", "none");
+    use_batched_rate_evaluators(previous);
+
+    for (auto& sol : {serial, batched}) {
+        sol->thermo()->setState_TPX(1500.0, OneAtm, "CH4:1, O2:2, N2:7.52");
+    }
+    vector_fp kf1(serial->kinetics()->nReactions());
+    vector_fp kf2(batched->kinetics()->nReactions());
+    serial->kinetics()->getFwdRateConstants(kf1.data());
+    batched->kinetics()->getFwdRateConstants(kf2.data());
+    EXPECT_LT(maxRelDiff(kf1, kf2), 1e-13);
+}
+
+TEST(KineticsClone, productionRatesMatch)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    sol->thermo()->setState_TPX(1100.0, OneAtm, "H2:2, O2:1, AR:4");
+
+    auto thermo2 = sol->thermo()->clone();
+    auto kin2 = sol->kinetics()->clone({thermo2});
+
+    vector_fp wdot1(sol->thermo()->nSpecies());
+    vector_fp wdot2(sol->thermo()->nSpecies());
+    sol->kinetics()->getNetProductionRates(wdot1.data());
+    kin2->getNetProductionRates(wdot2.data());
+    EXPECT_LT(maxRelDiff(wdot1, wdot2), 1e-13);
+
+    // clones carry independent state
+    thermo2->setState_TP(1400.0, OneAtm);
+    kin2->getNetProductionRates(wdot2.data());
+    sol->kinetics()->getNetProductionRates(wdot1.data());
+    EXPECT_GT(maxRelDiff(wdot1, wdot2), 1e-4);
+}
+
+TEST(SolutionClone, sharesSpeciesAndReactions)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto dup = sol->clone();
+    EXPECT_EQ(sol->thermo()->species(0).get(), dup->thermo()->species(0).get());
+    EXPECT_EQ(sol->kinetics()->reaction(0).get(),
+              dup->kinetics()->reaction(0).get());
+}
+
+TEST(Multipliers, zeroMultiplierRemovesReaction)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& kin = *sol->kinetics();
+    sol->thermo()->setState_TPX(1200.0, OneAtm, "H2:2, O2:1, AR:4");
+
+    vector_fp rop0(kin.nReactions());
+    kin.getNetRatesOfProgress(rop0.data());
+
+    kin.setMultiplier(2, 0.0);
+    vector_fp rop(kin.nReactions());
+    kin.getNetRatesOfProgress(rop.data());
+    EXPECT_DOUBLE_EQ(rop[2], 0.0);
+
+    kin.setMultiplier(2, 1.0);
+    kin.getNetRatesOfProgress(rop.data());
+    EXPECT_NEAR(rop[2], rop0[2], 1e-13 * fabs(rop0[2]));
+}
+
+TEST(ConcentrationDerivatives, ddCiConsistentWithDdx)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& kin = *sol->kinetics();
+    sol->thermo()->setState_TPX(1200.0, OneAtm, "H2:2, O2:1, H2O:0.5, AR:4");
+
+    // X_j = c_j / c_tot, so at constant total concentration
+    // d/dc_j = (1/c_tot) d/dX_j
+    double ctot = sol->thermo()->molarDensity();
+    Eigen::SparseMatrix<double> ddX = kin.netProductionRates_ddX();
+    Eigen::SparseMatrix<double> ddCi = kin.netProductionRates_ddCi();
+    Eigen::SparseMatrix<double> diff = ddCi - ddX / ctot;
+    double scale = Eigen::MatrixXd(ddX).cwiseAbs().maxCoeff() / ctot;
+    EXPECT_LT(Eigen::MatrixXd(diff).cwiseAbs().maxCoeff(), 1e-10 * scale);
+}
+
+TEST(EquilibriumConstants, cachedAndBatchedMatch)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto kin = std::dynamic_pointer_cast<GasKinetics>(sol->kinetics());
+    ASSERT_TRUE(kin);
+    sol->thermo()->setState_TPX(1100.0, OneAtm, "H2:2, O2:1, AR:4");
+    size_t nr = kin->nReactions();
+
+    vector_fp kc1(nr), kc2(nr);
+    kin->getEquilibriumConstants(kc1.data());
+    kin->getEquilibriumConstants(kc2.data()); // cached path
+    EXPECT_LT(maxRelDiff(kc1, kc2), 1e-15);
+
+    vector_fp temps{900.0, 1100.0, 1500.0};
+    vector_fp batch(temps.size() * nr);
+    kin->getEquilibriumConstants(temps.size(), temps.data(), batch.data());
+    for (size_t n = 0; n < temps.size(); n++) {
+        sol->thermo()->setTemperature(temps[n]);
+        kin->getEquilibriumConstants(kc1.data());
+        vector_fp row(batch.begin() + n * nr, batch.begin() + (n + 1) * nr);
+        EXPECT_LT(maxRelDiff(kc1, row), 1e-13);
+    }
+}
+
+TEST(RateTables, interpolatedConstantsTrackExactValues)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto kin = std::dynamic_pointer_cast<GasKinetics>(sol->kinetics());
+    ASSERT_TRUE(kin);
+    sol->thermo()->setState_TPX(1200.0, OneAtm, "H2:2, O2:1, AR:4");
+    size_t nr = kin->nReactions();
+
+    vector_fp exact(nr), tabulated(nr);
+    sol->thermo()->setTemperature(1234.5);
+    kin->getFwdRateConstants(exact.data());
+
+    kin->enableRateTables(800.0, 2000.0, 400);
+    sol->thermo()->setTemperature(1234.5);
+    kin->getFwdRateConstants(tabulated.data());
+    EXPECT_LT(maxRelDiff(exact, tabulated), 2e-3);
+
+    // outside the window the exact path is used
+    kin->disableRateTables();
+    sol->thermo()->setTemperature(1234.5);
+    kin->getFwdRateConstants(tabulated.data());
+    EXPECT_LT(maxRelDiff(exact, tabulated), 1e-13);
+}
+
+TEST(MechanismReduction, drgKeepsTargetsAndAppliesCleanly)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& kin = *sol->kinetics();
+    sol->thermo()->setState_TPX(1200.0, OneAtm, "H2:2, O2:1, AR:4");
+
+    // a zero threshold keeps every species reachable from the targets
+    auto active = drgActiveSpecies(kin, {"H2", "O2"}, 0.0);
+    EXPECT_TRUE(active[kin.kineticsSpeciesIndex("H2")]);
+    EXPECT_TRUE(active[kin.kineticsSpeciesIndex("OH")]);
+
+    vector_fp wdot0(sol->thermo()->nSpecies());
+    kin.getNetProductionRates(wdot0.data());
+    size_t nActive = applySkeletalReduction(kin, active);
+    EXPECT_GT(nActive, 0u);
+
+    // restoring a fully active set restores the original rates
+    std::vector<bool> all(kin.nTotalSpecies(), true);
+    applySkeletalReduction(kin, all);
+    vector_fp wdot(sol->thermo()->nSpecies());
+    kin.getNetProductionRates(wdot.data());
+    EXPECT_LT(maxRelDiff(wdot0, wdot), 1e-13);
+}
+
+TEST(CompactReactionData, ratesUnchanged)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto& kin = *sol->kinetics();
+    sol->thermo()->setState_TPX(1400.0, OneAtm, "CH4:1, O2:2, N2:7.52");
+
+    vector_fp wdot0(sol->thermo()->nSpecies());
+    kin.getNetProductionRates(wdot0.data());
+    kin.compactReactionData();
+    vector_fp wdot(sol->thermo()->nSpecies());
+    kin.getNetProductionRates(wdot.data());
+    EXPECT_LT(maxRelDiff(wdot0, wdot), 1e-15);
+}
+
+TEST(StateEpochs, repeatedQueriesMatchAfterStateChanges)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& kin = *sol->kinetics();
+    auto& gas = *sol->thermo();
+
+    gas.setState_TPX(1200.0, OneAtm, "H2:2, O2:1, AR:4");
+    vector_fp a(gas.nSpecies()), b(gas.nSpecies());
+    kin.getNetProductionRates(a.data());
+    kin.getNetProductionRates(b.data()); // short-circuited path
+    EXPECT_LT(maxRelDiff(a, b), 1e-15);
+
+    gas.setTemperature(1250.0);
+    kin.getNetProductionRates(b.data());
+    EXPECT_GT(maxRelDiff(a, b), 1e-8); // state change must invalidate
+
+    // borrowed view agrees with the copying getter
+    kin.getNetProductionRates(a.data());
+    const vector_fp& view = kin.netProductionRates();
+    EXPECT_LT(maxRelDiff(a, view), 1e-15);
+}
+
+TEST(BatchedEvaluators, matchPerReactionEvaluationChebyshev)
+{
+    // pdep-test covers Chebyshev and Plog pressure dependence
+    bool previous = batched_rate_evaluators_used();
+    use_batched_rate_evaluators(false);
+    auto serial = newSolution("pdep-test.yaml");
+    use_batched_rate_evaluators(true);
+    auto batched = newSolution("pdep-test.yaml");
+    use_batched_rate_evaluators(previous);
+
+    for (double T : {500.0, 1100.0, 1900.0}) {
+        for (double P : {0.3 * OneAtm, OneAtm, 8 * OneAtm}) {
+            serial->thermo()->setState_TP(T, P);
+            batched->thermo()->setState_TP(T, P);
+            vector_fp kf1(serial->kinetics()->nReactions());
+            vector_fp kf2(batched->kinetics()->nReactions());
+            serial->kinetics()->getFwdRateConstants(kf1.data());
+            batched->kinetics()->getFwdRateConstants(kf2.data());
+            EXPECT_LT(maxRelDiff(kf1, kf2), 1e-13);
+        }
+    }
+}
+
+TEST(BatchedEvaluators, matchPerReactionEvaluationBlowersMasel)
+{
+    bool previous = batched_rate_evaluators_used();
+    use_batched_rate_evaluators(false);
+    auto serial = newSolution("blowers-masel.yaml", "gas", "none");
+    use_batched_rate_evaluators(true);
+    auto batched = newSolution("blowers-masel.yaml", "gas", "none");
+    use_batched_rate_evaluators(previous);
+
+    // Blowers-Masel activation energies depend on the reaction enthalpy,
+    // so compare at several full thermodynamic states
+    for (double T : {400.0, 900.0, 1600.0}) {
+        for (auto& sol : {serial, batched}) {
+            sol->thermo()->setState_TPX(T, OneAtm,
+                                        "H2:1, O2:1, OH:0.1, H2O:0.5");
+        }
+        vector_fp kf1(serial->kinetics()->nReactions());
+        vector_fp kf2(batched->kinetics()->nReactions());
+        serial->kinetics()->getFwdRateConstants(kf1.data());
+        batched->kinetics()->getFwdRateConstants(kf2.data());
+        EXPECT_LT(maxRelDiff(kf1, kf2), 1e-13);
+    }
+}
+
+TEST(BatchedEvaluators, matchPerReactionEvaluationTwoTempPlasma)
+{
+    bool previous = batched_rate_evaluators_used();
+    use_batched_rate_evaluators(false);
+    auto serial = newSolution("oxygen-plasma.yaml",
+                              "isotropic-electron-energy-plasma", "none");
+    use_batched_rate_evaluators(true);
+    auto batched = newSolution("oxygen-plasma.yaml",
+                               "isotropic-electron-energy-plasma", "none");
+    use_batched_rate_evaluators(previous);
+
+    // two-temperature rates depend on the gas and electron temperatures
+    // independently; vary both
+    for (double T : {400.0, 1000.0}) {
+        for (double Te : {8000.0, 20000.0}) {
+            for (auto& sol : {serial, batched}) {
+                auto& gas = *sol->thermo();
+                gas.setState_TPX(T, OneAtm, "O2:1, E:1e-5, O2-:1e-5");
+                gas.setElectronTemperature(Te);
+            }
+            vector_fp kf1(serial->kinetics()->nReactions());
+            vector_fp kf2(batched->kinetics()->nReactions());
+            serial->kinetics()->getFwdRateConstants(kf1.data());
+            batched->kinetics()->getFwdRateConstants(kf2.data());
+            EXPECT_LT(maxRelDiff(kf1, kf2), 1e-13);
+        }
+    }
+}
+
+TEST(DelegatedRates, batchEvalMatchesPerReactionDelegates)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& kin = *sol->kinetics();
+    size_t nr0 = kin.nReactions();
+
+    // two user rates of one type, k_f = A * T; the batched provider fills
+    // the whole slice of its rate type in a single callback
+    vector_fp A{2e3, 5e3};
+    auto nBatchCalls = std::make_shared<int>(0);
+    for (size_t i = 0; i < 2; i++) {
+        auto rate = std::make_shared<ReactionRateDelegator>();
+        rate->setType("linear-T");
+        double Ai = A[i];
+        rate->setDelegate("evalFromStruct",
+            [Ai](double& out, void* obj) -> int {
+                out = Ai * *static_cast<double*>(obj);
+                return 1;
+            }, "replace");
+        rate->setDelegate("evalBatch",
+            [A, nr0, nBatchCalls](double& out, void* obj) -> int {
+                auto& req = *static_cast<
+                    ReactionRateDelegator::BatchRequest*>(obj);
+                for (size_t n = 0; n < req.n; n++) {
+                    req.kf[n] = A[req.indices[n] - nr0] * req.temperature;
+                }
+                (*nBatchCalls)++;
+                return 1;
+            }, "replace");
+        auto rxn = std::make_shared<Reaction>(
+            parseCompString("H2:1 O2:1"),
+            parseCompString(i == 0 ? "OH:2" : "H2O:1 O:1"), rate);
+        kin.addReaction(rxn);
+    }
+
+    sol->thermo()->setState_TPX(1100.0, OneAtm, "H2:2, O2:1, AR:4");
+    vector_fp kf(kin.nReactions());
+
+    // per-reaction delegation
+    kin.getFwdRateConstants(kf.data());
+    EXPECT_NEAR(kf[nr0], 2e3 * 1100.0, 1e-9);
+    EXPECT_NEAR(kf[nr0 + 1], 5e3 * 1100.0, 1e-9);
+    EXPECT_EQ(*nBatchCalls, 0);
+
+    // batched delegation produces the same constants through one callback
+    for (size_t i = 0; i < 2; i++) {
+        auto rate = std::dynamic_pointer_cast<ReactionRateDelegator>(
+            kin.reaction(nr0 + i)->rate());
+        ASSERT_TRUE(rate);
+        rate->setHasBatchEval(true);
+    }
+    sol->thermo()->setTemperature(1300.0);
+    kin.getFwdRateConstants(kf.data());
+    EXPECT_NEAR(kf[nr0], 2e3 * 1300.0, 1e-9);
+    EXPECT_NEAR(kf[nr0 + 1], 5e3 * 1300.0, 1e-9);
+    EXPECT_EQ(*nBatchCalls, 1);
+}
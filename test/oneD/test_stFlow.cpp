@@ -0,0 +1,185 @@
+// Regression tests for the StFlow performance options: threaded
+// production-rate evaluation, frozen transport properties and
+// user-registered radiating species.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+using namespace Cantera;
+
+namespace {
+
+const size_t NPOINTS = 12;
+
+//! Build an axisymmetric flow domain on a small grid with nontrivial
+//! temperature and composition profiles, and return the corresponding
+//! state vector in *x*.
+std::unique_ptr<StFlow> makeFlow(shared_ptr<Solution> sol, vector_fp& x)
+{
+    auto& gas = *sol->thermo();
+    gas.setState_TPX(1200.0, OneAtm, "H2:1, O2:1, AR:5");
+
+    auto flow = std::unique_ptr<StFlow>(
+        new StFlow(sol->thermo().get(), gas.nSpecies(), NPOINTS));
+    flow->setKinetics(*sol->kinetics());
+    flow->setTransport(*sol->transport());
+    flow->setAxisymmetricFlow();
+    flow->setPressure(OneAtm);
+
+    vector_fp z(NPOINTS);
+    for (size_t j = 0; j < NPOINTS; j++) {
+        z[j] = 0.02 * j / (NPOINTS - 1);
+    }
+    flow->setupGrid(NPOINTS, z.data());
+
+    size_t nv = flow->nComponents();
+    x.assign(nv * NPOINTS, 0.0);
+    flow->_getInitialSoln(x.data());
+    for (size_t j = 0; j < NPOINTS; j++) {
+        double f = double(j) / (NPOINTS - 1);
+        x[c_offset_U + nv * j] = 0.3 * (1.0 - f);
+        x[c_offset_T + nv * j] = 900.0 + 1200.0 * f * (1.0 - f);
+        // shift composition from reactants to products along the grid
+        double* y = &x[c_offset_Y + nv * j];
+        gas.setState_TPX(x[c_offset_T + nv * j], OneAtm,
+                         fmt::format("H2:{}, O2:{}, H2O:{}, OH:0.01, AR:5",
+                                     1.0 - 0.8 * f, 1.0 - 0.4 * f, 0.8 * f));
+        gas.getMassFractions(y);
+    }
+    return flow;
+}
+
+//! Full residual of *flow* at state *x*
+vector_fp residual(StFlow& flow, vector_fp& x)
+{
+    vector_fp rsd(x.size(), 0.0);
+    vector_int diag(x.size(), 0);
+    flow.eval(npos, x.data(), rsd.data(), diag.data(), 0.0);
+    return rsd;
+}
+
+double maxAbsDiff(const vector_fp& a, const vector_fp& b)
+{
+    EXPECT_EQ(a.size(), b.size());
+    double err = 0.0;
+    for (size_t i = 0; i < a.size(); i++) {
+        err = std::max(err, fabs(a[i] - b[i]));
+    }
+    return err;
+}
+
+double maxAbs(const vector_fp& a)
+{
+    double v = 0.0;
+    for (double ai : a) {
+        v = std::max(v, fabs(ai));
+    }
+    return v;
+}
+
+} // anonymous namespace
+
+TEST(ThreadedChemistry, residualMatchesSerialEvaluation)
+{
+    vector_fp x1, x2;
+    auto serial = makeFlow(newSolution("h2o2.yaml", "ohmech", "Mix"), x1);
+    auto threaded = makeFlow(newSolution("h2o2.yaml", "ohmech", "Mix"), x2);
+    threaded->setChemistryThreads(4);
+    EXPECT_EQ(threaded->chemistryThreads(), (size_t) 4);
+
+    vector_fp r1 = residual(*serial, x1);
+    vector_fp r2 = residual(*threaded, x2);
+    EXPECT_LT(maxAbsDiff(r1, r2), 1e-9 * maxAbs(r1));
+
+    // repeated evaluations with cached worker clones stay consistent
+    vector_fp r3 = residual(*threaded, x2);
+    EXPECT_LT(maxAbsDiff(r2, r3), 1e-9 * maxAbs(r2));
+}
+
+TEST(FrozenTransport, staleAndRefreshedEvaluations)
+{
+    vector_fp x1, x2;
+    auto fresh = makeFlow(newSolution("h2o2.yaml", "ohmech", "Mix"), x1);
+    auto frozen = makeFlow(newSolution("h2o2.yaml", "ohmech", "Mix"), x2);
+    frozen->setFrozenTransportTolerance(0.05);
+    EXPECT_DOUBLE_EQ(frozen->frozenTransportTolerance(), 0.05);
+
+    // at the reference state both evaluations use up-to-date transport
+    vector_fp r1 = residual(*fresh, x1);
+    vector_fp r2 = residual(*frozen, x2);
+    EXPECT_LT(maxAbsDiff(r1, r2), 1e-10 * maxAbs(r1));
+
+    // a perturbation within the tolerance leaves the frozen flow on the
+    // stale transport arrays, so its residual departs from the fresh one
+    size_t nv = fresh->nComponents();
+    for (size_t j = 0; j < NPOINTS; j++) {
+        x1[c_offset_T + nv * j] *= 1.02;
+        x2[c_offset_T + nv * j] *= 1.02;
+    }
+    r1 = residual(*fresh, x1);
+    r2 = residual(*frozen, x2);
+    EXPECT_GT(maxAbsDiff(r1, r2), 0.0);
+
+    // once the accumulated drift exceeds the tolerance, the transport
+    // arrays are refreshed and the evaluations agree again
+    for (size_t j = 0; j < NPOINTS; j++) {
+        x1[c_offset_T + nv * j] *= 1.10;
+        x2[c_offset_T + nv * j] *= 1.10;
+    }
+    r1 = residual(*fresh, x1);
+    r2 = residual(*frozen, x2);
+    EXPECT_LT(maxAbsDiff(r1, r2), 1e-10 * maxAbs(r1));
+
+    // a zero tolerance disables freezing entirely
+    frozen->setFrozenTransportTolerance(0.0);
+    for (size_t j = 0; j < NPOINTS; j++) {
+        x1[c_offset_T + nv * j] *= 1.001;
+        x2[c_offset_T + nv * j] *= 1.001;
+    }
+    r1 = residual(*fresh, x1);
+    r2 = residual(*frozen, x2);
+    EXPECT_LT(maxAbsDiff(r1, r2), 1e-10 * maxAbs(r1));
+}
+
+TEST(RadiatingSpecies, userRegisteredRadiatorEntersEnergyResidual)
+{
+    vector_fp x1, x2;
+    auto base = makeFlow(newSolution("h2o2.yaml", "ohmech", "Mix"), x1);
+    auto extended = makeFlow(newSolution("h2o2.yaml", "ohmech", "Mix"), x2);
+    for (auto* flow : {base.get(), extended.get()}) {
+        flow->solveEnergyEqn();
+        flow->setBoundaryEmissivities(0.0, 0.0);
+        flow->enableRadiation(true);
+    }
+
+    // an additional radiator with a constant absorption coefficient;
+    // species absent from the mechanism are ignored
+    extended->addRadiatingSpecies("OH", {1.5, 0.0, 0.0, 0.0, 0.0, 0.0});
+    extended->addRadiatingSpecies("notAspecies", {1.0});
+
+    vector_fp r1 = residual(*base, x1);
+    vector_fp r2 = residual(*extended, x2);
+
+    // only the energy rows may differ, and the interior ones must
+    size_t nv = base->nComponents();
+    bool changed = false;
+    for (size_t j = 0; j < NPOINTS; j++) {
+        for (size_t n = 0; n < nv; n++) {
+            if (n != c_offset_T) {
+                EXPECT_NEAR(r1[n + nv * j], r2[n + nv * j],
+                            1e-10 * std::max(fabs(r1[n + nv * j]), 1.0));
+            } else if (j > 0 && j + 1 < NPOINTS
+                       && fabs(r1[n + nv * j] - r2[n + nv * j]) > 0.0) {
+                changed = true;
+            }
+        }
+    }
+    EXPECT_TRUE(changed);
+    EXPECT_GT(extended->radiativeHeatLoss(NPOINTS / 2),
+              base->radiativeHeatLoss(NPOINTS / 2));
+}
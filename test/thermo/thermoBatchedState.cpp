@@ -0,0 +1,133 @@
+// Regression tests for the batched/cached state evaluation additions to
+// ThermoPhase and Phase: evaluateStates, getPartialMolarAll, cloning,
+// indexed compositions and property-pair solver seeding.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+using namespace Cantera;
+
+TEST(EvaluateStates, matchesSequentialSetState)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& gas = *sol->thermo();
+    size_t nsp = gas.nSpecies();
+
+    const size_t nStates = 4;
+    vector_fp T{500.0, 900.0, 1400.0, 2100.0};
+    vector_fp P{OneAtm, 2 * OneAtm, 0.5 * OneAtm, 5 * OneAtm};
+    vector_fp Y(nStates * nsp, 0.0);
+    for (size_t n = 0; n < nStates; n++) {
+        gas.setState_TPX(T[n], P[n], "H2:2, O2:1, H2O:0.5, AR:4");
+        gas.setTemperature(T[n] + 10 * n); // perturb so states differ
+        gas.getMassFractions(&Y[n * nsp]);
+    }
+
+    vector_fp rho(nStates), h(nStates), s(nStates), cp(nStates);
+    gas.evaluateStates(nStates, T.data(), P.data(), Y.data(),
+                       rho.data(), h.data(), s.data(), cp.data());
+
+    for (size_t n = 0; n < nStates; n++) {
+        gas.setMassFractions_NoNorm(&Y[n * nsp]);
+        gas.setState_TP(T[n], P[n]);
+        EXPECT_NEAR(rho[n], gas.density(), 1e-10 * gas.density());
+        EXPECT_NEAR(h[n], gas.enthalpy_mass(), 1e-9 * fabs(gas.enthalpy_mass()));
+        EXPECT_NEAR(s[n], gas.entropy_mass(), 1e-9 * fabs(gas.entropy_mass()));
+        EXPECT_NEAR(cp[n], gas.cp_mass(), 1e-9 * gas.cp_mass());
+    }
+}
+
+TEST(PartialMolarAll, matchesIndividualGetters)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& gas = *sol->thermo();
+    gas.setState_TPX(1200.0, 3 * OneAtm, "H2:1, O2:2, OH:0.01, AR:5");
+    size_t nsp = gas.nSpecies();
+
+    vector_fp h(nsp), s(nsp), cp(nsp), mu(nsp);
+    gas.getPartialMolarAll(h.data(), s.data(), cp.data(), mu.data());
+
+    vector_fp hRef(nsp), sRef(nsp), cpRef(nsp), muRef(nsp);
+    gas.getPartialMolarEnthalpies(hRef.data());
+    gas.getPartialMolarEntropies(sRef.data());
+    gas.getPartialMolarCp(cpRef.data());
+    gas.getChemPotentials(muRef.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(h[k], hRef[k], 1e-10 * fabs(hRef[k]));
+        EXPECT_NEAR(s[k], sRef[k], 1e-10 * fabs(sRef[k]));
+        EXPECT_NEAR(cp[k], cpRef[k], 1e-10 * fabs(cpRef[k]));
+        EXPECT_NEAR(mu[k], muRef[k], 1e-10 * fabs(muRef[k]));
+    }
+}
+
+TEST(ThermoClone, independentStateSharedSpecies)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& gas = *sol->thermo();
+    gas.setState_TPX(800.0, OneAtm, "H2:1, O2:1");
+
+    auto dup = gas.clone();
+    EXPECT_DOUBLE_EQ(dup->temperature(), gas.temperature());
+    EXPECT_NEAR(dup->cp_mass(), gas.cp_mass(), 1e-12 * gas.cp_mass());
+    EXPECT_EQ(dup->species(0).get(), gas.species(0).get());
+
+    dup->setState_TP(1600.0, OneAtm);
+    EXPECT_DOUBLE_EQ(gas.temperature(), 800.0);
+}
+
+TEST(IndexedComposition, matchesNamedSetter)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& gas = *sol->thermo();
+
+    compositionMap comp{{"H2", 2.0}, {"O2", 1.0}, {"AR", 4.0}};
+    auto indexed = gas.compileComposition(comp);
+
+    gas.setState_TP(1000.0, OneAtm);
+    gas.setMoleFractionsByName(comp);
+    vector_fp xRef(gas.nSpecies());
+    gas.getMoleFractions(xRef.data());
+
+    gas.setMoleFractionsByName("H2:1"); // scramble
+    gas.setMoleFractions(indexed);
+    vector_fp x(gas.nSpecies());
+    gas.getMoleFractions(x.data());
+    for (size_t k = 0; k < gas.nSpecies(); k++) {
+        EXPECT_NEAR(x[k], xRef[k], 1e-14);
+    }
+}
+
+TEST(SpeciesIndices, resolvesNamesAndRejectsUnknown)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& gas = *sol->thermo();
+    auto idx = gas.speciesIndices({"H2", "OH", "AR"});
+    ASSERT_EQ(idx.size(), (size_t) 3);
+    EXPECT_EQ(idx[0], gas.speciesIndex("H2"));
+    EXPECT_EQ(idx[1], gas.speciesIndex("OH"));
+    EXPECT_EQ(idx[2], gas.speciesIndex("AR"));
+}
+
+TEST(PropertyPairSeeding, setStateHPConvergesToSameState)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& gas = *sol->thermo();
+    gas.setState_TPX(1500.0, OneAtm, "H2:2, O2:1, AR:4");
+    double h = gas.enthalpy_mass();
+    double p = gas.pressure();
+
+    // unseeded reference solve
+    gas.setState_TP(300.0, OneAtm);
+    gas.setState_HP(h, p);
+    double Tref = gas.temperature();
+
+    // seeded solve from the same cold start
+    gas.setState_TP(300.0, OneAtm);
+    gas.seedPropertyPairSolver(1500.0);
+    gas.setState_HP(h, p);
+    EXPECT_NEAR(gas.temperature(), Tref, 1e-7 * Tref);
+}
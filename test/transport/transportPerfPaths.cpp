@@ -0,0 +1,102 @@
+// Regression tests for the transport performance-path additions: packed
+// binary diffusion coefficients, fused mixture-averaged evaluation,
+// transport cloning and the tabulated mixture-averaged model.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "gtest/gtest.h"
+
+#include "cantera/base/Solution.h"
+#include "cantera/transport/GasTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+using namespace Cantera;
+
+TEST(PackedBinaryDiff, matchesFullMatrix)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "Mix");
+    auto tran = dynamic_cast<GasTransport*>(sol->transport().get());
+    ASSERT_TRUE(tran);
+    auto& gas = *sol->thermo();
+    gas.setState_TPX(900.0, OneAtm, "H2:1, O2:1, H2O:0.5, AR:2");
+    size_t nsp = gas.nSpecies();
+
+    vector_fp full(nsp * nsp);
+    tran->getBinaryDiffCoeffs(nsp, full.data());
+    vector_fp packed(nsp * (nsp + 1) / 2);
+    tran->getBinaryDiffCoeffsPacked(packed.data());
+
+    size_t ic = 0;
+    for (size_t i = 0; i < nsp; i++) {
+        for (size_t j = i; j < nsp; j++) {
+            EXPECT_NEAR(packed[ic], full[i * nsp + j],
+                        1e-12 * full[i * nsp + j]);
+            ic++;
+        }
+    }
+}
+
+TEST(MixDiffCoeffsAll, matchesIndividualGetters)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "Mix");
+    auto tran = dynamic_cast<GasTransport*>(sol->transport().get());
+    ASSERT_TRUE(tran);
+    auto& gas = *sol->thermo();
+    gas.setState_TPX(1300.0, 2 * OneAtm, "CH4:1, O2:2, N2:7.52, H2O:0.1");
+    size_t nsp = gas.nSpecies();
+
+    vector_fp dRef(nsp), dMoleRef(nsp), dMassRef(nsp);
+    tran->getMixDiffCoeffs(dRef.data());
+    tran->getMixDiffCoeffsMole(dMoleRef.data());
+    tran->getMixDiffCoeffsMass(dMassRef.data());
+
+    vector_fp d(nsp), dMole(nsp), dMass(nsp);
+    tran->getMixDiffCoeffsAll(d.data(), dMole.data(), dMass.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(d[k], dRef[k], 1e-12 * dRef[k]);
+        EXPECT_NEAR(dMole[k], dMoleRef[k], 1e-12 * dMoleRef[k]);
+        EXPECT_NEAR(dMass[k], dMassRef[k], 1e-12 * dMassRef[k]);
+    }
+
+    // null outputs select a subset without touching the others
+    std::fill(d.begin(), d.end(), -1.0);
+    tran->getMixDiffCoeffsAll(d.data(), nullptr, nullptr);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(d[k], dRef[k], 1e-12 * dRef[k]);
+    }
+}
+
+TEST(TransportClone, propertiesMatchAndStateIsIndependent)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "Mix");
+    auto& gas = *sol->thermo();
+    gas.setState_TPX(800.0, OneAtm, "H2:2, O2:1, AR:4");
+    double mu = sol->transport()->viscosity();
+
+    auto thermo2 = gas.clone();
+    auto tran2 = sol->transport()->clone(thermo2.get());
+    EXPECT_NEAR(tran2->viscosity(), mu, 1e-12 * mu);
+
+    // the clone follows its own phase, not the original
+    thermo2->setState_TP(1600.0, OneAtm);
+    EXPECT_GT(tran2->viscosity(), mu);
+    EXPECT_NEAR(sol->transport()->viscosity(), mu, 1e-12 * mu);
+}
+
+TEST(TabulatedMixTransport, tracksMixtureAveragedModel)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "Mix");
+    auto tab = newSolution("h2o2.yaml", "ohmech", "tabulated-mixture");
+    std::string comp = "H2:2, O2:1, H2O:0.5, AR:4";
+    for (double T : {500.0, 900.0, 1400.0, 2000.0}) {
+        sol->thermo()->setState_TPX(T, OneAtm, comp);
+        tab->thermo()->setState_TPX(T, OneAtm, comp);
+        double mu = sol->transport()->viscosity();
+        double lambda = sol->transport()->thermalConductivity();
+        EXPECT_NEAR(tab->transport()->viscosity(), mu, 5e-3 * mu);
+        EXPECT_NEAR(tab->transport()->thermalConductivity(), lambda,
+                    5e-3 * lambda);
+    }
+}
@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo.h"
+#include "cantera/kinetics.h"
+#include "cantera/zerodim.h"
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/SourceTermCache.h"
+
+using namespace Cantera;
+
+namespace {
+
+// Build an IdealGasConstPressureReactor network at the given initial
+// temperature; each call creates independent Solution objects so networks
+// can be integrated concurrently.
+std::pair<shared_ptr<Reactor>, shared_ptr<ReactorNet>> makeNet(double T0)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    sol->thermo()->setState_TPX(T0, OneAtm, "H2:2.0, O2:1.0, AR:8.0");
+    auto reactor = std::make_shared<IdealGasConstPressureReactor>();
+    reactor->insert(sol);
+    auto net = std::make_shared<ReactorNet>();
+    net->addReactor(*reactor);
+    return {reactor, net};
+}
+
+} // anonymous namespace
+
+TEST(ReactorEnsembleTest, advanceAllMatchesSerialIntegration)
+{
+    std::vector<double> temps{950.0, 1000.0, 1050.0, 1100.0};
+    std::vector<shared_ptr<Reactor>> reactors, reference;
+    ReactorEnsemble ensemble;
+    ensemble.setThreads(2);
+    for (double T0 : temps) {
+        auto member = makeNet(T0);
+        reactors.push_back(member.first);
+        ensemble.addNet(member.second);
+    }
+    ensemble.advanceAll(0.02);
+
+    for (size_t n = 0; n < temps.size(); n++) {
+        auto serial = makeNet(temps[n]);
+        serial.second->advance(0.02);
+        reference.push_back(serial.first);
+    }
+
+    for (size_t n = 0; n < temps.size(); n++) {
+        EXPECT_NEAR(reactors[n]->temperature(),
+                    reference[n]->temperature(),
+                    1e-6 * reference[n]->temperature());
+    }
+}
+
+TEST(Recorder, samplesTimeAndComponents)
+{
+    auto member = makeNet(1100.0);
+    ReactorNet& net = *member.second;
+    net.initialize();
+    size_t kT = net.globalComponentIndex("temperature");
+    net.startRecording({kT});
+
+    double t = 0.0;
+    const int nSteps = 20;
+    for (int i = 0; i < nSteps; i++) {
+        t += 1e-4;
+        net.advance(t);
+    }
+    net.stopRecording();
+
+    EXPECT_EQ(net.nRecordedSamples(), (size_t) nSteps);
+    const vector_fp& data = net.recordedData();
+    ASSERT_EQ(data.size(), (size_t) 2 * nSteps);
+    // last sample holds the final time and the current temperature
+    EXPECT_NEAR(data[2 * nSteps - 2], t, 1e-12);
+    EXPECT_NEAR(data[2 * nSteps - 1], member.first->temperature(),
+                1e-9 * member.first->temperature());
+
+    // no further samples are appended after stopRecording()
+    net.advance(t + 1e-4);
+    EXPECT_EQ(net.nRecordedSamples(), (size_t) nSteps);
+}
+
+TEST(Checkpointing, saveAndLoadStateResumeIdentically)
+{
+    auto member = makeNet(1050.0);
+    ReactorNet& net = *member.second;
+    net.advance(0.005);
+
+    vector_fp state;
+    net.saveState(state);
+    net.advance(0.02);
+    double Tfinal = member.first->temperature();
+
+    net.loadState(state);
+    net.advance(0.02);
+    EXPECT_NEAR(member.first->temperature(), Tfinal, 1e-6 * Tfinal);
+}
+
+TEST(Events, ignitionCrossingIsRecorded)
+{
+    auto member = makeNet(1100.0);
+    ReactorNet& net = *member.second;
+    size_t kT = net.globalComponentIndex("temperature");
+    net.addEvent([kT](double t, const double* y) {
+        return y[kT] - 1500.0;
+    });
+    net.advance(0.05);
+
+    const vector_fp& times = net.eventTimes();
+    ASSERT_EQ(times.size(), (size_t) 1);
+    EXPECT_GT(times[0], 0.0);
+    EXPECT_LT(times[0], 0.05);
+
+    // reinitializing for a new problem clears the recorded events
+    net.setInitialTime(0.0);
+    net.initialize();
+    EXPECT_EQ(net.eventTimes().size(), (size_t) 0);
+}
+
+TEST(SourceTermCacheTest, cachedRatesMatchDirectEvaluation)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& gas = *sol->thermo();
+    auto cache = std::make_shared<SourceTermCache>(1e-6);
+    size_t nsp = gas.nSpecies();
+    vector_fp wdot(nsp), wdotRef(nsp);
+
+    gas.setState_TPX(1200.0, OneAtm, "H2:2, O2:1, AR:4");
+    EXPECT_FALSE(cache->retrieve(gas, wdot.data()));
+    sol->kinetics()->getNetProductionRates(wdotRef.data());
+    cache->add(gas, wdotRef.data());
+
+    // a repeat query at the same state hits and reproduces the rates
+    ASSERT_TRUE(cache->retrieve(gas, wdot.data()));
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot[k], wdotRef[k], 1e-12 * std::max(fabs(wdotRef[k]), 1.0));
+    }
+    EXPECT_EQ(cache->hits(), (size_t) 1);
+    EXPECT_EQ(cache->misses(), (size_t) 1);
+
+    // a state outside the quantization tolerance misses
+    gas.setTemperature(1300.0);
+    EXPECT_FALSE(cache->retrieve(gas, wdot.data()));
+}
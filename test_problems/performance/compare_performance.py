@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Compare performance scenario results against a stored baseline.
+
+Usage:
+    python3 compare_performance.py baseline.yaml results.yaml [--tolerance 0.05]
+
+Exits nonzero (and prints the offending metrics) when any timed metric of
+any scenario regressed by more than the tolerance. Counter metrics (step
+and call counts) are reported informationally.
+"""
+import argparse
+import sys
+
+try:
+    from ruamel import yaml as ryaml
+    def load(path):
+        with open(path) as fh:
+            return ryaml.YAML(typ="safe").load(fh)
+except ImportError:
+    import yaml
+    def load(path):
+        with open(path) as fh:
+            return yaml.safe_load(fh)
+
+
+def walk(prefix, node, out):
+    if isinstance(node, dict):
+        for key, value in node.items():
+            walk(prefix + (key,), value, out)
+    elif isinstance(node, (int, float)):
+        out[prefix] = float(node)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("baseline")
+    parser.add_argument("results")
+    parser.add_argument("--tolerance", type=float, default=0.05)
+    args = parser.parse_args()
+
+    base = {}
+    new = {}
+    walk((), load(args.baseline), base)
+    walk((), load(args.results), new)
+
+    failed = False
+    for key in sorted(base):
+        if key not in new:
+            print("MISSING  {}".format("/".join(key)))
+            failed = True
+            continue
+        ref, val = base[key], new[key]
+        name = "/".join(key)
+        if ref <= 0:
+            continue
+        change = (val - ref) / ref
+        timed = key[-1].endswith("time") or key[-1] == "seconds"
+        if timed and change > args.tolerance:
+            print("REGRESSED  {}: {:.4g} -> {:.4g} (+{:.1%})".format(
+                name, ref, val, change))
+            failed = True
+        else:
+            print("ok         {}: {:.4g} -> {:.4g} ({:+.1%})".format(
+                name, ref, val, change))
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,81 @@
+//! @file perf_scenarios.cpp Timed end-to-end performance scenarios
+/*!
+ * Runs named end-to-end scenarios and writes wall time, call counters and
+ * solver statistics to a machine-readable YAML file. Together with
+ * compare_performance.py and a stored baseline, this flags performance
+ * regressions before they ship:
+ *
+ *     perf_scenarios results.yaml
+ *     python3 compare_performance.py baseline.yaml results.yaml
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/base/profiling.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+using namespace Cantera;
+
+namespace {
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+//! Ignition-delay batch: integrate a set of constant-pressure reactors over
+//! a range of initial temperatures to a fixed end time
+AnyMap ignitionBatch()
+{
+    auto start = std::chrono::steady_clock::now();
+    clearProfilingData();
+    size_t nSteps = 0;
+    for (int i = 0; i < 20; i++) {
+        auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+        sol->thermo()->setState_TPX(950.0 + 10.0 * i, OneAtm,
+                                    "H2:2, O2:1, AR:4");
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        while (net.time() < 1.0) {
+            net.step();
+            nSteps++;
+        }
+    }
+    AnyMap stats;
+    stats["wall-time"] = secondsSince(start);
+    stats["integrator-steps"] = static_cast<long int>(nSteps);
+    stats["profile"] = getProfilingData();
+    return stats;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "usage: perf_scenarios <output.yaml>" << std::endl;
+        return 1;
+    }
+    try {
+        AnyMap results;
+        results["ignition-batch"] = ignitionBatch();
+        std::ofstream out(argv[1]);
+        out << results.toYamlString();
+    } catch (std::exception& err) {
+        std::cerr << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
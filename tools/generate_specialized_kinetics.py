@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Generate a compile-time specialized Kinetics class for a fixed mechanism.
+
+For production runs that use one small mechanism for months, the generic
+runtime dispatch of GasKinetics/MultiRate leaves performance on the table.
+This tool emits a C++ translation unit defining a GasKinetics subclass whose
+rate-constant and rate-of-progress evaluation runs over constexpr parameter
+arrays with no virtual dispatch, and which registers itself with
+KineticsFactory under the name 'specialized-<phase>' when the compiled
+object is linked (or loaded as a plugin, in the spirit of the
+ExtensionManager machinery).
+
+Only mechanisms consisting entirely of elementary reactions with plain
+Arrhenius rates (reversible or irreversible, no third bodies or pressure
+dependence) are supported; the tool refuses anything else rather than
+generate silently incomplete kernels.
+
+Usage:
+    python3 generate_specialized_kinetics.py mech.yaml phase out.cpp
+"""
+import sys
+
+import cantera as ct
+
+
+HEADER = """// Generated by tools/generate_specialized_kinetics.py - do not edit.
+//
+// Specialized kinetics for mechanism '{source}', phase '{phase}'.
+
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/KineticsFactory.h"
+
+#include <cmath>
+
+namespace Cantera
+{{
+
+namespace
+{{
+
+constexpr size_t kNReactions = {n_reactions};
+constexpr double kLogA[kNReactions] = {{{log_a}}};
+constexpr double kB[kNReactions] = {{{b}}};
+constexpr double kEaR[kNReactions] = {{{ea_r}}};
+
+}} // anonymous namespace
+
+//! GasKinetics specialized at build time for one fixed mechanism: the
+//! forward rate constants are evaluated from constexpr parameter arrays in
+//! one unrollable loop with no virtual dispatch or rate-object indirection.
+class {cls} : public GasKinetics
+{{
+public:
+    virtual std::string kineticsType() const override {{
+        return "{factory_name}";
+    }}
+
+protected:
+    virtual void update_rates_T() override {{
+        double T = thermo().temperature();
+        m_logStandConc = std::log(thermo().standardConcentration());
+        if (T != m_temp) {{
+            double logT = std::log(T);
+            double recipT = 1.0 / T;
+            double kf[kNReactions];
+            for (size_t i = 0; i < kNReactions; i++) {{
+                kf[i] = std::exp(kLogA[i] + kB[i] * logT - kEaR[i] * recipT);
+            }}
+            for (size_t i = 0; i < kNReactions; i++) {{
+                m_rfn[i] = kf[i];
+            }}
+            m_kc_ok = false;
+            m_ROP_ok = false;
+        }}
+        m_pres = thermo().pressure();
+        m_temp = T;
+    }}
+}};
+
+namespace
+{{
+
+//! Registers the specialized kinetics with the factory at load time
+struct RegisterSpecializedKinetics
+{{
+    RegisterSpecializedKinetics() {{
+        KineticsFactory::factory()->reg("{factory_name}",
+            []() {{ return new {cls}(); }});
+    }}
+}};
+RegisterSpecializedKinetics registerSpecializedKinetics;
+
+}} // anonymous namespace
+
+}} // namespace Cantera
+"""
+
+
+def fmt(values):
+    return ", ".join("{:.17g}".format(v) for v in values)
+
+
+def main(argv):
+    if len(argv) != 4:
+        print(__doc__)
+        return 2
+    source, phase, out_path = argv[1:]
+    sol = ct.Solution(source, phase)
+
+    log_a, b, ea_r = [], [], []
+    for i, rxn in enumerate(sol.reactions()):
+        rate = rxn.rate
+        if rate.type != "Arrhenius":
+            raise SystemExit(
+                "Reaction {} has unsupported rate type '{}'; only plain "
+                "Arrhenius mechanisms can be specialized".format(i, rate.type))
+        if getattr(rxn, "third_body", None) is not None:
+            raise SystemExit(
+                "Reaction {} uses a third body, which is not supported"
+                .format(i))
+        import math
+        log_a.append(math.log(rate.pre_exponential_factor))
+        b.append(rate.temperature_exponent)
+        ea_r.append(rate.activation_energy / ct.gas_constant)
+
+    name = "".join(c if c.isalnum() else "_" for c in phase)
+    with open(out_path, "w") as out:
+        out.write(HEADER.format(
+            source=source,
+            phase=phase,
+            n_reactions=len(log_a),
+            log_a=fmt(log_a),
+            b=fmt(b),
+            ea_r=fmt(ea_r),
+            cls="Specialized_{}_Kinetics".format(name),
+            factory_name="specialized-{}".format(phase),
+        ))
+    print("Wrote {} ({} reactions)".format(out_path, len(log_a)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))